@@ -106,7 +106,13 @@ Arg::Arg(int argc, char *argv[])
   d_light(false),
   d_themeswitching(false),
   d_searchpage(false),
-  d_findrecipient(-1)
+  d_findrecipient(-1),
+  d_dedupmedia(false),
+  d_attachmentcache(""),
+  d_salvage(false),
+  d_stats(""),
+  d_statsfile(""),
+  d_trace("")
 {
   // vector to hold arguments
   std::vector<std::string> config;
@@ -1138,6 +1144,78 @@ bool Arg::parseArgs(std::vector<std::string> const &arguments)
       }
       continue;
     }
+    if (option == "--dedupmedia")
+    {
+      d_dedupmedia = true;
+      continue;
+    }
+    if (option == "--no-dedupmedia")
+    {
+      d_dedupmedia = false;
+      continue;
+    }
+    if (option == "--attachmentcache")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_attachmentcache = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--salvage")
+    {
+      d_salvage = true;
+      continue;
+    }
+    if (option == "--no-salvage")
+    {
+      d_salvage = false;
+      continue;
+    }
+    if (option == "--stats")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_stats = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--statsfile")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_statsfile = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--trace")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_trace = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
     if (option[0] != '-')
     {
       if (d_positionals >= 2)
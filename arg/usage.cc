@@ -69,6 +69,10 @@ changes, you must provide one of the output options.
    --limittothreadsbyname <THREADS_LIST> Optional modifier for `--dumpmedia'. Only save the attachments
                                          from the listed threads. List format same as
                                          `--croptothreadsbyname'
+   --dedupmedia                          Optional modifier for `--dumpmedia' and `--exporthtml'. Store
+                                         every distinct attachment only once (in DIRECTORY/.media), the
+                                         attachment files in the conversation folders are hard links to
+                                         that copy. Also applies when `--output' is a directory.
 --dumpavatars <DIRECTORY>                Save all avatars to DIRECTORY.
    --limitcontacts <CONTACTS>            Optional modifier for `--dumpavatars'. Only the avatars of
                                          listed contacts are saved. CONTACTS is a list "Name 1,Name
@@ -96,7 +100,8 @@ R"*(
                                          this option.
    --append                              Optional modifier for `--exporthtml'. Causes `--exporthtml' to
                                          not show an error when DIRECTORY is not empty, but also not
-                                         overwrite existing media files. Still regenerates the HTML file.
+                                         overwrite existing media files. HTML pages that did not change
+                                         since the previous export to DIRECTORY are not regenerated.
    --split [N]                           Optional modifier for `--exporthtml'. Splits the generated HTML
                                          files to a maximum of N messages per page. By default, the pages
                                          are not split. When this option is given without a value for N,
@@ -116,6 +121,11 @@ R"*(
 --overwrite                              Optional modifier for all output operations. Overwrite output
                                          files if they exist. When <OUTPUT> is a directory this will
                                          delete ALL directory contents.
+--attachmentcache <SIZE>                 Maximum amount of memory used to keep decrypted attachment data
+                                         around for reuse (for example "512M" or "2G", "0" disables the
+                                         cache). Attachments that are needed multiple times (exporting
+                                         HTML, deduplicating media, ...) are then only decrypted once
+                                         while they fit. Default is 128M.
 
  = EDITING OPTIONS =
 --croptothreads <THREADS_LIST>           Crop database to list of threads. The list supports comma
@@ -208,7 +218,22 @@ be removed.
                                               now)
 --stoponerror                                 Do not try to recover automatically when encountering bad
                                               data.
+--salvage                                     Write every frame of a damaged backup that can still be
+                                              verified to a new backup file (`-o'). Damaged parts are
+                                              skipped by scanning for the next good frame on all cores.
+                                              Found frames are remembered in `<INPUT>.salvage', an
+                                              interrupted run continues where it stopped.
 -v, --verbose                                 Makes the output even more verbose than it is already.
+--stats <FORMAT>                              At exit, print time (wall and CPU), bytes read/written,
+                                              frames/rows processed and peak memory use per phase of the
+                                              run (key derivation, decryption, exports, ...). FORMAT is
+                                              `text' or `json'.
+   --statsfile <FILE>                         Optional modifier for `--stats'. Write the statistics to
+                                              FILE instead of stdout.
+--trace <FILE>                                At exit, write a timeline of the time spent in frequently
+                                              called functions (reading frames and attachments, sql
+                                              queries, writing frames, html export) per thread to FILE
+                                              in Chrome trace format (chrome://tracing, Perfetto).
 --mergerecipients <OLDNUMBER,NEWNUMBER>       Can be used to change a contacts number (for example when
                                               they get a new phone). Messages from OLDNUMBER are changed
                                               so they appear as coming from NEWNUMBER, and the threads
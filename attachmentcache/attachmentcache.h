@@ -0,0 +1,226 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef ATTACHMENTCACHE_H_
+#define ATTACHMENTCACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Process wide LRU cache for decrypted attachment data, shared by all lazily loaded frames
+// (FrameWithAttachment::attachmentData()). Entries are keyed on the owning frame. An entry is
+// pinned once for every caller the data is handed out to (each attachmentData() until its
+// matching clearData()), only unpinned entries are evicted, least recently used first, whenever
+// the total size of all entries exceeds the budget. With a budget of 0, data is dropped as soon
+// as it is released.
+// Data can also be added ahead of use (AttachmentPrefetcher), such entries start out unpinned.
+class AttachmentCache
+{
+ public:
+  struct Stats
+  {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t prefetched;
+    uint64_t used;
+    uint64_t peak;
+  };
+
+  static uint64_t constexpr s_defaultbudget = 128 * 1024 * 1024;
+
+ private:
+  struct Entry
+  {
+    std::unique_ptr<unsigned char[]> data;
+    uint64_t size;
+    uint32_t pins;
+    std::list<void const *>::iterator lrupos; // only valid when pins == 0
+  };
+
+  static std::mutex s_mutex;
+  static std::unordered_map<void const *, Entry> s_entries;
+  static std::list<void const *> s_lru; // unpinned entries, least recently used at front
+  static uint64_t s_budget;
+  static Stats s_stats;
+
+ public:
+  inline static void setBudget(uint64_t bytes);
+  inline static uint64_t budget();
+  inline static unsigned char *acquire(void const *owner);
+  inline static unsigned char *insert(void const *owner, unsigned char *data, uint64_t size);
+  inline static bool insertUnpinned(void const *owner, unsigned char *data, uint64_t size);
+  inline static bool contains(void const *owner);
+  inline static void release(void const *owner);
+  inline static void erase(void const *owner);
+  inline static void rekey(void const *oldowner, void const *newowner);
+  inline static Stats stats();
+
+ private:
+  inline static void evict();
+};
+
+inline void AttachmentCache::setBudget(uint64_t bytes) // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_budget = bytes;
+  evict();
+}
+
+inline uint64_t AttachmentCache::budget() // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_budget;
+}
+
+// returns the (pinned) cached data for owner, or nullptr on a miss
+inline unsigned char *AttachmentCache::acquire(void const *owner) // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  auto it = s_entries.find(owner);
+  if (it == s_entries.end())
+  {
+    ++s_stats.misses;
+    return nullptr;
+  }
+  ++s_stats.hits;
+  if (it->second.pins++ == 0)
+    s_lru.erase(it->second.lrupos);
+  return it->second.data.get();
+}
+
+// takes ownership of data, the new entry is pinned. If owner already has an entry (another
+// caller decrypted the same data first, or it was prefetched meanwhile), that entry is never
+// replaced (it may be in use): data is dropped and the existing (now pinned) data is returned.
+inline unsigned char *AttachmentCache::insert(void const *owner, unsigned char *data, uint64_t size) // static
+{
+  std::unique_ptr<unsigned char[]> d(data);
+  std::lock_guard<std::mutex> lock(s_mutex);
+  auto it = s_entries.find(owner);
+  if (it != s_entries.end()) [[unlikely]]
+  {
+    if (it->second.pins++ == 0)
+      s_lru.erase(it->second.lrupos);
+    return it->second.data.get();
+  }
+  Entry &e = s_entries[owner];
+  e.data = std::move(d);
+  e.size = size;
+  e.pins = 1;
+  s_stats.used += size;
+  if (s_stats.used > s_stats.peak)
+    s_stats.peak = s_stats.used;
+  evict();
+  return data;
+}
+
+// takes ownership of data, adds it as the most recently used unpinned entry. Existing entries
+// are never replaced (the owner already fetched the data itself) and data that would push
+// out more than half the cache is not added at all. Returns false if data was dropped.
+inline bool AttachmentCache::insertUnpinned(void const *owner, unsigned char *data, uint64_t size) // static
+{
+  std::unique_ptr<unsigned char[]> d(data);
+  std::lock_guard<std::mutex> lock(s_mutex);
+  if (size > s_budget / 2 || s_entries.find(owner) != s_entries.end())
+    return false;
+  Entry &e = s_entries[owner];
+  e.data = std::move(d);
+  e.size = size;
+  e.pins = 0;
+  e.lrupos = s_lru.insert(s_lru.end(), owner);
+  ++s_stats.prefetched;
+  s_stats.used += size;
+  if (s_stats.used > s_stats.peak)
+    s_stats.peak = s_stats.used;
+  evict();
+  return true;
+}
+
+inline bool AttachmentCache::contains(void const *owner) // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_entries.find(owner) != s_entries.end();
+}
+
+inline void AttachmentCache::release(void const *owner) // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  auto it = s_entries.find(owner);
+  if (it == s_entries.end() || it->second.pins == 0) [[unlikely]]
+    return;
+  if (--it->second.pins == 0)
+  {
+    it->second.lrupos = s_lru.insert(s_lru.end(), owner);
+    evict();
+  }
+}
+
+inline void AttachmentCache::erase(void const *owner) // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  auto it = s_entries.find(owner);
+  if (it == s_entries.end())
+    return;
+  if (it->second.pins == 0)
+    s_lru.erase(it->second.lrupos);
+  s_stats.used -= it->second.size;
+  s_entries.erase(it);
+}
+
+// moves the entry of oldowner (if any) to newowner, keeping its data, pins and lru position
+inline void AttachmentCache::rekey(void const *oldowner, void const *newowner) // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  auto node = s_entries.extract(oldowner);
+  if (node.empty())
+    return;
+  if (s_entries.find(newowner) != s_entries.end()) [[unlikely]] // newowner already has (the same) data
+  {
+    if (node.mapped().pins == 0)
+      s_lru.erase(node.mapped().lrupos);
+    s_stats.used -= node.mapped().size;
+    return;
+  }
+  node.key() = newowner;
+  if (node.mapped().pins == 0)
+    *node.mapped().lrupos = newowner;
+  s_entries.insert(std::move(node));
+}
+
+inline AttachmentCache::Stats AttachmentCache::stats() // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_stats;
+}
+
+inline void AttachmentCache::evict() // static, s_mutex must be held
+{
+  while (s_stats.used > s_budget && !s_lru.empty())
+  {
+    auto it = s_entries.find(s_lru.front());
+    s_lru.pop_front();
+    s_stats.used -= it->second.size;
+    s_entries.erase(it);
+    ++s_stats.evictions;
+  }
+}
+
+#endif
@@ -0,0 +1,25 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "attachmentcache.h"
+
+std::mutex AttachmentCache::s_mutex; // static
+std::unordered_map<void const *, AttachmentCache::Entry> AttachmentCache::s_entries; // static
+std::list<void const *> AttachmentCache::s_lru; // static
+uint64_t AttachmentCache::s_budget = AttachmentCache::s_defaultbudget; // static
+AttachmentCache::Stats AttachmentCache::s_stats{0, 0, 0, 0, 0, 0}; // static
@@ -34,7 +34,9 @@ class AttachmentFrame : public FrameWithAttachment
    LENGTH = 3 // uint32
   };
 
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 3> s_fields{{{FIELD::ROWID, WIRETYPE::VARINT, false},
+                                                      {FIELD::ATTACHMENTID, WIRETYPE::VARINT, false},
+                                                      {FIELD::LENGTH, WIRETYPE::VARINT, false}}};
  public:
   inline explicit AttachmentFrame(uint64_t count = 0);
   inline AttachmentFrame(unsigned char *bytes, size_t length, uint64_t count = 0);
@@ -43,7 +45,6 @@ class AttachmentFrame : public FrameWithAttachment
   inline AttachmentFrame(AttachmentFrame const &other) = default;
   inline AttachmentFrame &operator=(AttachmentFrame const &other) = default;
   inline virtual ~AttachmentFrame() = default;
-  inline static BackupFrame *create(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual void printInfo() const override;
   inline virtual FRAMETYPE frameType() const override;
   inline uint32_t length() const;
@@ -68,8 +69,11 @@ inline AttachmentFrame::AttachmentFrame(uint64_t count)
 
 inline AttachmentFrame::AttachmentFrame(unsigned char *bytes, size_t length, uint64_t count)
   :
-  FrameWithAttachment(bytes, length, count)
-{}
+  FrameWithAttachment(count)
+{
+  d_constructedsize = length;
+  d_ok = init<s_fields>(bytes, length, &d_framedata);
+}
 
 // inline AttachmentFrame::AttachmentFrame(AttachmentFrame &&other)
 //   :
@@ -88,11 +92,6 @@ inline AttachmentFrame::AttachmentFrame(unsigned char *bytes, size_t length, uin
 // inline AttachmentFrame::~AttachmentFrame()
 // {}
 
-inline BackupFrame *AttachmentFrame::create(unsigned char *bytes, size_t length, uint64_t count) // static
-{
-  return new AttachmentFrame(bytes, length, count);
-}
-
 inline void AttachmentFrame::printInfo() const // virtual override
 {
   std::cout << "Frame number: " << d_count << std::endl;
@@ -0,0 +1,255 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef ATTACHMENTINDEX_H_
+#define ATTACHMENTINDEX_H_
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../attachmentframe/attachmentframe.h"
+
+// Maps {rowid, uniqueid} to AttachmentFrame. Replaces a std::map: the entries (key + frame pointer)
+// are kept in one flat vector, sorted on key, so lookups are a binary search over contiguous
+// memory instead of a walk through separately allocated tree nodes.
+//
+// Appending in key order (the common case when reading a backup) keeps the index sorted. Out of
+// order inserts just append and mark the index unsorted, it is sorted (once) on the next lookup or
+// iteration. Every accessor (including end()) sorts first, so iterators taken after an insert all
+// refer to the same, final vector. Lookups are safe to do from multiple threads at once, as long
+// as nothing modifies the index at the same time.
+class AttachmentIndex
+{
+ public:
+  using key_type = std::pair<uint64_t, uint64_t>; // {rowid, uniqueid}
+  using value_type = std::pair<key_type, std::unique_ptr<AttachmentFrame>>;
+  using iterator = std::vector<value_type>::iterator;
+  using const_iterator = std::vector<value_type>::const_iterator;
+
+ private:
+  mutable std::vector<value_type> d_entries;
+  mutable std::atomic<bool> d_sorted;
+  mutable std::mutex d_sortmutex;
+
+ public:
+  inline AttachmentIndex();
+  inline AttachmentIndex(AttachmentIndex &&other);
+  inline AttachmentIndex &operator=(AttachmentIndex &&other);
+  AttachmentIndex(AttachmentIndex const &other) = delete;
+  AttachmentIndex &operator=(AttachmentIndex const &other) = delete;
+
+  inline void emplace(key_type const &key, AttachmentFrame *frame);
+  inline void emplace(value_type &&entry);
+  inline void reserve(size_t size);
+
+  inline iterator find(key_type const &key);
+  inline const_iterator find(key_type const &key) const;
+  inline bool contains(key_type const &key) const;
+  inline std::unique_ptr<AttachmentFrame> const &at(key_type const &key) const;
+
+  inline iterator begin();
+  inline iterator end();
+  inline const_iterator begin() const;
+  inline const_iterator end() const;
+  inline size_t size() const;
+  inline bool empty() const;
+
+  inline iterator erase(iterator it);
+  template <typename P>
+  inline size_t eraseIf(P pred);
+  inline void clear();
+
+  template <typename F>
+  inline void rekey(F f);
+
+ private:
+  inline void ensureSorted() const;
+  inline void sortEntries() const;
+};
+
+inline AttachmentIndex::AttachmentIndex()
+  :
+  d_sorted(true)
+{}
+
+inline AttachmentIndex::AttachmentIndex(AttachmentIndex &&other)
+  :
+  d_entries(std::move(other.d_entries)),
+  d_sorted(other.d_sorted.load())
+{
+  other.d_entries.clear();
+  other.d_sorted = true;
+}
+
+inline AttachmentIndex &AttachmentIndex::operator=(AttachmentIndex &&other)
+{
+  if (this != &other)
+  {
+    d_entries = std::move(other.d_entries);
+    d_sorted = other.d_sorted.load();
+    other.d_entries.clear();
+    other.d_sorted = true;
+  }
+  return *this;
+}
+
+inline void AttachmentIndex::emplace(key_type const &key, AttachmentFrame *frame)
+{
+  emplace(value_type(key, frame));
+}
+
+inline void AttachmentIndex::emplace(value_type &&entry)
+{
+  if (d_sorted && !d_entries.empty() && !(d_entries.back().first < entry.first))
+    d_sorted = false;
+  d_entries.emplace_back(std::move(entry));
+}
+
+inline void AttachmentIndex::reserve(size_t size)
+{
+  d_entries.reserve(size);
+}
+
+inline AttachmentIndex::iterator AttachmentIndex::find(key_type const &key)
+{
+  ensureSorted();
+  auto it = std::lower_bound(d_entries.begin(), d_entries.end(), key,
+                             [](value_type const &e, key_type const &k) { return e.first < k; });
+  return (it != d_entries.end() && it->first == key) ? it : d_entries.end();
+}
+
+inline AttachmentIndex::const_iterator AttachmentIndex::find(key_type const &key) const
+{
+  ensureSorted();
+  auto it = std::lower_bound(d_entries.cbegin(), d_entries.cend(), key,
+                             [](value_type const &e, key_type const &k) { return e.first < k; });
+  return (it != d_entries.cend() && it->first == key) ? it : d_entries.cend();
+}
+
+inline bool AttachmentIndex::contains(key_type const &key) const
+{
+  return find(key) != d_entries.cend();
+}
+
+inline std::unique_ptr<AttachmentFrame> const &AttachmentIndex::at(key_type const &key) const
+{
+  auto it = find(key);
+  if (it == d_entries.cend()) [[unlikely]]
+    throw std::out_of_range("AttachmentIndex::at");
+  return it->second;
+}
+
+inline AttachmentIndex::iterator AttachmentIndex::begin()
+{
+  ensureSorted();
+  return d_entries.begin();
+}
+
+inline AttachmentIndex::iterator AttachmentIndex::end()
+{
+  ensureSorted(); // sorting may drop duplicates, invalidating a previously taken end()
+  return d_entries.end();
+}
+
+inline AttachmentIndex::const_iterator AttachmentIndex::begin() const
+{
+  ensureSorted();
+  return d_entries.cbegin();
+}
+
+inline AttachmentIndex::const_iterator AttachmentIndex::end() const
+{
+  ensureSorted();
+  return d_entries.cend();
+}
+
+inline size_t AttachmentIndex::size() const
+{
+  ensureSorted(); // may drop duplicates
+  return d_entries.size();
+}
+
+inline bool AttachmentIndex::empty() const
+{
+  ensureSorted();
+  return d_entries.empty();
+}
+
+inline AttachmentIndex::iterator AttachmentIndex::erase(iterator it)
+{
+  return d_entries.erase(it);
+}
+
+// removes all entries for which pred(entry) returns true, in a single pass
+template <typename P>
+inline size_t AttachmentIndex::eraseIf(P pred)
+{
+  ensureSorted();
+  return std::erase_if(d_entries, [&pred](value_type const &e) { return pred(e); });
+}
+
+inline void AttachmentIndex::clear()
+{
+  d_entries.clear();
+  d_sorted = true;
+}
+
+// calls f(AttachmentFrame *) on every frame (which may change its rowid/uniqueid),
+// then rebuilds all keys and restores order in one go.
+template <typename F>
+inline void AttachmentIndex::rekey(F f)
+{
+  for (auto &e : d_entries)
+  {
+    f(e.second.get());
+    e.first = {e.second->rowId(), e.second->attachmentId()};
+  }
+  d_sorted = false;
+  ensureSorted();
+}
+
+inline void AttachmentIndex::ensureSorted() const
+{
+  if (d_sorted.load(std::memory_order_acquire)) [[likely]]
+    return;
+
+  std::lock_guard<std::mutex> lock(d_sortmutex);
+  if (!d_sorted.load(std::memory_order_relaxed))
+  {
+    sortEntries();
+    d_sorted.store(true, std::memory_order_release);
+  }
+}
+
+inline void AttachmentIndex::sortEntries() const
+{
+  // most of the time, entries are (nearly) in order already
+  if (!std::is_sorted(d_entries.begin(), d_entries.end(), [](value_type const &a, value_type const &b) { return a.first < b.first; }))
+    std::stable_sort(d_entries.begin(), d_entries.end(), [](value_type const &a, value_type const &b) { return a.first < b.first; });
+
+  // like std::map::emplace, the first inserted entry wins if a key was inserted more than once
+  d_entries.erase(std::unique(d_entries.begin(), d_entries.end(), [](value_type const &a, value_type const &b) { return a.first == b.first; }),
+                  d_entries.end());
+}
+
+#endif
@@ -0,0 +1,133 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef ATTACHMENTPREFETCHER_H_
+#define ATTACHMENTPREFETCHER_H_
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "../attachmentcache/attachmentcache.h"
+#include "../basedecryptor/basedecryptor.h"
+#include "../framewithattachment/framewithattachment.h"
+#include "../threadpool/threadpool.h"
+
+// Reads and decrypts attachments into the AttachmentCache ahead of their use. The consumer passes
+// all frames in the order it is going to use them (nullptr entries are allowed, to keep indices
+// aligned with its own loop), and calls advance(idx) just before it uses frame idx. Once less than
+// half the lookahead is left, the next batch of frames (at most `lookahead' frames, with a total
+// size of at most half the cache budget) is read on a few background threads, sorted on their
+// position in the backup file, so the disk mostly sees forward reads instead of seeking back and
+// forth in database order. The frames must outlive the prefetcher.
+class AttachmentPrefetcher
+{
+  struct Request
+  {
+    FrameWithAttachment *frame;
+    uint64_t filepos;
+    uint32_t size;
+  };
+
+  std::vector<FrameWithAttachment *> d_frames;
+  std::vector<uint64_t> d_endoffset; // d_endoffset[i] = total size of frames [0, i]
+  uint64_t d_window;
+  std::size_t d_next;
+  unsigned int d_lookahead;
+  unsigned int d_threads;
+  std::atomic<bool> d_cancel;
+  std::unique_ptr<ThreadPool> d_pool; // only started once there is something to read
+
+ public:
+  inline explicit AttachmentPrefetcher(std::vector<FrameWithAttachment *> &&frames, unsigned int lookahead = 32,
+                                       unsigned int threads = 2);
+  AttachmentPrefetcher(AttachmentPrefetcher const &other) = delete;
+  AttachmentPrefetcher &operator=(AttachmentPrefetcher const &other) = delete;
+  inline ~AttachmentPrefetcher();
+  inline void advance(std::size_t idx);
+
+ private:
+  inline void fetch(Request const &r) const;
+};
+
+inline AttachmentPrefetcher::AttachmentPrefetcher(std::vector<FrameWithAttachment *> &&frames, unsigned int lookahead,
+                                                  unsigned int threads)
+  :
+  d_frames(std::move(frames)),
+  d_window(AttachmentCache::budget() / 2),
+  d_next(0),
+  d_lookahead(lookahead),
+  d_threads(threads),
+  d_cancel(false)
+{
+  d_endoffset.reserve(d_frames.size());
+  uint64_t total = 0;
+  for (FrameWithAttachment const *f : d_frames)
+    d_endoffset.push_back(total += (f ? f->length() : 0));
+}
+
+inline AttachmentPrefetcher::~AttachmentPrefetcher()
+{
+  // skip whatever was not started yet, wait for the rest
+  d_cancel = true;
+  d_pool.reset();
+}
+
+inline void AttachmentPrefetcher::advance(std::size_t idx)
+{
+  if (d_window == 0 || d_lookahead == 0 || idx >= d_frames.size()) [[unlikely]]
+    return;
+
+  // frame idx itself is about to be used by the caller
+  if (d_next <= idx)
+    d_next = idx + 1;
+  else if (d_next - idx > d_lookahead / 2)
+    return;
+
+  std::vector<Request> batch;
+  uint64_t base = d_endoffset[idx];
+  while (d_next < d_frames.size() && d_next <= idx + d_lookahead &&
+         d_endoffset[d_next] - base <= d_window)
+  {
+    FrameWithAttachment *f = d_frames[d_next++];
+    if (f && f->length() && f->needsData())
+      batch.push_back({f, f->filepos(), f->length()});
+  }
+  if (batch.empty())
+    return;
+
+  std::sort(batch.begin(), batch.end(), [](Request const &lhs, Request const &rhs) { return lhs.filepos < rhs.filepos; });
+
+  if (!d_pool)
+    d_pool.reset(new ThreadPool(d_threads));
+  for (Request const &r : batch)
+    d_pool->submit([this, r]() { fetch(r); });
+}
+
+inline void AttachmentPrefetcher::fetch(Request const &r) const
+{
+  if (d_cancel)
+    return;
+  std::unique_ptr<unsigned char[]> data;
+  if (BaseDecryptor::decryptAttachment(r.frame, r.size, &data, true /*quiet*/) == 0)
+    AttachmentCache::insertUnpinned(r.frame, data.release(), r.size);
+  // on failure the consumer will run into (and report) the same problem itself
+}
+
+#endif
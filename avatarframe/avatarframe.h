@@ -34,7 +34,9 @@ class AvatarFrame : public FrameWithAttachment
     RECIPIENT = 3, //string
   };
 
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 3> s_fields{{{FIELD::NAME, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::LENGTH, WIRETYPE::VARINT, false},
+                                                      {FIELD::RECIPIENT, WIRETYPE::LENGTHDELIM, false}}};
  public:
   inline explicit AvatarFrame(uint64_t count = 0);
   inline AvatarFrame(unsigned char *bytes, size_t length, uint64_t count = 0);
@@ -43,7 +45,6 @@ class AvatarFrame : public FrameWithAttachment
   // inline AvatarFrame(AvatarFrame const &other) = delete;
   // inline AvatarFrame &operator=(AvatarFrame const &other) = delete;
   inline virtual ~AvatarFrame() = default;
-  inline static BackupFrame *create(unsigned char *bytes, size_t length, uint64_t count);
   inline virtual void printInfo() const override;
   inline virtual FRAMETYPE frameType() const override;
   inline uint32_t length() const;
@@ -65,15 +66,13 @@ inline AvatarFrame::AvatarFrame(uint64_t count)
 
 inline AvatarFrame::AvatarFrame(unsigned char *bytes, size_t length, uint64_t count)
   :
-  FrameWithAttachment(bytes, length, count)
-{}
-
-
-inline BackupFrame *AvatarFrame::create(unsigned char *bytes, size_t length, uint64_t count) // static
+  FrameWithAttachment(count)
 {
-  return new AvatarFrame(bytes, length, count);
+  d_constructedsize = length;
+  d_ok = init<s_fields>(bytes, length, &d_framedata);
 }
 
+
 inline void AvatarFrame::printInfo() const // virtual override
 {
   std::cout << "Frame number: " << d_count << std::endl;
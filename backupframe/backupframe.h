@@ -24,7 +24,7 @@
 #include <cstddef>
 #include <vector>
 #include <tuple>
-#include <unordered_map>
+#include <array>
 #include <limits>
 
 #include "../common_be.h"
@@ -59,23 +59,40 @@ class BackupFrame
   };
 
  protected:
-  inline static std::unordered_map<FRAMETYPE, BackupFrame *(*)(unsigned char *, size_t, uint64_t)> &s_registry();
-
-  struct Registrar
+  // Compile time description of (the known fields of) a frame type. Each frame
+  // type has a constexpr table of these, from which init() is generated: fields
+  // with an unexpected wiretype fail the frame, fields marked as message are
+  // decoded (in the same pass) into the nested data, fields not in the table
+  // are kept as is.
+  struct FieldSpec
   {
-    Registrar(FRAMETYPE ft, BackupFrame *(*func)(unsigned char *, size_t, uint64_t))
-    {
-      DEBUGOUT("Registering class type: ", ft);
-      s_registry()[ft] = func;
-    }
+    unsigned int field;
+    WIRETYPE wiretype;
+    bool message;
   };
+  static constexpr std::array<FieldSpec, 0> s_nofields{};
+
+ private:
+  static constexpr unsigned char s_anytype = 0xff;
+  static constexpr unsigned char s_messagetype = 0x80;
+  // expected wiretype (| s_messagetype) for every field number a single tag byte can hold
+  template <auto const &fields>
+  static constexpr std::array<unsigned char, 16> s_wiretypes = []()
+  {
+    std::array<unsigned char, 16> wiretypes{};
+    wiretypes.fill(s_anytype);
+    for (auto const &f : fields)
+      wiretypes[f.field] = f.wiretype | (f.message ? s_messagetype : 0);
+    return wiretypes;
+  }();
+
+ protected:
   bool d_ok;
   std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> d_framedata; // field number, field data, length
   uint64_t d_count;
   size_t d_constructedsize;
  public:
   explicit inline BackupFrame(uint64_t count);
-  inline BackupFrame(unsigned char *data, size_t length, uint64_t count);
   inline BackupFrame(BackupFrame &&other);
   inline BackupFrame &operator=(BackupFrame &&other);
   inline BackupFrame(BackupFrame const &other);
@@ -88,7 +105,6 @@ class BackupFrame
   inline static int64_t getVarint(unsigned char *data, unsigned int *offset, unsigned int totallength);
   virtual FRAMETYPE frameType() const = 0;
   inline std::string frameTypeString() const;
-  inline static BackupFrame *instantiate(FRAMETYPE, unsigned char *data, size_t length, uint64_t count = 0);
   virtual void printInfo() const = 0;
   inline uint64_t frameNumber() const;
   inline virtual uint32_t attachmentSize() const;
@@ -102,7 +118,9 @@ class BackupFrame
   inline uint64_t bytesToUint64(unsigned char *data, size_t len) const;
   inline int32_t bytesToInt32(unsigned char *data, size_t len) const;
   inline int64_t bytesToInt64(unsigned char *data, size_t len) const;
-  bool init(unsigned char *data, size_t length, std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *framedata);
+  template <auto const &fields, auto const &nestedfields = s_nofields>
+  inline bool init(unsigned char *data, size_t length, std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *framedata,
+                   std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *nesteddata = nullptr);
   template <typename T>
   inline void intTypeToBytes(T val, unsigned char *b);
   inline uint64_t putVarInt(uint64_t val, unsigned char *mem) const;
@@ -118,12 +136,6 @@ class BackupFrame
   inline static int64_t getLengthOrVarint(unsigned char *data, unsigned int *offset, unsigned int totallength);
 };
 
-inline std::unordered_map<BackupFrame::FRAMETYPE, BackupFrame *(*)(unsigned char *, size_t, uint64_t)> &BackupFrame::s_registry() // static
-{
-  static std::unordered_map<FRAMETYPE, BackupFrame *(*)(unsigned char *, size_t, uint64_t)> impl;
-  return impl;
-}
-
 inline BackupFrame::BackupFrame(uint64_t num)
   :
   d_ok(false),
@@ -131,18 +143,6 @@ inline BackupFrame::BackupFrame(uint64_t num)
   d_constructedsize(0)
 {}
 
-inline BackupFrame::BackupFrame(unsigned char *data, size_t l, uint64_t num)
-  :
-  d_ok(false),
-  d_count(num),
-  d_constructedsize(l)
-{
-  //std::cout << "CREATING BACKUPFRAME!" << std::endl;
-  DEBUGOUT("CREATING BACKUPFRAME!");
-  DEBUGOUT("DATA: ", bepaald::bytesToHexString(data, l), " (", l, " bytes)");
-  d_ok = init(data, l, &d_framedata);
-}
-
 inline BackupFrame::BackupFrame(BackupFrame &&other)
   :
   d_ok(std::move(other.d_ok)),
@@ -309,38 +309,85 @@ inline int64_t BackupFrame::getLengthOrVarint(unsigned char *data, unsigned int
   return length;
 }
 
-
-inline BackupFrame *BackupFrame::instantiate(FRAMETYPE ft, unsigned char *data, size_t length, uint64_t count) //static
+template <auto const &fields, auto const &nestedfields>
+inline bool BackupFrame::init(unsigned char *data, size_t l, std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *framedata,
+                              std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *nesteddata)
 {
-  auto it = s_registry().find(ft);
-
-  /*
-  if (it == s_registry().end())
+  unsigned int processed = 0;
+  while (processed < l)
   {
-    std::cout << s_registry().size() << std::endl;
-    std::cout << ft << std::endl;
-    std::cout << "END!" << std::endl;
-  }
-  */
+    int fieldnumber = getFieldnumber(data[processed]);
+    if (fieldnumber < 0) [[unlikely]]
+      return false;
+    uint32_t type = wiretype(data[processed]);
+    ++processed; // first byte was eaten
 
-  if (it == s_registry().end()) [[unlikely]]
-  {
-    //std::cout << "ERROR: Incorrect or unknown frametype (" << static_cast<unsigned int>(ft) << ")" << std::endl;
-    return nullptr;
-  }
+    unsigned char expected = s_wiretypes<fields>[fieldnumber];
+    if (expected != s_anytype && (expected & ~s_messagetype) != type) [[unlikely]] // known field, wrong type
+      return false;
 
-  BackupFrame *ret = (it->second)(data, length, count);
-
-  if (!ret->ok()) [[unlikely]]
-  {
-    //std::cout << "ERROR: BackupFrame::ok() failed" << std::endl;
-    delete ret;
-    return nullptr;
+    switch (type)
+    {
+      case LENGTHDELIM: // need to read next bytes for length
+      {
+        int64_t length = getLength(data, &processed, l);
+        if (length < 0 || processed + static_cast<uint64_t>(length) > l) [[unlikely]] // more then we have
+          return false;
+        if constexpr (nestedfields.size() > 0)
+        {
+          if (expected != s_anytype && (expected & s_messagetype))
+          {
+            // decode the message directly, the field itself only marks its position
+            if (!init<nestedfields>(data + processed, length, nesteddata)) [[unlikely]]
+              return false;
+            framedata->emplace_back(std::make_tuple(fieldnumber, nullptr, 0));
+            processed += length;
+            break;
+          }
+        }
+        unsigned char *fielddata = new unsigned char[length];
+        std::memcpy(fielddata, data + processed, length);
+        framedata->emplace_back(std::make_tuple(fieldnumber, fielddata, length));
+        processed += length; // up to length was eaten
+        break;
+      }
+      case VARINT:
+      {
+        int64_t val = getVarint(data, &processed, l); // for UNSIGNED varints
+        if (val == -1 &&                           // (possible?) invalid value
+            processed == l &&                      // last byte was processed
+            data[l - 1] & 0b10000000) [[unlikely]] // but last byte was not end of varint
+          return false;
+        val = bepaald::swap_endian(val); // because java writes integers in big endian?
+        unsigned char *fielddata = new unsigned char[sizeof(decltype(val))];
+        std::memcpy(fielddata, reinterpret_cast<unsigned char *>(&val), sizeof(decltype(val)));
+        framedata->emplace_back(std::make_tuple(fieldnumber, fielddata, sizeof(decltype(val))));
+        // processed is set in getVarInt
+        break;
+      }
+      case FIXED32:
+      case FIXED64:
+      {
+        unsigned int length = (type == FIXED32) ? 4 : 8;
+        if (processed + length > l) [[unlikely]] // more then we have
+          return false;
+        unsigned char *fielddata = new unsigned char[length];
+        std::memcpy(fielddata, data + processed, length);
+        framedata->emplace_back(std::make_tuple(fieldnumber, fielddata, length));
+        processed += length;
+        break;
+      }
+      case STARTTYPE: // (deprecated) groups, not used in backups
+      case ENDTYPE:
+        break;
+      default: // not a valid wiretype
+        return false;
+    }
   }
-
-  return ret;
+  return (processed == l);
 }
 
+
 // maybe check endianness?
 inline uint32_t BackupFrame::bytesToUint32(unsigned char *data, size_t len) const
 {
@@ -405,7 +452,7 @@ inline void BackupFrame::intTypeToBytes(T val, unsigned char *b)
   DEBUGOUT("WROWR   ", bytesToUint32(t, sizeof(decltype(t))));
 
   for (size_t i = 0; i < sizeof(T); ++i)
-    b[i] = (val >> ((sizeof(T) - i) * 8));
+    b[i] = (val >> ((sizeof(T) - 1 - i) * 8));
 
   DEBUGOUT("GOT: ", val);
   DEBUGOUT("GOT: ", bepaald::bytesToHexString(b, sizeof(T)));
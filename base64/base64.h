@@ -25,11 +25,13 @@
 #include <cstring>
 
 #include <string>
+#include <ostream>
 
 struct Base64
 {
  public:
   inline static std::string bytesToBase64String(unsigned char const *data, size_t size);
+  inline static bool bytesToBase64Stream(unsigned char const *data, size_t size, std::ostream &out);
   inline static std::pair<unsigned char*, size_t> base64StringToBytes(std::string const &str);
 };
 
@@ -48,6 +50,27 @@ inline std::string Base64::bytesToBase64String(unsigned char const *data, size_t
   return std::string(reinterpret_cast<char *>(output.get()), base64length);
 }
 
+// encodes in fixed size chunks directly into out, without holding the full encoded string in memory
+inline bool Base64::bytesToBase64Stream(unsigned char const *data, size_t size, std::ostream &out)
+{
+  size_t const CHUNKSIZE = 48 * 1024; // multiple of 3, so only the final chunk is padded
+  unsigned char output[CHUNKSIZE / 3 * 4 + 1]; // +1 for terminating null
+  size_t processed = 0;
+  while (processed < size)
+  {
+    size_t chunk = std::min(size - processed, CHUNKSIZE);
+    int base64length = ((4 * chunk / 3) + 3) & ~3;
+    if (EVP_EncodeBlock(output, data + processed, chunk) != base64length) [[unlikely]]
+    {
+      std::cout << "Failed to base64enc data" << std::endl;
+      return false;
+    }
+    out.write(reinterpret_cast<char *>(output), base64length);
+    processed += chunk;
+  }
+  return true;
+}
+
 inline std::pair<unsigned char*, size_t> Base64::base64StringToBytes(std::string const &str)
 {
   int binarylength = str.size() / 4 * 3;
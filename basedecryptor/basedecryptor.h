@@ -22,6 +22,9 @@
 
 #include "../cryptbase/cryptbase.h"
 
+#include <cstdint>
+#include <memory>
+
 class FrameWithAttachment;
 
 class BaseDecryptor : public CryptBase
@@ -29,6 +32,8 @@ class BaseDecryptor : public CryptBase
  public:
   inline BaseDecryptor() = default;
   static int getAttachment(FrameWithAttachment *frame);
+  static int decryptAttachment(FrameWithAttachment const *frame, uint32_t size,
+                               std::unique_ptr<unsigned char[]> *data, bool quiet = false);
 };
 
 #endif
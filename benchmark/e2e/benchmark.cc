@@ -0,0 +1,466 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+/*
+  signalbackup-tools-benchmark
+
+  Generates a deterministic synthetic backup (see ../syntheticbackup/syntheticbackup.h) and times
+  a number of common operations on it. Results are written as JSON, so runs on different
+  commits can be compared. All normal program output is suppressed while running, unless
+  `--verbose' is given.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "../../common_be.h"
+#include "../../signalbackup/signalbackup.h"
+#include "../syntheticbackup/syntheticbackup.h"
+
+#if __has_include("../../autoversion.h")
+#include "../../autoversion.h"
+#endif
+
+namespace
+{
+  class Timer
+  {
+    std::chrono::steady_clock::time_point d_start;
+    double d_ms = 0;
+   public:
+    void start() { d_start = std::chrono::steady_clock::now(); }
+    void stop() { d_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - d_start).count(); }
+    double ms() const { return d_ms; }
+  };
+
+  class NullBuffer : public std::streambuf
+  {
+   protected:
+    int overflow(int c) override { return c; }
+  };
+
+  // redirects std::cout to nowhere for its lifetime
+  class Silence
+  {
+    NullBuffer d_null;
+    std::streambuf *d_old;
+   public:
+    explicit Silence(bool active) : d_old(active ? std::cout.rdbuf(&d_null) : nullptr) {}
+    ~Silence() { if (d_old) std::cout.rdbuf(d_old); }
+  };
+
+  struct Scenario
+  {
+    std::string name;
+    std::function<bool(Timer *)> run; // does its own (untimed) setup, times only the operation itself
+  };
+
+  struct Result
+  {
+    std::string name;
+    bool ok = true;
+    std::vector<double> runs;
+  };
+
+  std::string jsonString(std::string const &s)
+  {
+    std::string out("\"");
+    for (char c : s)
+    {
+      if (c == '"' || c == '\\')
+        out += std::string("\\") + c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+      {
+        std::ostringstream oss;
+        oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+        out += oss.str();
+      }
+      else
+        out += c;
+    }
+    return out + "\"";
+  }
+
+  bool isNumber(std::string const &s)
+  {
+    return !s.empty() && std::all_of(s.begin(), s.end(), [](unsigned char c) { return std::isdigit(c); });
+  }
+
+  bool parseList(std::string const &list, std::vector<long long int> *values)
+  {
+    values->clear();
+    std::istringstream iss(list);
+    std::string item;
+    while (std::getline(iss, item, ','))
+    {
+      if (!isNumber(item))
+        return false;
+      values->push_back(bepaald::toNumber<long long int>(item));
+    }
+    return true;
+  }
+
+  void usage(char const *prog)
+  {
+    std::cout << "Usage: " << prog << " [OPTIONS]" << std::endl
+              << std::endl
+              << "Synthetic backup:" << std::endl
+              << "  --messages N               Number of messages (default 10000)" << std::endl
+              << "  --threads N                Number of one-to-one threads (default 20)" << std::endl
+              << "  --groupsizes N[,N...]      Create a group (with thread) of each size (>= 2), including self (default 5,25,100)" << std::endl
+              << "  --attachments F            Fraction of messages with an attachment (default 0.05)" << std::endl
+              << "  --attachmentsizes MIN,MAX  Range of attachment sizes in bytes (default 4096,4194304)" << std::endl
+              << "  --emojidensity F           Chance of a word being an emoji, and of a message getting a reaction (default 0.05)" << std::endl
+              << "  --mentiondensity F         Chance of a group message containing a mention (default 0.1)" << std::endl
+              << "  --seed N                   Seed for all generated data (default 1)" << std::endl
+              << "  --generate FILE            Only write the synthetic backup to FILE (passphrase: 30 zeroes) and exit" << std::endl
+              << std::endl
+              << "Benchmark:" << std::endl
+              << "  --scenarios NAME[,NAME...] Scenarios to run (default: all). Available: open, exportfile, exportdir," << std::endl
+              << "                             exporthtml, dumpmedia, croptothread, importthread, mergerecipients" << std::endl
+              << "  --repeat N                 Number of timed runs per scenario (default 3)" << std::endl
+              << "  --workdir DIR              Directory for generated files (default: system temp directory)" << std::endl
+              << "  --keep                     Do not remove the generated files when done" << std::endl
+              << "  --output FILE              Write JSON results to FILE instead of stdout" << std::endl
+              << "  --verbose                  Do not suppress the output of the scenarios" << std::endl;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  SyntheticBackup::Params params;
+  std::vector<std::string> scenarionames;
+  std::string generate;
+  std::string output;
+  std::filesystem::path workdir = std::filesystem::temp_directory_path() / "signalbackup-tools-benchmark";
+  long long int repeat = 3;
+  bool keep = false;
+  bool verbose = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string const option(argv[i]);
+    bool const hasvalue = i + 1 < argc;
+    std::string const value(hasvalue ? argv[i + 1] : "");
+    std::vector<long long int> list;
+    bool ok = true;
+
+    if (option == "-h" || option == "--help")
+    {
+      usage(argv[0]);
+      return 0;
+    }
+    else if (option == "--keep")
+      keep = true;
+    else if (option == "--verbose")
+      verbose = true;
+    else if (!hasvalue)
+      ok = false;
+    else if (option == "--messages" && (ok = isNumber(value)))
+      params.messages = bepaald::toNumber<long long int>(value);
+    else if (option == "--threads" && (ok = isNumber(value)))
+      params.threads = bepaald::toNumber<long long int>(value);
+    else if (option == "--groupsizes" && (ok = parseList(value, &list)))
+      params.groupsizes = list;
+    else if (option == "--attachments")
+      params.attachmentratio = bepaald::toNumber<double>(value);
+    else if (option == "--attachmentsizes" && (ok = (parseList(value, &list) && list.size() == 2)))
+    {
+      params.minattachmentsize = list[0];
+      params.maxattachmentsize = list[1];
+    }
+    else if (option == "--emojidensity")
+      params.emojidensity = bepaald::toNumber<double>(value);
+    else if (option == "--mentiondensity")
+      params.mentiondensity = bepaald::toNumber<double>(value);
+    else if (option == "--seed" && (ok = isNumber(value)))
+      params.seed = params.messageseed = bepaald::toNumber<uint64_t>(value);
+    else if (option == "--generate")
+      generate = value;
+    else if (option == "--scenarios")
+    {
+      std::istringstream iss(value);
+      for (std::string name; std::getline(iss, name, ',');)
+        scenarionames.push_back(name);
+    }
+    else if (option == "--repeat" && (ok = isNumber(value)))
+      repeat = bepaald::toNumber<long long int>(value);
+    else if (option == "--workdir")
+      workdir = value;
+    else if (option == "--output")
+      output = value;
+    else
+      ok = false;
+
+    if (!ok)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Bad option or value: '" << option
+                << (hasvalue ? " " + value : "") << "'" << std::endl;
+      std::cout << "Try '" << argv[0] << " --help' for available options" << std::endl;
+      return 1;
+    }
+    if (option != "--keep" && option != "--verbose")
+      ++i;
+  }
+
+  if (params.messages < 0 || params.threads < 0 || params.threads + static_cast<long long int>(params.groupsizes.size()) == 0 ||
+      repeat < 1)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Need at least one thread, and one run per scenario" << std::endl;
+    return 1;
+  }
+  for (long long int size : params.groupsizes)
+    if (size < 2)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Group size must be at least 2 (self and one other member)" << std::endl;
+      return 1;
+    }
+
+  std::string const passphrase(30, '0');
+
+  if (!generate.empty())
+  {
+    SyntheticBackup synthetic(params);
+    uint64_t frames = 0;
+    if (!synthetic.ok() || !synthetic.writeBackup(generate, passphrase, &frames))
+      return 1;
+    std::cout << "Wrote " << frames << " frames to '" << generate << "'" << std::endl;
+    return 0;
+  }
+
+  std::error_code ec;
+  std::filesystem::create_directories(workdir, ec);
+  if (ec)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to create '" << workdir.string() << "'" << std::endl;
+    return 1;
+  }
+  std::string const input = (workdir / "synthetic.backup").string();
+  std::string const source = (workdir / "synthetic_source.backup").string();
+
+  // the source for importthread: the same people, different messages
+  std::cerr << "Generating synthetic backups..." << std::endl;
+  Timer generatetimer;
+  uint64_t inputframes = 0;
+  uint64_t inputsize = 0;
+  std::string selfphone;
+  {
+    generatetimer.start();
+    SyntheticBackup synthetic(params);
+    bool ok = synthetic.ok() && synthetic.writeBackup(input, passphrase, &inputframes);
+    generatetimer.stop();
+
+    SyntheticBackup::Params sourceparams(params);
+    sourceparams.messageseed = params.messageseed + 1;
+    sourceparams.messages = std::max(params.messages / 4, 1ll);
+    SyntheticBackup sourcesynthetic(sourceparams);
+    if (!ok || !sourcesynthetic.ok() || !sourcesynthetic.writeBackup(source, passphrase))
+      return 1;
+    selfphone = synthetic.selfPhone();
+    inputsize = std::filesystem::file_size(input, ec);
+  }
+
+  auto clean = [&](std::string const &name)
+  {
+    std::filesystem::remove_all(workdir / name, ec);
+    return (workdir / name).string();
+  };
+
+  std::vector<Scenario> const scenarios{
+    {"open", [&](Timer *t)
+    {
+      t->start();
+      SignalBackup sb(input, passphrase, false, false, false);
+      t->stop();
+      return sb.ok();
+    }},
+    {"exportfile", [&](Timer *t)
+    {
+      SignalBackup sb(input, passphrase, false, false, false);
+      std::string const target = clean("export.backup");
+      t->start();
+      bool ok = sb.ok() && sb.exportBackup(target, passphrase, true, SignalBackup::DROPATTACHMENTDATA);
+      t->stop();
+      return ok;
+    }},
+    {"exportdir", [&](Timer *t)
+    {
+      SignalBackup sb(input, passphrase, false, false, false);
+      std::string const target = clean("exportdir") + "/";
+      t->start();
+      bool ok = sb.ok() && sb.exportBackup(target, std::string(), true, SignalBackup::DROPATTACHMENTDATA);
+      t->stop();
+      return ok;
+    }},
+    {"exporthtml", [&](Timer *t)
+    {
+      SignalBackup sb(input, passphrase, false, false, false);
+      std::string const target = clean("html");
+      t->start();
+      bool ok = sb.ok() && sb.exportHtml(target, {}, {}, -1, selfphone, false, true, false, true, false, false, false, false);
+      t->stop();
+      return ok;
+    }},
+    {"dumpmedia", [&](Timer *t)
+    {
+      SignalBackup sb(input, passphrase, false, false, false);
+      std::string const target = clean("media");
+      std::filesystem::create_directory(target, ec);
+      t->start();
+      bool ok = sb.ok() && sb.dumpMedia(target, {}, true, false);
+      t->stop();
+      return ok;
+    }},
+    {"croptothread", [&](Timer *t)
+    {
+      SignalBackup sb(input, passphrase, false, false, false);
+      if (!sb.ok())
+        return false;
+      std::vector<long long int> threads = sb.threadIds();
+      threads.resize(std::min<size_t>(threads.size(), 2)); // the busiest threads
+      t->start();
+      sb.cropToThread(threads);
+      t->stop();
+      return true;
+    }},
+    {"importthread", [&](Timer *t)
+    {
+      SignalBackup sb(input, passphrase, false, false, false);
+      SignalBackup src(source, passphrase, false, false, false);
+      if (!sb.ok() || !src.ok() || src.threadIds().empty())
+        return false;
+      t->start();
+      bool ok = sb.importThread(&src, src.threadIds().front());
+      t->stop();
+      return ok;
+    }},
+    {"mergerecipients", [&](Timer *t)
+    {
+      SignalBackup sb(input, passphrase, false, false, false);
+      if (!sb.ok())
+        return false;
+      t->start();
+      sb.mergeRecipients({SyntheticBackup::phone(1), SyntheticBackup::phone(2)}, false);
+      t->stop();
+      return true;
+    }}
+  };
+
+  for (auto const &name : scenarionames)
+    if (std::find_if(scenarios.begin(), scenarios.end(), [&](Scenario const &s) { return s.name == name; }) == scenarios.end())
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Unknown scenario '" << name << "'" << std::endl;
+      return 1;
+    }
+
+  std::vector<Result> results;
+  for (auto const &scenario : scenarios)
+  {
+    if (!scenarionames.empty() && std::find(scenarionames.begin(), scenarionames.end(), scenario.name) == scenarionames.end())
+      continue;
+
+    Result result;
+    result.name = scenario.name;
+    for (long long int r = 0; r < repeat && result.ok; ++r)
+    {
+      std::cerr << "Running '" << scenario.name << "' (" << r + 1 << "/" << repeat << ")..." << std::endl;
+      Timer timer;
+      {
+        Silence silence(!verbose);
+        result.ok = scenario.run(&timer);
+      }
+      result.runs.push_back(timer.ms());
+    }
+    results.push_back(std::move(result));
+  }
+
+  if (!keep) // only remove what was created here, the directory itself only if that leaves it empty
+  {
+    for (char const *name : {"synthetic.backup", "synthetic_source.backup", "export.backup", "exportdir", "html", "media"})
+      clean(name);
+    std::filesystem::remove(workdir, ec);
+  }
+
+  // report
+  std::ostringstream json;
+  json << std::fixed << std::setprecision(3);
+  json << "{" << std::endl;
+#ifdef VERSIONDATE
+  json << "  \"version\": " << jsonString(VERSIONDATE) << "," << std::endl;
+#endif
+  json << "  \"parameters\": {" << std::endl
+       << "    \"messages\": " << params.messages << "," << std::endl
+       << "    \"threads\": " << params.threads << "," << std::endl
+       << "    \"groupsizes\": [";
+  for (unsigned int i = 0; i < params.groupsizes.size(); ++i)
+    json << (i ? ", " : "") << params.groupsizes[i];
+  json << "]," << std::endl
+       << "    \"attachments\": " << params.attachmentratio << "," << std::endl
+       << "    \"attachmentsizes\": [" << params.minattachmentsize << ", " << params.maxattachmentsize << "]," << std::endl
+       << "    \"emojidensity\": " << params.emojidensity << "," << std::endl
+       << "    \"mentiondensity\": " << params.mentiondensity << "," << std::endl
+       << "    \"seed\": " << params.seed << "," << std::endl
+       << "    \"repeat\": " << repeat << std::endl
+       << "  }," << std::endl
+       << "  \"input\": {" << std::endl
+       << "    \"size\": " << inputsize << "," << std::endl
+       << "    \"frames\": " << inputframes << "," << std::endl
+       << "    \"generate_ms\": " << generatetimer.ms() << std::endl
+       << "  }," << std::endl
+       << "  \"scenarios\": [" << std::endl;
+  for (unsigned int i = 0; i < results.size(); ++i)
+  {
+    std::vector<double> sorted(results[i].runs);
+    std::sort(sorted.begin(), sorted.end());
+    double const mean = sorted.empty() ? 0 : std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    double const median = sorted.empty() ? 0 : (sorted.size() % 2 ? sorted[sorted.size() / 2] :
+                                                 (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) / 2);
+    json << "    {\"name\": " << jsonString(results[i].name) << ", \"ok\": " << std::boolalpha << results[i].ok
+         << ", \"runs_ms\": [";
+    for (unsigned int r = 0; r < results[i].runs.size(); ++r)
+      json << (r ? ", " : "") << results[i].runs[r];
+    json << "], \"min_ms\": " << (sorted.empty() ? 0 : sorted.front()) << ", \"median_ms\": " << median
+         << ", \"mean_ms\": " << mean << "}" << (i < results.size() - 1 ? "," : "") << std::endl;
+  }
+  json << "  ]" << std::endl << "}" << std::endl;
+
+  if (output.empty())
+    std::cout << json.str() << std::flush;
+  else
+  {
+    std::ofstream out(output);
+    if (!(out << json.str()))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to write '" << output << "'" << std::endl;
+      return 1;
+    }
+  }
+
+  return std::all_of(results.begin(), results.end(), [](Result const &r) { return r.ok; }) ? 0 : 1;
+}
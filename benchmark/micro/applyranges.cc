@@ -0,0 +1,50 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+// every message body that has mentions or styles (includes copying body and ranges, applyRanges()
+// changes both)
+void MicroBenchmark::applyRanges()
+{
+  uint64_t bytes = 0;
+  uint64_t count = 0;
+  for (unsigned int i = 0; i < d_bodies.size(); ++i)
+    if (!d_ranges[i].empty())
+    {
+      bytes += d_bodies[i].size();
+      ++count;
+    }
+
+  measure("html/applyranges", count, bytes, [&]()
+  {
+    uint64_t sum = 0;
+    for (unsigned int i = 0; i < d_bodies.size(); ++i)
+    {
+      if (d_ranges[i].empty())
+        continue;
+      std::string body(d_bodies[i]);
+      std::vector<Range> ranges(d_ranges[i]);
+      std::set<int> excluded;
+      d_backup->applyRanges(&body, &ranges, &excluded);
+      sum += body.size() + excluded.size();
+    }
+    return sum;
+  });
+}
@@ -0,0 +1,106 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include <algorithm>
+#include <map>
+
+#include "../../attachmentindex/attachmentindex.h"
+
+// d_options.attachments frames, in an AttachmentIndex and in the std::map<key, frame> it replaced:
+// random lookups of existing keys, and moving every rowid by an offset (as compactIds() and
+// makeIdsUnique() do). Both containers point to the same frames, the index owns them.
+void MicroBenchmark::attachmentIndex()
+{
+  if (!selected("attachmentindex/lookup/map") && !selected("attachmentindex/lookup/index") &&
+      !selected("attachmentindex/rekey/map") && !selected("attachmentindex/rekey/index"))
+    return; // skip the (slow) setup
+
+  std::mt19937_64 rng(d_options.corpus.seed);
+
+  auto varint = [](uint64_t value, std::vector<unsigned char> *out)
+  {
+    for (; value > 0x7f; value >>= 7)
+      out->push_back((value & 0x7f) | 0x80);
+    out->push_back(value);
+  };
+
+  AttachmentIndex index;
+  std::map<AttachmentIndex::key_type, AttachmentFrame *> map;
+  std::vector<AttachmentIndex::key_type> keys;
+  index.reserve(d_options.attachments);
+  keys.reserve(d_options.attachments);
+  for (uint64_t i = 0; i < d_options.attachments; ++i)
+  {
+    // as read from a backup: rowid (field 1), attachmentid (2), length (3)
+    std::vector<unsigned char> data{(1 << 3) | BackupFrame::WIRETYPE::VARINT};
+    varint(i + 1, &data);
+    data.push_back((2 << 3) | BackupFrame::WIRETYPE::VARINT);
+    varint(1672531200000 + i * 60000 + rng() % 60000, &data);
+    data.push_back((3 << 3) | BackupFrame::WIRETYPE::VARINT);
+    varint(4096 + rng() % 4194304, &data);
+
+    AttachmentFrame *frame = new AttachmentFrame(data.data(), data.size(), i);
+    AttachmentIndex::key_type key{frame->rowId(), frame->attachmentId()};
+    index.emplace(key, frame);
+    map.emplace(key, frame);
+    keys.push_back(key);
+  }
+  std::shuffle(keys.begin(), keys.end(), rng);
+
+  measure("attachmentindex/lookup/map", keys.size(), 0, [&]()
+  {
+    uint64_t sum = 0;
+    for (auto const &key : keys)
+      sum += map.find(key)->second->length();
+    return sum;
+  });
+
+  measure("attachmentindex/lookup/index", keys.size(), 0, [&]()
+  {
+    uint64_t sum = 0;
+    for (auto const &key : keys)
+      sum += index.find(key)->second->length();
+    return sum;
+  });
+
+  uint64_t const offset = 1000;
+
+  measure("attachmentindex/rekey/map", map.size(), 0, [&]()
+  {
+    // the best a map can do: move the nodes over, changing their keys on the way
+    std::map<AttachmentIndex::key_type, AttachmentFrame *> rekeyed;
+    while (!map.empty())
+    {
+      auto node = map.extract(map.begin());
+      node.mapped()->setRowId(node.mapped()->rowId() + offset);
+      node.key() = {node.mapped()->rowId(), node.mapped()->attachmentId()};
+      rekeyed.insert(rekeyed.end(), std::move(node));
+    }
+    map.swap(rekeyed);
+    return map.size();
+  });
+
+  measure("attachmentindex/rekey/index", index.size(), 0, [&]()
+  {
+    index.rekey([&](AttachmentFrame *frame) { frame->setRowId(frame->rowId() + offset); });
+    return index.size();
+  });
+}
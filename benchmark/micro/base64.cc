@@ -0,0 +1,73 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include "../../base64/base64.h"
+
+// keys (32 bytes, as in the desktop database and json) and thumbnails (16 KiB, as embedded in
+// HTML exports)
+void MicroBenchmark::base64()
+{
+  std::mt19937_64 rng(d_options.corpus.seed);
+  unsigned int const keys = 1000;
+  std::vector<unsigned char> key(32 * keys);
+  std::vector<unsigned char> thumbnail(16 * 1024);
+  for (unsigned char &c : key)
+    c = rng();
+  for (unsigned char &c : thumbnail)
+    c = rng();
+
+  std::vector<std::string> encodedkeys;
+  for (unsigned int i = 0; i < keys; ++i)
+    encodedkeys.emplace_back(Base64::bytesToBase64String(key.data() + i * 32, 32));
+  std::string const encodedthumbnail = Base64::bytesToBase64String(thumbnail.data(), thumbnail.size());
+
+  measure("base64/encode/key", keys, key.size(), [&]()
+  {
+    uint64_t sum = 0;
+    for (unsigned int i = 0; i < keys; ++i)
+      sum += Base64::bytesToBase64String(key.data() + i * 32, 32).size();
+    return sum;
+  });
+
+  measure("base64/encode/thumbnail", 1, thumbnail.size(), [&]()
+  {
+    return Base64::bytesToBase64String(thumbnail.data(), thumbnail.size()).size();
+  });
+
+  measure("base64/decode/key", keys, key.size(), [&]()
+  {
+    uint64_t sum = 0;
+    for (std::string const &encoded : encodedkeys)
+    {
+      std::pair<unsigned char *, size_t> decoded = Base64::base64StringToBytes(encoded);
+      sum += decoded.second;
+      delete[] decoded.first;
+    }
+    return sum;
+  });
+
+  measure("base64/decode/thumbnail", 1, thumbnail.size(), [&]()
+  {
+    std::pair<unsigned char *, size_t> decoded = Base64::base64StringToBytes(encodedthumbnail);
+    delete[] decoded.first;
+    return decoded.second;
+  });
+}
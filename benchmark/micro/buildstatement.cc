@@ -0,0 +1,40 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+// substitutes the parameters into the statement, every row of the message and part tables
+void MicroBenchmark::buildStatement()
+{
+  uint64_t bytes = 0;
+  for (auto const &statement : d_statements)
+    bytes += statement->statement().size();
+
+  measure("sql/buildstatement", d_statements.size(), bytes, [&]()
+  {
+    uint64_t sum = 0;
+    for (auto const &statement : d_statements)
+    {
+      statement->d_statement.clear();
+      statement->buildStatement();
+      sum += statement->d_statement.size();
+    }
+    return sum;
+  });
+}
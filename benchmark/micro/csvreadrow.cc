@@ -0,0 +1,37 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+// the message table as csv, one readRow() per line
+void MicroBenchmark::csvReadRow()
+{
+  uint64_t bytes = 0;
+  for (std::string const &row : d_csvrows)
+    bytes += row.size();
+
+  measure("csv/readrow", d_csvrows.size(), bytes, [&]()
+  {
+    d_csvreader->d_results.clear();
+    CSVReader::CSVState state = CSVReader::CSVState::UNQUOTEDFIELD;
+    for (std::string const &row : d_csvrows)
+      state = d_csvreader->readRow(row, state);
+    return d_csvreader->d_results.size();
+  });
+}
@@ -0,0 +1,65 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include "../../attachmentframe/attachmentframe.h"
+
+// serializing frames for writing, every row of the message and part tables and an attachment
+// frame for every part
+void MicroBenchmark::frameGetData()
+{
+  std::vector<std::unique_ptr<AttachmentFrame>> attachments;
+  for (auto const &statement : d_statements)
+  {
+    if (!statement->statement().starts_with("INSERT INTO part "))
+      continue;
+    AttachmentFrame *attachment = attachments.emplace_back(new AttachmentFrame).get();
+    uint64_t const n = attachments.size();
+    for (auto const &[field, rawvalue] : {std::pair<char const *, uint64_t>{"ROWID", n},
+                                          {"ATTACHMENTID", 1672531200000 + n * 60000},
+                                          {"LENGTH", 4096 + n * 4099}})
+    {
+      uint64_t const value = bepaald::swap_endian(rawvalue);
+      unsigned char *data = new unsigned char[sizeof(value)];
+      std::memcpy(data, &value, sizeof(value));
+      attachment->setNewData(attachment->getField(field), data, sizeof(value));
+    }
+  }
+
+  auto getData = [](auto const &frames, uint64_t *bytes)
+  {
+    uint64_t sum = 0;
+    for (auto const &frame : frames)
+    {
+      std::pair<unsigned char *, uint64_t> data = frame->getData();
+      sum += data.second;
+      delete[] data.first;
+    }
+    if (bytes)
+      *bytes = sum;
+    return sum;
+  };
+
+  uint64_t bytes = 0;
+  getData(d_statements, &bytes);
+  measure("frame/getdata/statement", d_statements.size(), bytes, [&]() { return getData(d_statements, nullptr); });
+  getData(attachments, &bytes);
+  measure("frame/getdata/attachment", attachments.size(), bytes, [&]() { return getData(attachments, nullptr); });
+}
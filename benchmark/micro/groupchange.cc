@@ -0,0 +1,60 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include "../../groupv2statusmessageproto/groupv2statusmessageproto.h"
+
+// A group change adding 40 members and setting a title (883 bytes), parsed and queried for ten
+// fields, like the group update messages in the HTML export. Large enough that ProtoBufParser
+// indexes its fields on the first lookup.
+void MicroBenchmark::groupChange()
+{
+  std::vector<std::string> uuids;
+  DecryptedGroupChange change;
+  change.addField<2>(7);
+  for (int i = 0; i < 40; ++i)
+  {
+    std::string const &uuid = uuids.emplace_back("member-uuid-" + bepaald::toString(i));
+    DecryptedMember member;
+    member.addField<1>({reinterpret_cast<unsigned char *>(const_cast<char *>(uuid.data())), uuid.size()});
+    member.addField<2>(1);
+    member.addField<5>(i);
+    change.addField<3>(member);
+  }
+  DecryptedString title;
+  title.addField<1>(std::string("title"));
+  change.addField<10>(title);
+  change.addField<13>(1);
+
+  unsigned int const parses = 1000;
+  measure("protobuf/groupchange", parses, parses * change.size(), [&]()
+  {
+    uint64_t sum = 0;
+    for (unsigned int i = 0; i < parses; ++i)
+    {
+      DecryptedGroupChange parsed(change.data(), change.size());
+      sum += parsed.getField<2>().value_or(0) + parsed.getField<13>().value_or(0) + parsed.getField<14>().value_or(0) +
+        parsed.getField<15>().value_or(0) + parsed.getField<21>().value_or(0) +
+        parsed.getField<10>().has_value() + parsed.getField<11>().has_value() + parsed.getField<12>().has_value() +
+        parsed.getField<20>().has_value() + parsed.getField<19>().has_value();
+    }
+    return sum;
+  });
+}
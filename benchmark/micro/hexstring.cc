@@ -0,0 +1,39 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+// keys and ids, the only things printed as hex
+void MicroBenchmark::hexString()
+{
+  std::mt19937_64 rng(d_options.corpus.seed);
+  unsigned int const keys = 1000;
+  std::vector<unsigned char> key(32 * keys);
+  for (unsigned char &c : key)
+    c = rng();
+
+  for (bool unformatted : {false, true})
+    measure(unformatted ? "hex/key/unformatted" : "hex/key", keys, key.size(), [&]()
+    {
+      uint64_t sum = 0;
+      for (unsigned int i = 0; i < keys; ++i)
+        sum += bepaald::bytesToHexString(key.data() + i * 32, 32, unformatted).size();
+      return sum;
+    });
+}
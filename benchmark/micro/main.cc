@@ -0,0 +1,185 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+/*
+  signalbackup-tools-microbenchmark
+
+  Times small, frequently called functions (protobuf parsing, base64, hex, HTML escaping, emoji
+  detection, range application, statement building, frame serialization, csv parsing and the
+  attachment index) on data from a synthetic backup, and prints ns/op and MB/s for each, as a
+  table or as JSON.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../common_be.h"
+#include "microbenchmark.h"
+
+namespace
+{
+  bool isNumber(std::string const &s)
+  {
+    return !s.empty() && std::all_of(s.begin(), s.end(), [](unsigned char c) { return std::isdigit(c); });
+  }
+
+  bool parseList(std::string const &list, std::vector<long long int> *values)
+  {
+    values->clear();
+    std::istringstream iss(list);
+    std::string item;
+    while (std::getline(iss, item, ','))
+    {
+      if (!isNumber(item))
+        return false;
+      values->push_back(bepaald::toNumber<long long int>(item));
+    }
+    return true;
+  }
+
+  void usage(char const *prog)
+  {
+    std::cout << "Usage: " << prog << " [OPTIONS]" << std::endl
+              << std::endl
+              << "Corpus (a synthetic backup, see signalbackup-tools-benchmark):" << std::endl
+              << "  --messages N               Number of messages (default 10000)" << std::endl
+              << "  --threads N                Number of one-to-one threads (default 20)" << std::endl
+              << "  --groupsizes N[,N...]      Create a group of each size (>= 2) (default 5,25,100)" << std::endl
+              << "  --emojidensity F           Chance of a word being an emoji (default 0.05)" << std::endl
+              << "  --mentiondensity F         Chance of a group message containing a mention (default 0.1)" << std::endl
+              << "  --seed N                   Seed for all generated data (default 1)" << std::endl
+              << "  --attachments N            Number of entries for the attachmentindex benchmarks (default 1000000)" << std::endl
+              << std::endl
+              << "Benchmark:" << std::endl
+              << "  --benchmarks NAME[,NAME..] Only run benchmarks whose name starts with one of these (default: all)" << std::endl
+              << "  --list                     List the available benchmarks and exit" << std::endl
+              << "  --mintime MS               Repeat every benchmark for at least this long (default 500)" << std::endl
+              << "  --workdir DIR              Directory for temporary files (default: system temp directory)" << std::endl
+              << "  --json                     Print results as JSON instead of a table" << std::endl
+              << "  --output FILE              Write results to FILE instead of stdout" << std::endl;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  MicroBenchmark::Options options;
+  std::string output;
+  bool json = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string const option(argv[i]);
+    bool const hasvalue = i + 1 < argc;
+    std::string const value(hasvalue ? argv[i + 1] : "");
+    std::vector<long long int> list;
+    bool ok = true;
+
+    if (option == "-h" || option == "--help")
+    {
+      usage(argv[0]);
+      return 0;
+    }
+    else if (option == "--list")
+    {
+      for (std::string const &name : MicroBenchmark::names())
+        std::cout << name << std::endl;
+      return 0;
+    }
+    else if (option == "--json")
+      json = true;
+    else if (!hasvalue)
+      ok = false;
+    else if (option == "--messages" && (ok = isNumber(value)))
+      options.corpus.messages = bepaald::toNumber<long long int>(value);
+    else if (option == "--threads" && (ok = isNumber(value)))
+      options.corpus.threads = bepaald::toNumber<long long int>(value);
+    else if (option == "--groupsizes" && (ok = parseList(value, &list)))
+      options.corpus.groupsizes = list;
+    else if (option == "--emojidensity")
+      options.corpus.emojidensity = bepaald::toNumber<double>(value);
+    else if (option == "--mentiondensity")
+      options.corpus.mentiondensity = bepaald::toNumber<double>(value);
+    else if (option == "--seed" && (ok = isNumber(value)))
+      options.corpus.seed = options.corpus.messageseed = bepaald::toNumber<uint64_t>(value);
+    else if (option == "--attachments" && (ok = isNumber(value)))
+      options.attachments = bepaald::toNumber<uint64_t>(value);
+    else if (option == "--benchmarks")
+    {
+      std::istringstream iss(value);
+      for (std::string name; std::getline(iss, name, ',');)
+        options.filters.push_back(name);
+    }
+    else if (option == "--mintime" && (ok = isNumber(value)))
+      options.mintime = bepaald::toNumber<double>(value);
+    else if (option == "--workdir")
+      options.workdir = value;
+    else if (option == "--output")
+      output = value;
+    else
+      ok = false;
+
+    if (!ok)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Bad option or value: '" << option
+                << (hasvalue ? " " + value : "") << "'" << std::endl;
+      std::cout << "Try '" << argv[0] << " --help' for available options" << std::endl;
+      return 1;
+    }
+    if (option != "--json")
+      ++i;
+  }
+
+  if (options.corpus.messages < 1 || options.corpus.threads + static_cast<long long int>(options.corpus.groupsizes.size()) == 0)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Need at least one message and one thread" << std::endl;
+    return 1;
+  }
+  for (long long int size : options.corpus.groupsizes)
+    if (size < 2)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Group size must be at least 2 (self and one other member)" << std::endl;
+      return 1;
+    }
+
+  MicroBenchmark benchmark(options);
+  if (!benchmark.ok())
+    return 1;
+  benchmark.run();
+
+  std::ofstream file;
+  if (!output.empty())
+  {
+    file.open(output);
+    if (!file.is_open())
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to open '" << output << "' for writing" << std::endl;
+      return 1;
+    }
+  }
+  std::ostream &out = output.empty() ? std::cout : file;
+  if (json)
+    benchmark.printJson(out);
+  else
+    benchmark.printResults(out);
+  return 0;
+}
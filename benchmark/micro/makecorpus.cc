@@ -0,0 +1,140 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include <sstream>
+
+#include "../../messagerangeproto/messagerangeproto.h"
+
+// Collects the inputs for the benchmarks from the synthetic database: message bodies with the
+// ranges the HTML export would apply to them, the message and part tables as SqlStatementFrames
+// (the same way they are exported) and the message table as CSV. The bodies contain no styling,
+// so some words are given a style here.
+bool MicroBenchmark::makeCorpus(SyntheticBackup const &synthetic)
+{
+  SqliteDB const &db = synthetic.database();
+
+  SqliteDB::QueryResults bodies;
+  if (!db.exec("SELECT message.body, mention.range_start, mention.range_length, recipient.profile_joined_name "
+               "FROM message "
+               "LEFT JOIN mention ON mention.message_id = message._id "
+               "LEFT JOIN recipient ON recipient._id = mention.recipient_id "
+               "WHERE message.body IS NOT NULL ORDER BY message._id", &bodies))
+    return false;
+
+  std::mt19937_64 rng(d_options.corpus.messageseed);
+  for (unsigned int i = 0; i < bodies.rows(); ++i)
+  {
+    std::string const &body = d_bodies.emplace_back(bodies.valueAsString(i, "body"));
+    std::vector<Range> &ranges = d_ranges.emplace_back();
+    BodyRanges bodyranges;
+
+    if (bodies.valueHasType<long long int>(i, "range_start"))
+      ranges.emplace_back(Range{bodies.getValueAs<long long int>(i, "range_start"), bodies.getValueAs<long long int>(i, "range_length"),
+                                "<span class=\"mention-in\">", "@" + bodies.valueAsString(i, "profile_joined_name"), "</span>", true});
+
+    // style roughly one in eight words (positions and lengths in UTF-16 code units)
+    long long int utf16pos = 0;
+    long long int wordstart = 0;
+    for (unsigned int c = 0; c <= body.size(); ++c)
+    {
+      if (c == body.size() || body[c] == ' ')
+      {
+        if (utf16pos > wordstart && rng() % 8 == 0)
+        {
+          int const style = rng() % 5;
+          static char const *const tags[5][2] = {{"<b>", "</b>"}, {"<i>", "</i>"}, {"<span class=\"spoiler\">", "</span>"},
+                                                 {"<s>", "</s>"}, {"<span class=\"monospace\">", "</span>"}};
+          ranges.emplace_back(Range{wordstart, utf16pos - wordstart, tags[style][0], "", tags[style][1], style == 2});
+
+          BodyRange bodyrange;
+          bodyrange.addField<1>(wordstart);
+          bodyrange.addField<2>(utf16pos - wordstart);
+          bodyrange.addField<4>(style);
+          bodyranges.addField<1>(bodyrange);
+        }
+        wordstart = utf16pos + 1;
+      }
+      if (c < body.size() && (static_cast<unsigned char>(body[c]) & 0xc0) != 0x80)
+        utf16pos += (static_cast<unsigned char>(body[c]) >= 0xf0) ? 2 : 1;
+    }
+
+    if (bodyranges.size())
+      d_bodyranges.emplace_back(reinterpret_cast<char *>(bodyranges.data()), bodyranges.size());
+  }
+
+  for (char const *table : {"message", "part"})
+  {
+    SqliteDB::QueryResults results;
+    if (!db.exec(std::string("SELECT * FROM ") + table, &results))
+      return false;
+
+    for (unsigned int i = 0; i < results.rows(); ++i)
+    {
+      std::unique_ptr<SqlStatementFrame> &statement = d_statements.emplace_back(new SqlStatementFrame);
+      std::string query = std::string("INSERT INTO ") + table + " VALUES (";
+      for (unsigned int c = 0; c < results.columns(); ++c)
+      {
+        query += (c < results.columns() - 1) ? "?," : "?)";
+        std::any const &value = results.value(i, c);
+        if (value.type() == typeid(long long int))
+          statement->addIntParameter(std::any_cast<long long int>(value));
+        else if (value.type() == typeid(std::string))
+          statement->addStringParameter(std::any_cast<std::string>(value));
+        else if (value.type() == typeid(std::pair<std::shared_ptr<unsigned char []>, size_t>))
+          statement->addBlobParameter(std::any_cast<std::pair<std::shared_ptr<unsigned char []>, size_t>>(value));
+        else if (value.type() == typeid(double))
+          statement->addDoubleParameter(std::any_cast<double>(value));
+        else
+          statement->addNullParameter();
+      }
+      statement->setStatementField(query);
+    }
+
+    if (std::strcmp(table, "message") != 0)
+      continue;
+
+    // as exportCsv() would write it, quoting only where needed
+    auto csvfield = [](std::string const &field)
+    {
+      if (field.find_first_of(",\"\n") == std::string::npos)
+        return field;
+      std::string quoted("\"");
+      for (char c : field)
+        quoted += (c == '"') ? "\"\"" : std::string(1, c);
+      return quoted + "\"";
+    };
+    std::string csv;
+    for (unsigned int c = 0; c < results.columns(); ++c)
+      csv += (c ? "," : "") + csvfield(results.header(c));
+    csv += '\n';
+    for (unsigned int i = 0; i < results.rows(); ++i)
+    {
+      for (unsigned int c = 0; c < results.columns(); ++c)
+        csv += (c ? "," : "") + (results.isNull(i, c) ? std::string() : csvfield(results.valueAsString(i, c)));
+      csv += '\n';
+    }
+    std::istringstream lines(csv);
+    for (std::string line; std::getline(lines, line);)
+      d_csvrows.emplace_back(std::move(line));
+  }
+
+  return !d_bodies.empty() && !d_statements.empty();
+}
@@ -0,0 +1,39 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+MicroBenchmark::MicroBenchmark(Options const &options)
+  :
+  d_options(options),
+  d_sink(0),
+  d_ok(false)
+{
+  if (d_options.workdir.empty())
+    d_options.workdir = std::filesystem::temp_directory_path().string();
+
+  SyntheticBackup synthetic(d_options.corpus);
+  if (!synthetic.ok())
+    return;
+
+  d_ok = makeCorpus(synthetic) && openBackup() && openCsv();
+}
+
+// defined here, where SignalBackup, SqlStatementFrame and CSVReader are complete types
+MicroBenchmark::~MicroBenchmark() = default;
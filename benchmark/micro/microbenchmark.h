@@ -0,0 +1,157 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef MICROBENCHMARK_H_
+#define MICROBENCHMARK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "../../signalbackup/msgrange.h"
+#include "../syntheticbackup/syntheticbackup.h"
+
+class SignalBackup;
+class SqlStatementFrame;
+class CSVReader;
+
+// Times small, hot functions in isolation (ns/op and bytes/s), on data taken from a synthetic
+// backup (see ../syntheticbackup/syntheticbackup.h) instead of on hand written strings. This class
+// is a friend of SignalBackup, SqlStatementFrame and CSVReader, so private helpers can be timed
+// directly instead of through the (much larger) public functions that call them.
+class MicroBenchmark
+{
+ public:
+  struct Options
+  {
+    SyntheticBackup::Params corpus;     // the data most benchmarks run on
+    uint64_t attachments = 1000000;     // size of the attachment index for the attachmentindex/ benchmarks
+    double mintime = 500;               // ms, every benchmark is repeated until it has run at least this long
+    std::vector<std::string> filters;   // only run benchmarks whose name starts with one of these (empty: all)
+    std::string workdir;                // for temporary files
+  };
+
+  struct Result
+  {
+    std::string name;
+    uint64_t ops;
+    uint64_t bytes;                     // 0 if bytes/s is not meaningful for this benchmark
+    double ns;
+  };
+
+ private:
+  Options d_options;
+  std::unique_ptr<SignalBackup> d_backup;                       // a (small) opened backup, for the HTML helpers
+  std::unique_ptr<CSVReader> d_csvreader;
+  std::vector<std::string> d_bodies;                            // all message bodies
+  std::vector<std::vector<Range>> d_ranges;                     // mentions and styles, as HTMLprepMsgBody creates them
+  std::vector<std::string> d_bodyranges;                        // the styles, as serialized BodyRangeList
+  std::vector<std::unique_ptr<SqlStatementFrame>> d_statements; // the message and part tables, as they are exported
+  std::vector<std::string> d_csvrows;                           // the message table, as csv
+  std::vector<Result> d_results;
+  uint64_t d_sink;                                              // keeps the compiler from dropping unused results
+  bool d_ok;
+
+  static std::vector<std::string> const s_names;
+
+ public:
+  explicit MicroBenchmark(Options const &options);
+  MicroBenchmark(MicroBenchmark const &other) = delete;
+  MicroBenchmark &operator=(MicroBenchmark const &other) = delete;
+  ~MicroBenchmark();
+  inline bool ok() const;
+  inline static std::vector<std::string> const &names();
+  void run();
+  inline std::vector<Result> const &results() const;
+  void printResults(std::ostream &out) const;
+  void printJson(std::ostream &out) const;
+
+ private:
+  bool makeCorpus(SyntheticBackup const &synthetic);
+  bool openBackup();
+  bool openCsv();
+  inline bool selected(std::string const &name) const;
+  template <typename F>
+  inline void measure(std::string const &name, uint64_t opsperrun, uint64_t bytesperrun, F run);
+
+  void protoBufFields();
+  void groupChange();
+  void base64();
+  void hexString();
+  void htmlEscapeString();
+  void htmlGetEmojiPos();
+  void applyRanges();
+  void buildStatement();
+  void frameGetData();
+  void csvReadRow();
+  void attachmentIndex();
+};
+
+inline bool MicroBenchmark::ok() const
+{
+  return d_ok;
+}
+
+inline std::vector<std::string> const &MicroBenchmark::names() // static
+{
+  return s_names;
+}
+
+inline std::vector<MicroBenchmark::Result> const &MicroBenchmark::results() const
+{
+  return d_results;
+}
+
+inline bool MicroBenchmark::selected(std::string const &name) const
+{
+  if (d_options.filters.empty())
+    return true;
+  for (std::string const &filter : d_options.filters)
+    if (name.starts_with(filter))
+      return true;
+  return false;
+}
+
+// run() is called once untimed (warm up), then repeatedly until d_options.mintime has passed.
+// It returns something derived from its work, which is summed into d_sink.
+template <typename F>
+inline void MicroBenchmark::measure(std::string const &name, uint64_t opsperrun, uint64_t bytesperrun, F run)
+{
+  if (!selected(name) || opsperrun == 0)
+    return;
+
+  d_sink += run();
+
+  uint64_t runs = 0;
+  double ns = 0;
+  do
+  {
+    auto start = std::chrono::steady_clock::now();
+    d_sink += run();
+    ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    ++runs;
+  } while (ns < d_options.mintime * 1e6);
+
+  d_results.emplace_back(Result{name, runs * opsperrun, runs * bytesperrun, ns});
+}
+
+#endif
@@ -0,0 +1,52 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+// The HTML helpers are (const) members of SignalBackup, so they need an opened backup to be
+// called on. They do not use its contents, a small one will do.
+bool MicroBenchmark::openBackup()
+{
+  SyntheticBackup::Params params(d_options.corpus);
+  params.messages = 100;
+  params.threads = 2;
+  params.groupsizes.clear();
+  params.attachmentratio = 0;
+
+  std::string const filename = (std::filesystem::path(d_options.workdir) / "signalbackup-tools-microbenchmark.backup").string();
+  std::string const passphrase(30, '0');
+
+  SyntheticBackup synthetic(params);
+  if (!synthetic.ok() || !synthetic.writeBackup(filename, passphrase))
+    return false;
+
+  std::streambuf *coutbuf = std::cout.rdbuf(nullptr); // silence, restoring rdbuf() below also clears the badbit
+  d_backup.reset(new SignalBackup(filename, passphrase, false, false, false));
+  std::cout.rdbuf(coutbuf);
+
+  std::error_code ec;
+  std::filesystem::remove(filename, ec);
+
+  if (!d_backup->ok())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to open synthetic backup" << std::endl;
+    return false;
+  }
+  return true;
+}
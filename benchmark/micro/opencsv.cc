@@ -0,0 +1,51 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+// CSVReader only reads from a file, write the corpus to one so there is a reader to call
+// readRow() on.
+bool MicroBenchmark::openCsv()
+{
+  std::string const filename = (std::filesystem::path(d_options.workdir) / "signalbackup-tools-microbenchmark.csv").string();
+  {
+    std::ofstream out(filename, std::ios_base::binary);
+    for (std::string const &row : d_csvrows)
+      out << row << '\n';
+    if (!out.good())
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to write '" << filename << "'" << std::endl;
+      return false;
+    }
+  }
+
+  std::streambuf *coutbuf = std::cout.rdbuf(nullptr); // read() prints every row
+  d_csvreader.reset(new CSVReader(filename));
+  std::cout.rdbuf(coutbuf);
+
+  std::error_code ec;
+  std::filesystem::remove(filename, ec);
+
+  if (!d_csvreader->ok())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to read csv corpus" << std::endl;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include <iomanip>
+
+#if __has_include("../../autoversion.h")
+#include "../../autoversion.h"
+#endif
+
+void MicroBenchmark::printJson(std::ostream &out) const
+{
+  std::ios_base::fmtflags const flags = out.flags();
+  std::streamsize const precision = out.precision();
+
+  SyntheticBackup::Params const &p = d_options.corpus;
+  out << "{" << std::endl
+#ifdef VERSIONDATE
+      << "  \"version\": \"" << VERSIONDATE << "\"," << std::endl
+#endif
+      << "  \"parameters\": {\"messages\": " << p.messages << ", \"threads\": " << p.threads
+      << ", \"groups\": " << p.groupsizes.size() << ", \"emojidensity\": " << p.emojidensity
+      << ", \"mentiondensity\": " << p.mentiondensity << ", \"seed\": " << p.seed
+      << ", \"attachments\": " << d_options.attachments << ", \"mintime_ms\": " << d_options.mintime << "}," << std::endl
+      << "  \"benchmarks\": [";
+  for (unsigned int i = 0; i < d_results.size(); ++i)
+  {
+    Result const &r = d_results[i];
+    out << (i ? "," : "") << std::endl
+        << "    {\"name\": \"" << r.name << "\", \"ops\": " << r.ops << ", \"bytes\": " << r.bytes
+        << std::fixed << std::setprecision(3) << ", \"ns_per_op\": " << r.ns / r.ops
+        << ", \"bytes_per_second\": " << (r.bytes ? r.bytes / r.ns * 1e9 : 0) << "}";
+  }
+  out << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+  out.flags(flags);
+  out.precision(precision);
+}
@@ -0,0 +1,44 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include <iomanip>
+
+void MicroBenchmark::printResults(std::ostream &out) const
+{
+  std::ios_base::fmtflags const flags = out.flags();
+  std::streamsize const precision = out.precision();
+
+  out << std::left << std::setw(32) << "benchmark" << std::right << std::setw(14) << "ops" << std::setw(14) << "ns/op"
+      << std::setw(14) << "MB/s" << std::endl;
+  for (Result const &r : d_results)
+  {
+    out << std::left << std::setw(32) << r.name << std::right << std::setw(14) << r.ops
+        << std::fixed << std::setprecision(1) << std::setw(14) << r.ns / r.ops;
+    if (r.bytes)
+      out << std::setw(14) << r.bytes / r.ns * 1e3; // bytes/ns * 1e9 / 1e6
+    else
+      out << std::setw(14) << "-";
+    out << std::endl;
+  }
+
+  out.flags(flags);
+  out.precision(precision);
+}
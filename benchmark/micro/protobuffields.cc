@@ -0,0 +1,44 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "microbenchmark.ih"
+
+#include "../../messagerangeproto/messagerangeproto.h"
+
+// parse every message's BodyRangeList and read all fields of all ranges, like HTMLprepMsgBody
+void MicroBenchmark::protoBufFields()
+{
+  uint64_t bytes = 0;
+  for (std::string const &data : d_bodyranges)
+    bytes += data.size();
+
+  measure("protobuf/bodyranges", d_bodyranges.size(), bytes, [&]()
+  {
+    uint64_t sum = 0;
+    for (std::string const &data : d_bodyranges)
+    {
+      BodyRanges bodyranges(reinterpret_cast<unsigned char *>(const_cast<char *>(data.data())), data.size());
+      for (auto const &bodyrange : bodyranges.getField<1>())
+        sum += bodyrange.getField<1>().value_or(0) + bodyrange.getField<2>().value_or(0) +
+          bodyrange.getField<3>().value_or(std::string()).size() + bodyrange.getField<4>().value_or(-1) +
+          bodyrange.getField<5>().value_or(std::string()).size();
+    }
+    return sum;
+  });
+}
@@ -0,0 +1,124 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+bool SyntheticBackup::addMessages()
+{
+  Random rng(~d_params.messageseed);
+
+  long long int date = s_firstdate;
+  for (long long int i = 0; i < d_params.messages; ++i)
+  {
+    date += 1000 + rng.below(600000);
+
+    // conversations are not equally busy: skew towards the first threads
+    Thread const &thread = d_threads[rng.below(rng.below(d_threads.size()) + 1)];
+    bool const outgoing = rng.below(3) == 0;
+    long long int const sender = outgoing ? d_selfid : thread.members[rng.below(thread.members.size())];
+    bool const hasattachment = rng.chance(d_params.attachmentratio);
+    bool const mention = thread.isgroup && rng.chance(d_params.mentiondensity);
+    long long int const mentioned = mention ? thread.members[rng.below(thread.members.size())] : -1;
+    long long int mentionstart = -1;
+    std::string const text = (hasattachment && rng.below(2) == 0) ? std::string() : body(&rng, mention, &mentionstart);
+    long long int const date_received = outgoing ? date : date + static_cast<long long int>(rng.below(5000));
+
+    long long int mid = -1;
+    if (!insertRow("message",
+                   {{"date_sent", date},
+                    {"date_received", date_received},
+                    {"date_server", outgoing ? -1 : date + 100},
+                    {"thread_id", thread.id},
+                    {"from_recipient_id", sender},
+                    {"from_device_id", 1},
+                    {"to_recipient_id", outgoing ? thread.recipient : d_selfid},
+                    {"type", static_cast<long long int>((outgoing ? Types::BASE_SENT_TYPE : Types::BASE_INBOX_TYPE) |
+                                                        Types::SECURE_MESSAGE_BIT | Types::PUSH_MESSAGE_BIT)},
+                    {"body", text.empty() ? std::any(nullptr) : std::any(text)},
+                    {"read", 1},
+                    {"m_type", outgoing ? 128 : 132},
+                    {"receipt_timestamp", outgoing ? date + 2000 : -1},
+                    {"delivery_receipt_count", outgoing ? 1 : 0},
+                    {"read_receipt_count", outgoing ? 1 : 0},
+                    {"unidentified", 1},
+                    {"mentions_self", mentioned == d_selfid ? 1 : 0},
+                    {"notified", 1},
+                    {"server_guid", uuid(&rng)}}, &mid))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to insert message" << std::endl;
+      return false;
+    }
+
+    if (mentionstart >= 0 &&
+        !insertRow("mention",
+                   {{"thread_id", thread.id},
+                    {"message_id", mid},
+                    {"recipient_id", mentioned},
+                    {"range_start", mentionstart},
+                    {"range_length", 1}}))
+      return false;
+
+    if (hasattachment)
+    {
+      MimeType const &mimetype = s_mimetypes[rng.below(rng.below(s_mimetypes.size()) + 1)];
+      bool const isvisual = mimetype.type.starts_with("image/") || mimetype.type.starts_with("video/");
+      long long int const size = attachmentSize(&rng);
+      if (!insertRow("part",
+                     {{"mid", mid},
+                      {"seq", 0},
+                      {"ct", mimetype.type},
+                      {"pending_push", 0},
+                      {"_data", "/data/user/0/org.thoughtcrime.securesms/app_parts/part" + bepaald::toString(rng() >> 1) + ".mms"},
+                      {"data_size", size},
+                      {"file_name", mimetype.type.starts_with("application/") ?
+                       std::any("document " + bepaald::toString(i) + "." + mimetype.extension) : std::any(nullptr)},
+                      {"unique_id", date_received},
+                      {"voice_note", mimetype.type.starts_with("audio/") ? 1 : 0},
+                      {"width", isvisual ? 1600 : 0},
+                      {"height", isvisual ? 1200 : 0},
+                      {"upload_timestamp", date},
+                      {"cdn_number", 2}}))
+        return false;
+    }
+
+    if (rng.chance(d_params.emojidensity))
+    {
+      unsigned int const count = 1 + rng.below(std::min<uint64_t>(3, thread.members.size()));
+      for (unsigned int r = 0; r < count; ++r)
+      {
+        long long int const author = (r == 0 && !outgoing) ? d_selfid : thread.members[rng.below(thread.members.size())];
+        long long int const reactiondate = date_received + static_cast<long long int>(rng.below(3600000));
+        if (!insertRow("reaction",
+                       {{"message_id", mid},
+                        {"author_id", author},
+                        {"emoji", s_reactions[rng.below(s_reactions.size())]},
+                        {"date_sent", reactiondate},
+                        {"date_received", reactiondate}}))
+          return false;
+      }
+    }
+  }
+
+  return d_database.exec("UPDATE thread SET "
+                         "date = (SELECT IFNULL(MAX(date_received), 0) FROM message WHERE thread_id = thread._id), "
+                         "meaningful_messages = (SELECT COUNT(*) FROM message WHERE thread_id = thread._id), "
+                         "snippet = (SELECT body FROM message WHERE thread_id = thread._id ORDER BY date_received DESC LIMIT 1), "
+                         "snippet_type = (SELECT IFNULL(MAX(type), 0) FROM (SELECT type FROM message WHERE thread_id = thread._id ORDER BY date_received DESC LIMIT 1)), "
+                         "has_sent = (SELECT COUNT(*) > 0 FROM message WHERE thread_id = thread._id AND from_recipient_id = ?), "
+                         "last_seen = date", d_selfid);
+}
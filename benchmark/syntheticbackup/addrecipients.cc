@@ -0,0 +1,145 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+#include "../../base64/base64.h"
+
+bool SyntheticBackup::addRecipients()
+{
+  Random rng(d_params.seed);
+
+  auto randomBase64 = [&rng](unsigned int size)
+  {
+    std::unique_ptr<unsigned char[]> bytes(new unsigned char[size]);
+    for (unsigned int i = 0; i < size; ++i)
+      bytes[i] = static_cast<unsigned char>(rng());
+    return Base64::bytesToBase64String(bytes.get(), size);
+  };
+  auto avatarColor = [&rng]()
+  {
+    return "A" + bepaald::toString(100 + rng.below(21) * 10);
+  };
+
+  long long int maxgroupsize = 1;
+  for (long long int size : d_params.groupsizes)
+    maxgroupsize = std::max(maxgroupsize, size);
+  long long int const contactcount = std::max(d_params.threads, maxgroupsize - 1);
+
+  // self, then the contacts. About a third of contacts has a name in the system address book.
+  for (long long int i = 0; i <= contactcount; ++i)
+  {
+    std::string const &firstname = s_firstnames[rng.below(s_firstnames.size())];
+    std::string const &lastname = s_lastnames[rng.below(s_lastnames.size())];
+    bool const systemcontact = i != 0 && rng.below(3) == 0;
+    long long int rid = -1;
+    if (!insertRow("recipient",
+                   {{"type", 0},
+                    {"e164", phone(i)},
+                    {"aci", uuid(&rng)},
+                    {"pni", uuid(&rng)},
+                    {"registered", 1},
+                    {"profile_key", randomBase64(32)},
+                    {"profile_sharing", 1},
+                    {"profile_given_name", firstname},
+                    {"profile_family_name", lastname},
+                    {"profile_joined_name", firstname + " " + lastname},
+                    {"system_given_name", systemcontact ? std::any(firstname) : std::any(nullptr)},
+                    {"system_family_name", systemcontact ? std::any(lastname) : std::any(nullptr)},
+                    {"system_joined_name", systemcontact ? std::any(firstname + " " + lastname) : std::any(nullptr)},
+                    {"storage_service_id", randomBase64(16)},
+                    {"avatar_color", avatarColor()}}, &rid) ||
+        !insertRow("identities",
+                   {{"address", rid},
+                    {"identity_key", randomBase64(33)},
+                    {"first_use", i == 0 ? 1 : 0},
+                    {"timestamp", s_firstdate - static_cast<long long int>(rng.below(31536000000))},
+                    {"nonblocking_approval", 1}}))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to insert recipient" << std::endl;
+      return false;
+    }
+    if (i == 0)
+      d_selfid = rid;
+    else
+      d_contacts.push_back(rid);
+  }
+
+  // one-to-one threads with the first contacts
+  for (long long int i = 0; i < d_params.threads; ++i)
+  {
+    long long int tid = -1;
+    if (!insertRow("thread", {{"recipient_id", d_contacts[i]}, {"active", 1}}, &tid))
+      return false;
+    d_threads.push_back({tid, d_contacts[i], false, {d_contacts[i]}});
+  }
+
+  // groups, with members drawn from all contacts
+  for (unsigned int g = 0; g < d_params.groupsizes.size(); ++g)
+  {
+    std::vector<long long int> pool(d_contacts);
+    std::vector<long long int> members;
+    for (long long int m = 1; m < d_params.groupsizes[g] && !pool.empty(); ++m)
+    {
+      std::swap(pool[rng.below(pool.size())], pool.back());
+      members.push_back(pool.back());
+      pool.pop_back();
+    }
+
+    std::unique_ptr<unsigned char[]> groupid(new unsigned char[32]);
+    std::pair<std::shared_ptr<unsigned char []>, size_t> masterkey{new unsigned char[32], 32};
+    for (unsigned int i = 0; i < 32; ++i)
+    {
+      groupid[i] = static_cast<unsigned char>(rng());
+      masterkey.first[i] = static_cast<unsigned char>(rng());
+    }
+    std::string const group_id = "__signal_group__v2__!" + bepaald::bytesToHexString(groupid.get(), 32, true);
+
+    long long int rid = -1;
+    long long int tid = -1;
+    if (!insertRow("recipient",
+                   {{"type", 3},
+                    {"group_id", group_id},
+                    {"registered", 1},
+                    {"profile_sharing", 1},
+                    {"storage_service_id", randomBase64(16)},
+                    {"avatar_color", avatarColor()}}, &rid) ||
+        !insertRow("groups",
+                   {{"group_id", group_id},
+                    {"recipient_id", rid},
+                    {"title", "Group " + bepaald::toString(g + 1) + " (" + bepaald::toString(members.size() + 1) + " members) 🎉"},
+                    {"avatar_id", 0},
+                    {"timestamp", s_firstdate},
+                    {"active", 1},
+                    {"master_key", masterkey},
+                    {"revision", 0},
+                    {"distribution_id", uuid(&rng)}}) ||
+        !insertRow("group_membership", {{"group_id", group_id}, {"recipient_id", d_selfid}}) ||
+        !insertRow("thread", {{"recipient_id", rid}, {"active", 1}}, &tid))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to insert group" << std::endl;
+      return false;
+    }
+    for (long long int member : members)
+      if (!insertRow("group_membership", {{"group_id", group_id}, {"recipient_id", member}}))
+        return false;
+    d_threads.push_back({tid, rid, true, std::move(members)});
+  }
+
+  return true;
+}
@@ -0,0 +1,42 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+// Attachment contents are not stored, but regenerated from the row id when writing
+std::pair<unsigned char *, uint64_t> SyntheticBackup::attachmentData(long long int rowid, std::string const &mimetype,
+                                                                     uint64_t size) const
+{
+  Random rng(d_params.messageseed ^ (static_cast<uint64_t>(rowid) * 0xd1342543de82ef95));
+  unsigned char *data = new unsigned char[size];
+  for (uint64_t i = 0; i < size; i += 8)
+  {
+    uint64_t const r = rng();
+    for (uint64_t j = 0; j < 8 && i + j < size; ++j)
+      data[i + j] = static_cast<unsigned char>(r >> (j * 8));
+  }
+
+  for (auto const &m : s_mimetypes)
+    if (m.type == mimetype)
+    {
+      std::memcpy(data, m.magic.data(), std::min<uint64_t>(m.magic.size(), size));
+      break;
+    }
+
+  return {data, size};
+}
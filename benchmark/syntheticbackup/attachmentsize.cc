@@ -0,0 +1,32 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+// Picks a power-of-two bucket in [min, max] uniformly, then a size uniformly within the bucket,
+// which is roughly log-uniform: many small attachments, some very large ones.
+uint64_t SyntheticBackup::attachmentSize(Random *rng) const
+{
+  unsigned int doublings = 0;
+  while (doublings < 62 && (d_params.minattachmentsize << (doublings + 1)) <= d_params.maxattachmentsize)
+    ++doublings;
+
+  uint64_t const low = d_params.minattachmentsize << rng->below(doublings + 1);
+  uint64_t const high = std::min(low * 2, d_params.maxattachmentsize + 1);
+  return low + rng->below(high - low);
+}
@@ -0,0 +1,53 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+// Returns 1-20 words, each replaced by an emoji with chance emojidensity. When `mention' is set, a
+// mention placeholder is put in front of one of the words and its position in UTF-16 code units
+// (as used by the mention table) is stored in *mentionstart.
+std::string SyntheticBackup::body(Random *rng, bool mention, long long int *mentionstart) const
+{
+  unsigned int const words = 1 + rng->below(20);
+  unsigned int const mentionpos = mention ? rng->below(words) : words;
+
+  std::string result;
+  long long int utf16length = 0;
+  for (unsigned int w = 0; w < words; ++w)
+  {
+    if (w)
+    {
+      result += ' ';
+      ++utf16length;
+    }
+
+    if (w == mentionpos)
+    {
+      *mentionstart = utf16length;
+      result += "\xef\xbf\xbc "; // U+FFFC OBJECT REPLACEMENT CHARACTER
+      utf16length += 2;
+    }
+
+    std::string const &word = rng->chance(d_params.emojidensity) ? s_emoji[rng->below(s_emoji.size())] : s_words[rng->below(s_words.size())];
+    result += word;
+    for (unsigned char c : word)
+      if ((c & 0xc0) != 0x80) // count code points, those outside the BMP take two code units
+        utf16length += (c >= 0xf0) ? 2 : 1;
+  }
+  return result;
+}
@@ -0,0 +1,30 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+bool SyntheticBackup::createSchema()
+{
+  for (auto const &statement : s_schema)
+    if (!d_database.exec(statement))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to create schema ('" << statement << "')" << std::endl;
+      return false;
+    }
+  return true;
+}
@@ -0,0 +1,40 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+bool SyntheticBackup::insertRow(std::string const &table, std::vector<std::pair<std::string, std::any>> const &data,
+                                long long int *rowid) const
+{
+  std::string query = "INSERT INTO " + table + " (";
+  std::string values = "VALUES (";
+  std::vector<std::any> params;
+  params.reserve(data.size());
+  for (unsigned int i = 0; i < data.size(); ++i)
+  {
+    query += data[i].first + (i < data.size() - 1 ? ", " : ") ");
+    values += (i < data.size() - 1 ? "?, " : "?)");
+    params.push_back(data[i].second);
+  }
+
+  if (!d_database.exec(query + values, params))
+    return false;
+  if (rowid)
+    *rowid = d_database.lastInsertRowid();
+  return true;
+}
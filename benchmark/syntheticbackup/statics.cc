@@ -0,0 +1,219 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+// schema of a database version 205 backup (as written by Signal 6.2x), minus the full text
+// search tables and their triggers, which are never part of a backup
+std::vector<std::string> const SyntheticBackup::s_schema // static
+{
+  "CREATE TABLE message (_id INTEGER PRIMARY KEY AUTOINCREMENT, date_sent INTEGER NOT NULL, date_received INTEGER NOT NULL, "
+  "date_server INTEGER DEFAULT -1, thread_id INTEGER NOT NULL REFERENCES thread (_id) ON DELETE CASCADE, "
+  "from_recipient_id INTEGER NOT NULL REFERENCES recipient (_id) ON DELETE CASCADE, from_device_id INTEGER, "
+  "to_recipient_id INTEGER NOT NULL REFERENCES recipient (_id) ON DELETE CASCADE, type INTEGER NOT NULL, body TEXT, "
+  "read INTEGER DEFAULT 0, ct_l TEXT, exp INTEGER, m_type INTEGER, m_size INTEGER, st INTEGER, tr_id TEXT, "
+  "subscription_id INTEGER DEFAULT -1, receipt_timestamp INTEGER DEFAULT -1, delivery_receipt_count INTEGER DEFAULT 0, "
+  "read_receipt_count INTEGER DEFAULT 0, viewed_receipt_count INTEGER DEFAULT 0, mismatched_identities TEXT DEFAULT NULL, "
+  "network_failures TEXT DEFAULT NULL, expires_in INTEGER DEFAULT 0, expire_started INTEGER DEFAULT 0, "
+  "notified INTEGER DEFAULT 0, quote_id INTEGER DEFAULT 0, quote_author INTEGER DEFAULT 0, quote_body TEXT DEFAULT NULL, "
+  "quote_missing INTEGER DEFAULT 0, quote_mentions BLOB DEFAULT NULL, quote_type INTEGER DEFAULT 0, "
+  "shared_contacts TEXT DEFAULT NULL, unidentified INTEGER DEFAULT 0, link_previews TEXT DEFAULT NULL, "
+  "view_once INTEGER DEFAULT 0, reactions_unread INTEGER DEFAULT 0, reactions_last_seen INTEGER DEFAULT -1, "
+  "remote_deleted INTEGER DEFAULT 0, mentions_self INTEGER DEFAULT 0, notified_timestamp INTEGER DEFAULT 0, "
+  "server_guid TEXT DEFAULT NULL, message_ranges BLOB DEFAULT NULL, story_type INTEGER DEFAULT 0, "
+  "parent_story_id INTEGER DEFAULT 0, export_state BLOB DEFAULT NULL, exported INTEGER DEFAULT 0, "
+  "scheduled_date INTEGER DEFAULT -1, latest_revision_id INTEGER DEFAULT NULL REFERENCES message (_id) ON DELETE CASCADE, "
+  "original_message_id INTEGER DEFAULT NULL REFERENCES message (_id) ON DELETE CASCADE, revision_number INTEGER DEFAULT 0)",
+
+  "CREATE TABLE part (_id INTEGER PRIMARY KEY AUTOINCREMENT, mid INTEGER, seq INTEGER DEFAULT 0, ct TEXT, name TEXT, "
+  "chset INTEGER, cd TEXT, fn TEXT, cid TEXT, cl TEXT, ctt_s INTEGER, ctt_t TEXT, encrypted INTEGER, pending_push INTEGER, "
+  "_data TEXT, data_size INTEGER, file_name TEXT, unique_id INTEGER NOT NULL, digest BLOB, fast_preflight_id TEXT, "
+  "voice_note INTEGER DEFAULT 0, borderless INTEGER DEFAULT 0, video_gif INTEGER DEFAULT 0, data_random BLOB, "
+  "quote INTEGER DEFAULT 0, width INTEGER DEFAULT 0, height INTEGER DEFAULT 0, caption TEXT DEFAULT NULL, "
+  "sticker_pack_id TEXT DEFAULT NULL, sticker_pack_key DEFAULT NULL, sticker_id INTEGER DEFAULT -1, "
+  "sticker_emoji STRING DEFAULT NULL, data_hash TEXT DEFAULT NULL, blur_hash TEXT DEFAULT NULL, "
+  "transform_properties TEXT DEFAULT NULL, transfer_file TEXT DEFAULT NULL, display_order INTEGER DEFAULT 0, "
+  "upload_timestamp INTEGER DEFAULT 0, cdn_number INTEGER DEFAULT 0)",
+
+  "CREATE TABLE thread (_id INTEGER PRIMARY KEY AUTOINCREMENT, date INTEGER DEFAULT 0, meaningful_messages INTEGER DEFAULT 0, "
+  "recipient_id INTEGER NOT NULL UNIQUE REFERENCES recipient (_id) ON DELETE CASCADE, read INTEGER DEFAULT 1, "
+  "type INTEGER DEFAULT 0, error INTEGER DEFAULT 0, snippet TEXT, snippet_type INTEGER DEFAULT 0, "
+  "snippet_uri TEXT DEFAULT NULL, snippet_content_type TEXT DEFAULT NULL, snippet_extras TEXT DEFAULT NULL, "
+  "unread_count INTEGER DEFAULT 0, archived INTEGER DEFAULT 0, status INTEGER DEFAULT 0, "
+  "has_delivery_receipt INTEGER DEFAULT 0, has_read_receipt INTEGER DEFAULT 0, expires_in INTEGER DEFAULT 0, "
+  "last_seen INTEGER DEFAULT 0, has_sent INTEGER DEFAULT 0, last_scrolled INTEGER DEFAULT 0, pinned INTEGER DEFAULT 0, "
+  "unread_self_mention_count INTEGER DEFAULT 0, active INTEGER DEFAULT 0)",
+
+  "CREATE TABLE identities (_id INTEGER PRIMARY KEY AUTOINCREMENT, address INTEGER UNIQUE, identity_key TEXT, "
+  "first_use INTEGER DEFAULT 0, timestamp INTEGER DEFAULT 0, verified INTEGER DEFAULT 0, "
+  "nonblocking_approval INTEGER DEFAULT 0)",
+
+  "CREATE TABLE drafts (_id INTEGER PRIMARY KEY, thread_id INTEGER, type TEXT, value TEXT)",
+
+  "CREATE TABLE push (_id INTEGER PRIMARY KEY, type INTEGER, source TEXT, source_uuid TEXT, device_id INTEGER, "
+  "body TEXT, content TEXT, timestamp INTEGER, server_timestamp INTEGER DEFAULT 0, server_delivered_timestamp INTEGER DEFAULT 0, "
+  "server_guid TEXT DEFAULT NULL)",
+
+  "CREATE TABLE groups (_id INTEGER PRIMARY KEY, group_id TEXT, recipient_id INTEGER, title TEXT, avatar_id INTEGER, "
+  "avatar_key BLOB, avatar_content_type TEXT, avatar_relay TEXT, timestamp INTEGER, active INTEGER DEFAULT 1, "
+  "avatar_digest BLOB, mms INTEGER DEFAULT 0, master_key BLOB, revision BLOB, decrypted_group BLOB, "
+  "expected_v2_id TEXT DEFAULT NULL, unmigrated_v1_members TEXT DEFAULT NULL, distribution_id TEXT DEFAULT NULL, "
+  "display_as_story INTEGER DEFAULT 0, auth_service_id TEXT DEFAULT NULL, last_force_update_timestamp INTEGER DEFAULT 0)",
+
+  "CREATE TABLE recipient (_id INTEGER PRIMARY KEY AUTOINCREMENT, type INTEGER DEFAULT 0, e164 TEXT UNIQUE DEFAULT NULL, "
+  "aci TEXT UNIQUE DEFAULT NULL, pni TEXT UNIQUE DEFAULT NULL, username TEXT UNIQUE DEFAULT NULL, email TEXT UNIQUE DEFAULT NULL, "
+  "group_id TEXT UNIQUE DEFAULT NULL, distribution_list_id INTEGER DEFAULT NULL, registered INTEGER DEFAULT 0, "
+  "unregistered_timestamp INTEGER DEFAULT 0, blocked INTEGER DEFAULT 0, hidden INTEGER DEFAULT 0, "
+  "profile_key TEXT DEFAULT NULL, profile_key_credential TEXT DEFAULT NULL, profile_sharing INTEGER DEFAULT 0, "
+  "profile_given_name TEXT DEFAULT NULL, profile_family_name TEXT DEFAULT NULL, profile_joined_name TEXT DEFAULT NULL, "
+  "profile_avatar TEXT DEFAULT NULL, last_profile_fetch INTEGER DEFAULT 0, system_given_name TEXT DEFAULT NULL, "
+  "system_family_name TEXT DEFAULT NULL, system_joined_name TEXT DEFAULT NULL, system_nickname TEXT DEFAULT NULL, "
+  "system_photo_uri TEXT DEFAULT NULL, system_phone_label TEXT DEFAULT NULL, system_phone_type INTEGER DEFAULT -1, "
+  "system_contact_uri TEXT DEFAULT NULL, system_info_pending INTEGER DEFAULT 0, notification_channel TEXT DEFAULT NULL, "
+  "message_ringtone TEXT DEFAULT NULL, message_vibrate INTEGER DEFAULT 0, call_ringtone TEXT DEFAULT NULL, "
+  "call_vibrate INTEGER DEFAULT 0, mute_until INTEGER DEFAULT 0, message_expiration_time INTEGER DEFAULT 0, "
+  "sealed_sender_mode INTEGER DEFAULT 0, storage_service_id TEXT UNIQUE DEFAULT NULL, "
+  "storage_service_proto TEXT DEFAULT NULL, mention_setting INTEGER DEFAULT 0, capabilities INTEGER DEFAULT 0, "
+  "last_session_reset BLOB DEFAULT NULL, wallpaper BLOB DEFAULT NULL, wallpaper_uri TEXT DEFAULT NULL, "
+  "about TEXT DEFAULT NULL, about_emoji TEXT DEFAULT NULL, extras BLOB DEFAULT NULL, groups_in_common INTEGER DEFAULT 0, "
+  "avatar_color TEXT DEFAULT NULL, chat_colors BLOB DEFAULT NULL, custom_chat_colors_id INTEGER DEFAULT 0, "
+  "badges BLOB DEFAULT NULL, needs_pni_signature INTEGER DEFAULT 0, reporting_token BLOB DEFAULT NULL)",
+
+  "CREATE TABLE group_receipts (_id INTEGER PRIMARY KEY, mms_id INTEGER, address INTEGER, status INTEGER, timestamp INTEGER, "
+  "unidentified INTEGER DEFAULT 0)",
+
+  "CREATE TABLE sticker (_id INTEGER PRIMARY KEY AUTOINCREMENT, pack_id TEXT NOT NULL, pack_key TEXT NOT NULL, "
+  "pack_title TEXT NOT NULL, pack_author TEXT NOT NULL, sticker_id INTEGER, cover INTEGER, pack_order INTEGER, "
+  "emoji TEXT NOT NULL, content_type TEXT DEFAULT NULL, last_used INTEGER, installed INTEGER, file_path TEXT NOT NULL, "
+  "file_length INTEGER, file_random BLOB, UNIQUE(pack_id, sticker_id, cover) ON CONFLICT IGNORE)",
+
+  "CREATE TABLE remapped_recipients (_id INTEGER PRIMARY KEY AUTOINCREMENT, old_id INTEGER UNIQUE, new_id INTEGER)",
+
+  "CREATE TABLE remapped_threads (_id INTEGER PRIMARY KEY AUTOINCREMENT, old_id INTEGER UNIQUE, new_id INTEGER)",
+
+  "CREATE TABLE mention (_id INTEGER PRIMARY KEY AUTOINCREMENT, thread_id INTEGER, message_id INTEGER, "
+  "recipient_id INTEGER, range_start INTEGER, range_length INTEGER)",
+
+  "CREATE TABLE msl_payload (_id INTEGER PRIMARY KEY, date_sent INTEGER NOT NULL, content BLOB NOT NULL, "
+  "content_hint INTEGER NOT NULL, urgent INTEGER NOT NULL DEFAULT 1)",
+
+  "CREATE TABLE msl_recipient (_id INTEGER PRIMARY KEY, payload_id INTEGER NOT NULL REFERENCES msl_payload (_id) ON DELETE CASCADE, "
+  "recipient_id INTEGER NOT NULL, device INTEGER NOT NULL)",
+
+  "CREATE TABLE msl_message (_id INTEGER PRIMARY KEY, payload_id INTEGER NOT NULL REFERENCES msl_payload (_id) ON DELETE CASCADE, "
+  "message_id INTEGER NOT NULL)",
+
+  "CREATE TABLE reaction (_id INTEGER PRIMARY KEY, message_id INTEGER NOT NULL REFERENCES message (_id) ON DELETE CASCADE, "
+  "author_id INTEGER NOT NULL REFERENCES recipient (_id) ON DELETE CASCADE, emoji TEXT NOT NULL, date_sent INTEGER NOT NULL, "
+  "date_received INTEGER NOT NULL, UNIQUE(message_id, author_id) ON CONFLICT REPLACE)",
+
+  "CREATE TABLE chat_colors (_id INTEGER PRIMARY KEY AUTOINCREMENT, chat_colors BLOB)",
+
+  "CREATE TABLE call (_id INTEGER PRIMARY KEY, call_id INTEGER NOT NULL UNIQUE, "
+  "message_id INTEGER NOT NULL REFERENCES message (_id) ON DELETE CASCADE, "
+  "peer INTEGER NOT NULL REFERENCES recipient (_id) ON DELETE CASCADE, type INTEGER NOT NULL, direction INTEGER NOT NULL, "
+  "event INTEGER NOT NULL, timestamp INTEGER NOT NULL, ringer INTEGER DEFAULT NULL, deletion_timestamp INTEGER DEFAULT 0)",
+
+  "CREATE TABLE group_membership (_id INTEGER PRIMARY KEY, group_id TEXT NOT NULL, recipient_id INTEGER NOT NULL, "
+  "UNIQUE(group_id, recipient_id))",
+
+  "CREATE TABLE story_sends (_id INTEGER PRIMARY KEY, message_id INTEGER NOT NULL REFERENCES message (_id) ON DELETE CASCADE, "
+  "recipient_id INTEGER NOT NULL REFERENCES recipient (_id) ON DELETE CASCADE, sent_timestamp INTEGER NOT NULL, "
+  "allows_replies INTEGER NOT NULL, distribution_id TEXT NOT NULL)",
+
+  "CREATE INDEX message_read_and_notified_and_thread_id_index ON message(read, notified, thread_id)",
+  "CREATE INDEX message_type_index ON message (type)",
+  "CREATE INDEX message_date_sent_from_to_thread_index ON message (date_sent, from_recipient_id, to_recipient_id, thread_id)",
+  "CREATE INDEX message_date_server_index ON message (date_server)",
+  "CREATE INDEX message_thread_date_index ON message (thread_id, date_received)",
+  "CREATE INDEX message_reactions_unread_index ON message (reactions_unread)",
+  "CREATE INDEX message_original_message_id_index ON message (original_message_id)",
+  "CREATE INDEX part_mms_id_index ON part (mid)",
+  "CREATE INDEX pending_push_index ON part (pending_push)",
+  "CREATE INDEX part_sticker_pack_id_index ON part (sticker_pack_id)",
+  "CREATE INDEX part_data_hash_index ON part (data_hash)",
+  "CREATE INDEX part_data_index ON part (_data)",
+  "CREATE INDEX thread_recipient_id_index ON thread (recipient_id)",
+  "CREATE INDEX archived_count_index ON thread (archived, meaningful_messages)",
+  "CREATE INDEX thread_pinned_index ON thread (pinned)",
+  "CREATE INDEX draft_thread_index ON drafts (thread_id)",
+  "CREATE UNIQUE INDEX group_id_index ON groups (group_id)",
+  "CREATE UNIQUE INDEX group_recipient_id_index ON groups (recipient_id)",
+  "CREATE INDEX group_receipt_mms_id_index ON group_receipts (mms_id)",
+  "CREATE INDEX sticker_pack_id_index ON sticker (pack_id)",
+  "CREATE INDEX sticker_sticker_id_index ON sticker (sticker_id)",
+  "CREATE INDEX mention_message_id_index ON mention (message_id)",
+  "CREATE INDEX mention_recipient_id_thread_id_index ON mention (recipient_id, thread_id)",
+  "CREATE INDEX msl_payload_date_sent_index ON msl_payload (date_sent)",
+  "CREATE INDEX msl_recipient_recipient_index ON msl_recipient (recipient_id, device, payload_id)",
+  "CREATE INDEX msl_recipient_payload_index ON msl_recipient (payload_id)",
+  "CREATE INDEX msl_message_message_index ON msl_message (message_id, payload_id)",
+  "CREATE INDEX reaction_author_id_index ON reaction (author_id)",
+  "CREATE INDEX call_call_id_index ON call (call_id)",
+  "CREATE INDEX call_message_id_index ON call (message_id)",
+  "CREATE INDEX call_peer_index ON call (peer)",
+  "CREATE INDEX group_membership_recipient_id ON group_membership (recipient_id)",
+  "CREATE INDEX story_sends_recipient_id_sent_timestamp_allows_replies_index ON story_sends (recipient_id, sent_timestamp, allows_replies)",
+  "CREATE INDEX story_sends_message_id_distribution_id_index ON story_sends (message_id, distribution_id)"
+};
+
+std::vector<std::string> const SyntheticBackup::s_firstnames // static
+{
+  "Alice", "Bob", "Carol", "Dave", "Erin", "Frank", "Grace", "Heidi", "Ivan", "Judy", "Karim", "Lena", "Mallory",
+  "Niaj", "Olivia", "Peggy", "Quentin", "Rupert", "Sybil", "Trent", "Uma", "Victor", "Walter", "Xin", "Yara", "Zoë",
+  "Élodie", "Jürgen", "Søren", "Ørjan", "Łukasz", "Αλέξης", "Дмитрий", "さくら", "민준", "محمد"
+};
+
+std::vector<std::string> const SyntheticBackup::s_lastnames // static
+{
+  "Jansen", "de Vries", "Smith", "Müller", "García", "Rossi", "Kowalski", "Nielsen", "Novák", "Öztürk", "Dubois",
+  "Silva", "Nakamura", "Kim", "Ivanova", "O'Brien", "van den Berg", "Lindqvist", "Hernández", "Papadopoulos"
+};
+
+std::vector<std::string> const SyntheticBackup::s_words // static
+{
+  "the", "be", "to", "of", "and", "a", "in", "that", "have", "I", "it", "for", "not", "on", "with", "he", "as", "you",
+  "do", "at", "this", "but", "his", "by", "from", "they", "we", "say", "her", "she", "or", "an", "will", "my", "one",
+  "all", "would", "there", "their", "what", "so", "up", "out", "if", "about", "who", "get", "which", "go", "me", "when",
+  "make", "can", "like", "time", "no", "just", "him", "know", "take", "people", "into", "year", "your", "good", "some",
+  "could", "them", "see", "other", "than", "then", "now", "look", "only", "come", "its", "over", "think", "also",
+  "back", "after", "use", "two", "how", "our", "work", "first", "well", "way", "even", "new", "want", "because",
+  "any", "these", "give", "day", "most", "us", "tomorrow", "dinner", "train", "late", "okay", "haha", "sure",
+  "<b>", "&amp;", "\"quoted\"", "https://example.org/some/path?x=1&y=2", "café", "naïve", "straße", "ünïcödé"
+};
+
+std::vector<std::string> const SyntheticBackup::s_emoji // static
+{
+  "😀", "😂", "🤣", "😊", "😍", "😘", "😎", "🤔", "😴", "😭", "😡", "👍", "👎", "👏", "🙏", "💪", "🎉", "🔥", "❤️",
+  "💯", "✅", "🙈", "🤷‍♂️", "👨‍👩‍👧‍👦", "🏳️‍🌈", "👍🏽", "🇳🇱", "☕", "🍕", "⚽"
+};
+
+std::vector<std::string> const SyntheticBackup::s_reactions // static
+{
+  "❤️", "👍", "👎", "😂", "😮", "😢", "🙏", "🔥"
+};
+
+std::vector<SyntheticBackup::MimeType> const SyntheticBackup::s_mimetypes // static
+{
+  {"image/jpeg", "jpg", std::string("\xff\xd8\xff\xe0\x00\x10JFIF", 10)},
+  {"image/png", "png", "\x89PNG\r\n\x1a\n"},
+  {"image/gif", "gif", "GIF89a"},
+  {"video/mp4", "mp4", std::string("\x00\x00\x00\x18" "ftypmp42", 12)},
+  {"audio/aac", "aac", "\xff\xf1"},
+  {"application/pdf", "pdf", "%PDF-1.7\n"}
+};
@@ -0,0 +1,44 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+SyntheticBackup::SyntheticBackup(Params const &params)
+  :
+  d_params(params),
+  d_database(":memory:"),
+  d_selfid(-1),
+  d_ok(false)
+{
+  if (!d_database.ok())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to create database" << std::endl;
+    return;
+  }
+
+  if (d_params.minattachmentsize == 0 || d_params.maxattachmentsize < d_params.minattachmentsize)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Invalid attachment size range ("
+              << d_params.minattachmentsize << " - " << d_params.maxattachmentsize << ")" << std::endl;
+    return;
+  }
+
+  d_database.exec("BEGIN TRANSACTION");
+  d_ok = createSchema() && addRecipients() && addMessages();
+  d_database.exec(d_ok ? "COMMIT" : "ROLLBACK");
+}
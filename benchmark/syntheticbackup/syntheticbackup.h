@@ -0,0 +1,160 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef SYNTHETICBACKUP_H_
+#define SYNTHETICBACKUP_H_
+
+#include <any>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../sqlitedb/sqlitedb.h"
+
+// Builds a Signal database from a fixed schema dump and fills it with generated contacts,
+// groups, threads, messages, attachments, mentions and reactions. Everything is derived from
+// the seeds in Params (integer arithmetic only, no std:: distributions), so the same parameters
+// produce the same backup file on every platform, which makes it usable as a benchmark input.
+class SyntheticBackup
+{
+ public:
+  struct Params
+  {
+    uint64_t seed = 1;                       // contacts, groups, keys
+    uint64_t messageseed = 1;                // message contents (vary to get different messages between the same people)
+    long long int messages = 10000;
+    long long int threads = 20;              // one-to-one threads, the groups below get a thread each as well
+    std::vector<long long int> groupsizes{5, 25, 100};
+    double attachmentratio = 0.05;           // fraction of messages with an attachment
+    uint64_t minattachmentsize = 4096;       // attachment sizes are roughly log-uniform in [min, max]
+    uint64_t maxattachmentsize = 4194304;
+    double emojidensity = 0.05;              // chance of a word being an emoji, also the chance of a message getting a reaction
+    double mentiondensity = 0.1;             // chance of a group message containing a mention
+    uint32_t backupfileversion = 1;
+  };
+
+ private:
+  class Random // splitmix64: small, fast, and identical output everywhere
+  {
+    uint64_t d_state;
+   public:
+    inline explicit Random(uint64_t seed);
+    inline uint64_t operator()();
+    inline uint64_t below(uint64_t n);
+    inline bool chance(double p);
+  };
+
+  struct Thread
+  {
+    long long int id;
+    long long int recipient;
+    bool isgroup;
+    std::vector<long long int> members; // excluding self
+  };
+
+  Params d_params;
+  SqliteDB d_database;
+  long long int d_selfid;
+  std::vector<long long int> d_contacts;
+  std::vector<Thread> d_threads;
+  bool d_ok;
+
+  static long long int constexpr s_databaseversion = 205;
+  static long long int constexpr s_firstdate = 1672531200000; // 2023-01-01 00:00:00 UTC
+  struct MimeType
+  {
+    std::string type;
+    std::string extension;
+    std::string magic;
+  };
+  static std::vector<std::string> const s_schema;
+  static std::vector<std::string> const s_firstnames;
+  static std::vector<std::string> const s_lastnames;
+  static std::vector<std::string> const s_words;
+  static std::vector<std::string> const s_emoji;
+  static std::vector<std::string> const s_reactions;
+  static std::vector<MimeType> const s_mimetypes;
+
+ public:
+  explicit SyntheticBackup(Params const &params);
+  SyntheticBackup(SyntheticBackup const &other) = delete;
+  SyntheticBackup &operator=(SyntheticBackup const &other) = delete;
+  inline bool ok() const;
+  inline SqliteDB const &database() const;
+  inline std::string selfPhone() const;
+  inline static std::string phone(long long int idx);
+  bool writeBackup(std::string const &filename, std::string const &passphrase, uint64_t *framecount = nullptr) const;
+
+ private:
+  bool createSchema();
+  bool addRecipients();
+  bool addMessages();
+  bool insertRow(std::string const &table, std::vector<std::pair<std::string, std::any>> const &data,
+                 long long int *rowid = nullptr) const;
+  std::string uuid(Random *rng) const;
+  std::string body(Random *rng, bool mention, long long int *mentionstart) const;
+  uint64_t attachmentSize(Random *rng) const;
+  std::pair<unsigned char *, uint64_t> attachmentData(long long int rowid, std::string const &mimetype, uint64_t size) const;
+};
+
+inline SyntheticBackup::Random::Random(uint64_t seed)
+  :
+  d_state(seed)
+{}
+
+inline uint64_t SyntheticBackup::Random::operator()()
+{
+  uint64_t z = (d_state += 0x9e3779b97f4a7c15);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+inline uint64_t SyntheticBackup::Random::below(uint64_t n)
+{
+  return n ? (*this)() % n : 0;
+}
+
+inline bool SyntheticBackup::Random::chance(double p)
+{
+  return static_cast<double>((*this)() >> 11) * 0x1.0p-53 < p;
+}
+
+inline bool SyntheticBackup::ok() const
+{
+  return d_ok;
+}
+
+inline SqliteDB const &SyntheticBackup::database() const
+{
+  return d_database;
+}
+
+inline std::string SyntheticBackup::selfPhone() const
+{
+  return phone(0);
+}
+
+inline std::string SyntheticBackup::phone(long long int idx) // static
+{
+  std::string num(std::to_string(idx));
+  return "+3161" + std::string(num.size() < 7 ? 7 - num.size() : 0, '0') + num;
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+std::string SyntheticBackup::uuid(Random *rng) const
+{
+  uint64_t const hi = (*rng)();
+  uint64_t const lo = (*rng)();
+  unsigned char bytes[16];
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    bytes[i] = static_cast<unsigned char>(hi >> (56 - i * 8));
+    bytes[i + 8] = static_cast<unsigned char>(lo >> (56 - i * 8));
+  }
+  bytes[6] = (bytes[6] & 0x0f) | 0x40; // version 4
+  bytes[8] = (bytes[8] & 0x3f) | 0x80; // variant 1
+
+  std::string const hex = bepaald::bytesToHexString(bytes, 16, true);
+  return hex.substr(0, 8) + "-" + hex.substr(8, 4) + "-" + hex.substr(12, 4) + "-" + hex.substr(16, 4) + "-" + hex.substr(20);
+}
@@ -0,0 +1,187 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "syntheticbackup.ih"
+
+#include "../../attachmentframe/attachmentframe.h"
+#include "../../databaseversionframe/databaseversionframe.h"
+#include "../../endframe/endframe.h"
+#include "../../fileencryptor/fileencryptor.h"
+#include "../../headerframe/headerframe.h"
+#include "../../sqlstatementframe/sqlstatementframe.h"
+
+// Writes the database as an official export would: header, database version, the schema, then
+// the contents of every table (every part row directly followed by its attachment), end frame.
+bool SyntheticBackup::writeBackup(std::string const &filename, std::string const &passphrase, uint64_t *framecount) const
+{
+  if (!d_ok)
+    return false;
+
+  Random rng(d_params.seed ^ 0x5eed5a17);
+  unsigned char salt[32];
+  unsigned char iv[16];
+  for (unsigned char &c : salt)
+    c = static_cast<unsigned char>(rng());
+  for (unsigned char &c : iv)
+    c = static_cast<unsigned char>(rng());
+
+  auto setBytes = [](BackupFrame *frame, unsigned int field, unsigned char const *bytes, uint64_t size)
+  {
+    unsigned char *data = new unsigned char[size];
+    std::memcpy(data, bytes, size);
+    frame->setNewData(field, data, size);
+  };
+  auto setInt = [](BackupFrame *frame, unsigned int field, uint64_t value)
+  {
+    unsigned char *data = new unsigned char[sizeof(uint64_t)];
+    for (unsigned int i = 0; i < sizeof(uint64_t); ++i)
+      data[i] = static_cast<unsigned char>(value >> ((sizeof(uint64_t) - 1 - i) * 8));
+    frame->setNewData(field, data, sizeof(uint64_t));
+  };
+
+  FileEncryptor fe(passphrase, salt, 32, iv, 16, d_params.backupfileversion, false);
+  if (!fe.ok())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to initialize FileEncryptor" << std::endl;
+    return false;
+  }
+
+  std::ofstream out(filename, std::ios_base::binary);
+  if (!out.is_open())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to open '" << filename << "' for writing" << std::endl;
+    return false;
+  }
+
+  // HeaderFrame is not encrypted
+  HeaderFrame header;
+  setBytes(&header, header.getField("IV"), iv, 16);
+  setBytes(&header, header.getField("SALT"), salt, 32);
+  if (d_params.backupfileversion)
+    setInt(&header, header.getField("VERSION"), d_params.backupfileversion);
+  std::pair<unsigned char *, uint64_t> headerdata = header.getData();
+  uint32_t besize = bepaald::swap_endian(static_cast<uint32_t>(headerdata.second));
+  bool writeok = out.write(reinterpret_cast<char *>(&besize), sizeof(uint32_t)) &&
+    out.write(reinterpret_cast<char *>(headerdata.first), headerdata.second);
+  delete[] headerdata.first;
+
+  uint64_t frames = 1;
+  auto writeFrame = [&](BackupFrame const &frame, std::pair<unsigned char *, uint64_t> const &attachment = {nullptr, 0})
+  {
+    std::pair<unsigned char *, uint64_t> framedata = frame.getData();
+    std::pair<unsigned char *, uint64_t> encryptedframe = fe.encryptFrame(framedata);
+    delete[] framedata.first;
+    bool ok = encryptedframe.first && out.write(reinterpret_cast<char *>(encryptedframe.first), encryptedframe.second);
+    delete[] encryptedframe.first;
+    if (ok && attachment.first)
+    {
+      std::pair<unsigned char *, uint64_t> encryptedattachment = fe.encryptAttachment(attachment.first, attachment.second);
+      ok = encryptedattachment.first && out.write(reinterpret_cast<char *>(encryptedattachment.first), encryptedattachment.second);
+      delete[] encryptedattachment.first;
+    }
+    ++frames;
+    return ok;
+  };
+
+  DatabaseVersionFrame version;
+  setInt(&version, version.getField("VERSION"), s_databaseversion);
+  writeok = writeok && writeFrame(version);
+
+  SqliteDB::QueryResults schema;
+  writeok = writeok && d_database.exec("SELECT sql, name, type FROM sqlite_master WHERE sql IS NOT NULL AND name NOT LIKE 'sqlite_%'", &schema);
+  std::vector<std::string> tables;
+  for (unsigned int i = 0; writeok && i < schema.rows(); ++i)
+  {
+    if (schema.valueAsString(i, "type") == "table")
+      tables.emplace_back(schema.valueAsString(i, "name"));
+    SqlStatementFrame statement;
+    statement.setStatementField(schema.valueAsString(i, "sql"));
+    writeok = writeFrame(statement);
+  }
+
+  for (unsigned int t = 0; writeok && t < tables.size(); ++t)
+  {
+    SqliteDB::QueryResults results;
+    if (!d_database.exec("SELECT * FROM " + tables[t], &results))
+      return false;
+
+    int idcol = -1;
+    int uniqueidcol = -1;
+    int ctcol = -1;
+    int sizecol = -1;
+    for (unsigned int c = 0; c < results.columns(); ++c)
+      if (results.header(c) == "_id")
+        idcol = c;
+      else if (results.header(c) == "unique_id")
+        uniqueidcol = c;
+      else if (results.header(c) == "ct")
+        ctcol = c;
+      else if (results.header(c) == "data_size")
+        sizecol = c;
+    bool const ispart = tables[t] == "part" && idcol != -1 && uniqueidcol != -1 && ctcol != -1 && sizecol != -1;
+
+    for (unsigned int i = 0; writeok && i < results.rows(); ++i)
+    {
+      SqlStatementFrame statement;
+      std::string query = "INSERT INTO " + tables[t] + " VALUES (";
+      for (unsigned int c = 0; c < results.columns(); ++c)
+      {
+        query += (c < results.columns() - 1) ? "?," : "?)";
+        std::any const &value = results.value(i, c);
+        if (value.type() == typeid(long long int))
+          statement.addIntParameter(std::any_cast<long long int>(value));
+        else if (value.type() == typeid(std::string))
+          statement.addStringParameter(std::any_cast<std::string>(value));
+        else if (value.type() == typeid(std::pair<std::shared_ptr<unsigned char []>, size_t>))
+          statement.addBlobParameter(std::any_cast<std::pair<std::shared_ptr<unsigned char []>, size_t>>(value));
+        else if (value.type() == typeid(double))
+          statement.addDoubleParameter(std::any_cast<double>(value));
+        else
+          statement.addNullParameter();
+      }
+      statement.setStatementField(query);
+      writeok = writeFrame(statement);
+
+      if (writeok && ispart)
+      {
+        long long int const rowid = results.getValueAs<long long int>(i, idcol);
+        long long int const size = results.getValueAs<long long int>(i, sizecol);
+        AttachmentFrame attachment;
+        setInt(&attachment, attachment.getField("ROWID"), rowid);
+        setInt(&attachment, attachment.getField("ATTACHMENTID"), results.getValueAs<long long int>(i, uniqueidcol));
+        setInt(&attachment, attachment.getField("LENGTH"), size);
+        std::pair<unsigned char *, uint64_t> data = attachmentData(rowid, results.valueAsString(i, ctcol), size);
+        writeok = writeFrame(attachment, data);
+        delete[] data.first;
+      }
+    }
+  }
+
+  EndFrame end(nullptr, 1);
+  writeok = writeok && writeFrame(end);
+
+  if (!writeok)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to write '" << filename << "'" << std::endl;
+    return false;
+  }
+
+  if (framecount)
+    *framecount = frames;
+  return true;
+}
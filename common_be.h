@@ -32,6 +32,7 @@
 #include <cstring>
 #include <algorithm>
 #include <ctime>
+#include <limits>
 
 #if defined(_WIN32) || defined(__MINGW64__)
 #include <windows.h>
@@ -143,6 +144,7 @@ namespace bepaald
   template <typename T, typename U>
   inline int findIdxOf(T const &container, U const &value);
   inline bool hexStringToBytes(std::string const &in, unsigned char *out, uint64_t outsize);
+  inline bool parseByteSize(std::string const &in, uint64_t *out);
 }
 
 template <typename T>
@@ -386,8 +388,16 @@ inline std::ostream &bepaald::bold_off(std::ostream &os)
 
 inline std::string bepaald::toDateString(std::time_t epoch, std::string const &format)
 {
+  // std::localtime() returns a pointer to shared static data, use the reentrant versions
+  // so this can be called from multiple threads at once
+  std::tm tm{};
+#if defined(_WIN32) || defined(__MINGW64__)
+  localtime_s(&tm, &epoch);
+#else
+  localtime_r(&epoch, &tm);
+#endif
   std::ostringstream tmp;
-  tmp << std::put_time(std::localtime(&epoch), format.c_str());
+  tmp << std::put_time(&tm, format.c_str());
   return tmp.str();
 }
 
@@ -460,6 +470,49 @@ inline bool bepaald::hexStringToBytes(std::string const &in, unsigned char *out,
   return true;
 }
 
+// parses sizes like "1048576", "512K", "256M" or "2G" (binary multiples, case insensitive,
+// an optional trailing 'B' or 'iB' is allowed)
+inline bool bepaald::parseByteSize(std::string const &in, uint64_t *out)
+{
+  if (in.empty() || in[0] < '0' || in[0] > '9')
+    return false;
+
+  uint64_t value = 0;
+  uint pos = 0;
+  for (; pos < in.size() && in[pos] >= '0' && in[pos] <= '9'; ++pos)
+  {
+    if (value > (std::numeric_limits<uint64_t>::max() - 9) / 10) [[unlikely]]
+      return false;
+    value = value * 10 + (in[pos] - '0');
+  }
+
+  std::string suffix = toLower(in.substr(pos));
+  if (suffix.size() > 1 && suffix.back() == 'b')
+    suffix.pop_back();
+  if (suffix.size() > 1 && suffix.back() == 'i')
+    suffix.pop_back();
+
+  int shift = 0;
+  if (suffix.empty() || suffix == "b")
+    shift = 0;
+  else if (suffix == "k")
+    shift = 10;
+  else if (suffix == "m")
+    shift = 20;
+  else if (suffix == "g")
+    shift = 30;
+  else if (suffix == "t")
+    shift = 40;
+  else
+    return false;
+
+  if (shift && value > (std::numeric_limits<uint64_t>::max() >> shift)) [[unlikely]]
+    return false;
+
+  *out = value << shift;
+  return true;
+}
+
 #ifdef SIGNALBACKUP_TOOLS_REPORT_MEM
 #define MEMINFO(...) process_mem_usage(__VA_ARGS__)
 
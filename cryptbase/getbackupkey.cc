@@ -21,6 +21,8 @@
 
 bool CryptBase::getBackupKey(std::string const &passphrase)
 {
+  PhaseStats::Scope phase("key derivation");
+
   // convert passwords digits to unsigned char *
   size_t const passlength = 30;
   unsigned char pass[passlength];
@@ -28,6 +28,8 @@
 
 class CSVReader
 {
+  friend class MicroBenchmark; // benchmark/micro times some of the private members
+
  private:
   enum class CSVState
   {
@@ -30,12 +30,11 @@ class DatabaseVersionFrame : public BackupFrame
     VERSION = 1 // uint32
   };
 
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 1> s_fields{{{FIELD::VERSION, WIRETYPE::VARINT, false}}};
  public:
   inline explicit DatabaseVersionFrame(uint64_t count = 0);
   inline DatabaseVersionFrame(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual ~DatabaseVersionFrame() = default;
-  inline static BackupFrame *create(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual FRAMETYPE frameType() const override;
   inline uint32_t version() const;
   inline virtual void printInfo() const override;
@@ -55,16 +54,13 @@ inline DatabaseVersionFrame::DatabaseVersionFrame(uint64_t count)
 
 inline DatabaseVersionFrame::DatabaseVersionFrame(unsigned char *bytes, size_t length, uint64_t count)
   :
-  BackupFrame(bytes, length, count)
+  BackupFrame(count)
 {
+  d_constructedsize = length;
+  d_ok = init<s_fields>(bytes, length, &d_framedata);
   //std::cout << "CREATING DATABASEVERSIONFRAME" << std::endl;
 }
 
-inline BackupFrame *DatabaseVersionFrame::create(unsigned char *bytes, size_t length, uint64_t count) // static
-{
-  return new DatabaseVersionFrame(bytes, length, count);
-}
-
 inline BackupFrame::FRAMETYPE DatabaseVersionFrame::frameType() const // virtual
 {
   return FRAMETYPE::DATABASEVERSION;
@@ -24,11 +24,9 @@
 
 class EndFrame: public BackupFrame
 {
-  static Registrar s_registrar;
  public:
   inline EndFrame(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual ~EndFrame() = default;
-  inline static BackupFrame *create(unsigned char *bytes, size_t length, uint64_t count);
   inline virtual void printInfo() const override;
   inline virtual FRAMETYPE frameType() const override;
   inline std::pair<unsigned char *, uint64_t> getData() const override;
@@ -46,11 +44,6 @@ inline EndFrame::EndFrame(unsigned char *, size_t length, uint64_t count)
   d_framedata.push_back(std::make_tuple(0, valbytes, sizeof(length)));
 }
 
-inline BackupFrame *EndFrame::create(unsigned char *bytes, size_t length, uint64_t count) // static
-{
-  return new EndFrame(bytes, length, count);
-}
-
 inline void EndFrame::printInfo() const // virtual override
 {
   std::cout << "Frame number: " << d_count << std::endl;
@@ -0,0 +1,73 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// Searches the file after a damaged frame for the next frame that can be verified and decrypted
+// (see resync()), and continues reading from there.
+std::unique_ptr<BackupFrame> FileDecryptor::bruteForceFrom(uint64_t filepos, uint32_t previousframelength)
+{
+  std::cout << "Starting bruteforcing offset to next valid frame... starting after: " << filepos << std::endl;
+
+  MappedFile file(d_filename);
+  if (!file.ok()) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " Failed to map '" << d_filename << "' into memory" << std::endl;
+    return std::unique_ptr<BackupFrame>(nullptr);
+  }
+
+  ThreadPool pool;
+  uint64_t pos = 0;
+  uint32_t encryptedframelength = 0;
+  uint64_t skipped = 0;
+  std::unique_ptr<BackupFrame> frame(resync(file, &pool, filepos, d_counter, d_framecount, &pos, &encryptedframelength, &skipped));
+  if (!frame)
+    return frame;
+
+  uint64_t const offset = pos - filepos;
+  d_badmac = false;
+  d_counter += skipped + 1;
+  d_framecount += skipped + 1;
+  std::cout << "YEAH! :) Skipped " << skipped << " frames" << std::endl;
+  if (d_assumebadframesize && skipped == 0)
+    std::cout << std::endl << " ! CORRECT FRAME_NUMBER:SIZE = " << frame->frameNumber() - 1 << ":"
+              << offset - previousframelength - MACSIZE - 4 << std::endl << std::endl;
+  std::cout << "Good frame: " << frame->frameNumber() << " (" << frame->frameTypeString() << ")" << std::endl;
+  frame->printInfo();
+
+  d_file.clear();
+  d_file.seekg(pos + 4 + encryptedframelength, std::ios_base::beg);
+
+  uint32_t attsize = 0;
+  if ((attsize = frame->attachmentSize()) > 0 &&
+      (frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT ||
+       frame->frameType() == BackupFrame::FRAMETYPE::AVATAR ||
+       frame->frameType() == BackupFrame::FRAMETYPE::STICKER))
+  {
+    if (d_verbose) [[unlikely]]
+      std::cout << "Trying to read attachment (bruteforce)" << std::endl;
+
+    uintToFourBytes(d_iv, d_counter++);
+
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_attachmentcontext, attsize, d_file.tellg());
+
+    d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
+  }
+  return frame;
+}
@@ -151,7 +151,7 @@ void FileDecryptor::strugee(uint64_t pos)
 
     uintToFourBytes(d_iv, d_counter++);
 
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_attachmentcontext, attsize, d_file.tellg());
 
     d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
 
@@ -314,7 +314,7 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrameStrugee2()
 
     uintToFourBytes(d_iv, d_counter++);
 
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_attachmentcontext, attsize, d_file.tellg());
 
     d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
 
@@ -544,7 +544,7 @@ void FileDecryptor::strugee3Helper(std::vector<std::pair<std::unique_ptr<unsigne
 
     uintToFourBytes(d_iv, d_counter++);
 
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_attachmentcontext, attsize, d_file.tellg());
 
     d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
 
@@ -807,7 +807,7 @@ void FileDecryptor::ashmorgan()
 
     uintToFourBytes(d_iv, d_counter++);
 
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_attachmentcontext, attsize, d_file.tellg());
 
     d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
 
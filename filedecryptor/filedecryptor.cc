@@ -100,6 +100,8 @@ FileDecryptor::FileDecryptor(std::string const &filename, std::string const &pas
     return;
   }
 
+  d_attachmentcontext = FrameWithAttachment::makeSharedContext(d_filename, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size);
+
   d_backupfileversion = reinterpret_cast<HeaderFrame *>(headerframe)->version();
 
   //headerframe->printInfo();
@@ -20,6 +20,8 @@
 #ifndef FILEDECRYPTOR_H_
 #define FILEDECRYPTOR_H_
 
+#include <array>
+#include <atomic>
 #include <cstring>
 #include <fstream>
 
@@ -30,11 +32,28 @@
 #include "../basedecryptor/basedecryptor.h"
 #include "../invalidframe/invalidframe.h"
 
+class MappedFile;
+class ThreadPool;
+
 class  FileDecryptor : public BaseDecryptor//, public CryptBase
 {
+  // start of the first keystream block for a range of counters (the part that decrypts the (encrypted)
+  // frame length and the start of the frame), grouped on the bits that decide if a frame length is plausible.
+  struct KeyStreams
+  {
+    struct KeyStream
+    {
+      uint32_t skip;                          // keystream for counter + skip
+      std::array<unsigned char, 12> bytes;
+    };
+    std::vector<uint32_t> bucketstart;        // bucket b is keystreams[bucketstart[b], bucketstart[b + 1])
+    std::vector<KeyStream> keystreams;        // (ascending skip within each bucket)
+  };
+
   std::unique_ptr<BackupFrame> d_headerframe;
   std::ifstream d_file;
   std::string d_filename;
+  std::shared_ptr<FrameWithAttachment::SharedContext const> d_attachmentcontext; // shared by all lazy frames
   uint64_t d_framecount;
   uint64_t d_filesize;
   bool d_badmac;
@@ -44,6 +63,10 @@ class  FileDecryptor : public BaseDecryptor//, public CryptBase
   bool d_stoponerror;
   uint32_t d_backupfileversion;
 
+  static uint32_t constexpr s_maxbruteframesize = 3145728; // 3MB, larger frames are not believed when resyncing
+  static uint64_t constexpr s_bruteforcechunk = 1 << 20; // offsets scanned per task when resyncing
+  static uint64_t constexpr s_maxbruteskip = 1 << 18; // frames that may be lost in one damaged part of a version 1+ file
+
  public:
   FileDecryptor(std::string const &filename, std::string const &passphrase, bool verbose, bool stoponerror = false, bool assumebadframesize = false, std::vector<long long int> editattachments = std::vector<long long int>());
   FileDecryptor(FileDecryptor const &other) = delete;
@@ -64,6 +87,8 @@ class  FileDecryptor : public BaseDecryptor//, public CryptBase
   void strugee3Helper(std::vector<std::pair<std::unique_ptr<unsigned char[]>, uint64_t>> *macs_and_positions);
   void strugee3(uint64_t pos);
 
+  bool salvage(std::string const &outputfile, std::string const &passphrase);
+
  private:
   inline uint32_t getNextFrameBlockSize();
   inline bool getNextFrameBlock(unsigned char *data, size_t length);
@@ -71,7 +96,18 @@ class  FileDecryptor : public BaseDecryptor//, public CryptBase
   //virtual int getAttachment(FrameWithAttachment *frame) override;
 
   std::unique_ptr<BackupFrame> bruteForceFrom(uint64_t filepos, uint32_t previousframelength);
-  std::unique_ptr<BackupFrame> getFrameBrute(uint64_t offset, uint32_t previousframelength);
+  std::unique_ptr<BackupFrame> resync(MappedFile const &file, ThreadPool *pool, uint64_t filepos, uint64_t counter,
+                                      uint64_t framecount, uint64_t *framepos, uint32_t *framelength, uint64_t *skipped) const;
+  uint64_t scanForMac(unsigned char const *data, uint64_t size, uint64_t begin, uint64_t end,
+                      std::atomic<uint64_t> const &found) const;
+  uint64_t scanForFrame(unsigned char const *data, uint64_t size, uint64_t begin, uint64_t end, uint64_t filepos,
+                        KeyStreams const &keystreams, std::atomic<uint64_t> const &found, uint64_t *skip) const;
+  bool initKeyStreams(uint64_t counter, uint64_t count, KeyStreams *keystreams) const;
+  std::unique_ptr<BackupFrame> getFrameBrute(unsigned char const *encryptedframe, uint32_t encryptedframelength,
+                                             uint64_t counter, uint64_t framecount, uint64_t maxskip, bool atend,
+                                             ThreadPool *pool, uint64_t *skipped) const;
+  BackupFrame *getFrameAt(unsigned char const *data, uint64_t size, uint64_t pos, uint64_t counter, uint64_t count,
+                          uint32_t *encryptedframelength) const;
 };
 
 inline bool FileDecryptor::ok() const
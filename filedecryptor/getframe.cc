@@ -21,6 +21,9 @@
 
 std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
 {
+  PhaseStats::Scope phase("frame decryption");
+  Trace::Span span("FileDecryptor::getFrame");
+
   if (d_backupfileversion == 0) [[unlikely]]
     return getFrameOld();
 
@@ -127,6 +130,7 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
     std::cout << "Failed to read next frame (" << encryptedframelength << " bytes at filepos " << filepos << ")" << std::endl;
     return std::unique_ptr<BackupFrame>(nullptr);
   }
+  phase.addBytesRead(sizeof(decltype(encrypted_encryptedframelength)) + encryptedframelength);
 
   // update MAC with read data
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
@@ -244,7 +248,7 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
 
     uintToFourBytes(d_iv, d_counter++);
 
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_attachmentcontext, attsize, d_file.tellg());
 
     d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
   }
@@ -253,6 +257,7 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrame()
 
   //delete frame;
 
+  phase.addItems(1);
   return frame;
 }
 
@@ -424,7 +429,7 @@ std::unique_ptr<BackupFrame> FileDecryptor::getFrameOld()
 
     uintToFourBytes(d_iv, d_counter++);
 
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
+    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_attachmentcontext, attsize, d_file.tellg());
 
     d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
   }
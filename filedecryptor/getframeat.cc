@@ -0,0 +1,79 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// Verifies and decrypts the frame starting at `pos' in a mapped backup file, assuming it was
+// encrypted with `counter'. Returns nullptr if that does not produce a valid frame. On success
+// *encryptedframelength is set to the size of the frame (excluding its 4 byte length, and
+// excluding any attachment data following it). Does not touch the decryptor's own state.
+BackupFrame *FileDecryptor::getFrameAt(unsigned char const *data, uint64_t size, uint64_t pos, uint64_t counter, uint64_t count,
+                                       uint32_t *encryptedframelength) const
+{
+  if (pos + 4 > size) [[unlikely]]
+    return nullptr;
+
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  std::memcpy(iv.get(), d_iv, d_iv_size);
+  uintToFourBytes(iv.get(), counter);
+
+  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  if (!ctx || EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, iv.get()) != 1) [[unlikely]]
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return nullptr;
+  }
+  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+
+  // in newer backup file versions, the length is encrypted (and part of the MAC)
+  uint32_t length = 0;
+  int outlength = 0;
+  if (d_backupfileversion >= 1)
+  {
+    if (EVP_DecryptUpdate(ctx.get(), reinterpret_cast<unsigned char *>(&length), &outlength, data + pos, sizeof(decltype(length))) != 1) [[unlikely]]
+      return nullptr;
+  }
+  else
+    std::memcpy(&length, data + pos, sizeof(decltype(length)));
+  length = bepaald::swap_endian<uint32_t>(length);
+
+  if (length > 115343360 /*110MB*/ || length < 11 || length > size - pos - 4)
+    return nullptr;
+
+  unsigned char const *frame = data + pos + 4;
+  unsigned char const *macstart = d_backupfileversion >= 1 ? data + pos : frame;
+  unsigned int hash_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (!HMAC(EVP_sha256(), d_mackey, d_mackey_size, macstart, (frame - macstart) + length - MACSIZE, hash, &hash_size) ||
+      std::memcmp(frame + (length - MACSIZE), hash, MACSIZE) != 0)
+    return nullptr;
+
+  int decodedframelength = length - MACSIZE;
+  std::unique_ptr<unsigned char[]> decodedframe(new unsigned char[decodedframelength]);
+  if (EVP_DecryptUpdate(ctx.get(), decodedframe.get(), &decodedframelength, frame, length - MACSIZE) != 1) [[unlikely]]
+  {
+    std::cout << "Failed to decrypt data" << std::endl;
+    return nullptr;
+  }
+
+  BackupFrame *ret = initBackupFrame(decodedframe.get(), decodedframelength, count);
+  if (ret)
+    *encryptedframelength = length;
+  return ret;
+}
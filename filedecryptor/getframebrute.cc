@@ -19,162 +19,92 @@
 
 #include "filedecryptor.ih"
 
-std::unique_ptr<BackupFrame> FileDecryptor::bruteForceFrom(uint64_t filepos, uint32_t previousframelength)
+// Given a frame with a valid MAC, find the counter it was encrypted with: every frame (and every
+// attachment) before it used one, so try counter + skipped for skipped in [0, maxskip], spread
+// over the pool. The smallest skip that decrypts to a valid frame wins.
+std::unique_ptr<BackupFrame> FileDecryptor::getFrameBrute(unsigned char const *encryptedframe, uint32_t encryptedframelength,
+                                                          uint64_t counter, uint64_t framecount, uint64_t maxskip, bool atend,
+                                                          ThreadPool *pool, uint64_t *skipped) const
 {
-  std::cout << "Starting bruteforcing offset to next valid frame... starting after: " << filepos << std::endl;
-  uint64_t skip = 1;
-  std::unique_ptr<BackupFrame> ret(nullptr);
-  while (filepos + skip < d_filesize)
-  {
-    d_file.clear();
-    if (skip % 10 == 0)
-      std::cout << "\rChecking offset " << skip << " bytes" << std::flush;
-    d_file.seekg(filepos + skip, std::ios_base::beg);
-    ret.reset(getFrameBrute(skip++, previousframelength).release());
-    if (ret)
-    {
-      std::cout << std::endl << "Got frame, breaking" << std::endl;
-      break;
-    }
-  }
-  return ret;
-}
-
-std::unique_ptr<BackupFrame> FileDecryptor::getFrameBrute(uint64_t offset, uint32_t previousframelength)
-{
-  if (static_cast<uint64_t>(d_file.tellg()) == d_filesize)
-  {
-    std::cout << "Read entire backup file..." << std::endl;
-    return std::unique_ptr<BackupFrame>(nullptr);
-  }
-
-  if (d_headerframe)
-  {
-    std::unique_ptr<BackupFrame> frame(d_headerframe.release());
-    return frame;
-  }
-
-  uint32_t encryptedframelength = getNextFrameBlockSize();
-  if (encryptedframelength > 3145728/*= 3MB*/ /*115343360 / * =110MB*/ || encryptedframelength < 11)
-  {
-    //std::cout << "Framesize too big to be real" << std::endl;
-    return std::unique_ptr<BackupFrame>(nullptr);
-  }
-
-  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[encryptedframelength]);
-  if (!getNextFrameBlock(encryptedframe.get(), encryptedframelength))
-    return std::unique_ptr<BackupFrame>(nullptr);
-
-  // check hash
-  unsigned int digest_size = SHA256_DIGEST_LENGTH;
-  unsigned char hash[SHA256_DIGEST_LENGTH];
-  HMAC(EVP_sha256(), d_mackey, d_mackey_size, encryptedframe.get(), encryptedframelength - MACSIZE, hash, &digest_size);
-  if (std::memcmp(encryptedframe.get() + (encryptedframelength - MACSIZE), hash, MACSIZE) != 0)
-    return std::unique_ptr<BackupFrame>(nullptr);
-  else
-  {
-    std::cout << "" << std::endl;
-    std::cout << "GOT GOOD MAC AT OFFSET " << offset << " BYTES!" << std::endl;
-    std::cout << "Now let's try and find out how many frames we skipped to get here...." << std::endl;
-    d_badmac = false;
-  }
-
-  // decode
-  uint skipped = 0;
-  std::unique_ptr<BackupFrame> frame(nullptr);
-  while (!frame)
-  {
-
-    if (skipped > offset / 10) // a frame is at least 10 bytes? -> could probably safely set this higher. MAC alone is 10 bytes, there is also actual data
-    {
-      std::cout << std::endl << "No valid frame found at maximum frameskip for this offset..." << std::endl;
-      return std::unique_ptr<BackupFrame>(nullptr);
-    }
-
-    std::cout << "\rChecking if we skipped " << skipped << " frames... " << std::flush;
-
-    uintToFourBytes(d_iv, d_counter + skipped);
-
-    // create context
-    std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
-
-    // disable padding
-    EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
-
-    if (EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, d_iv) != 1)
+  std::cout << "Now let's try and find out how many frames we skipped to get here (at most " << maxskip << ")...." << std::endl;
+
+  unsigned int const workers = pool->size();
+  std::atomic<uint64_t> best(std::numeric_limits<uint64_t>::max());
+  std::vector<std::future<std::pair<uint64_t, std::unique_ptr<BackupFrame>>>> results;
+  results.reserve(workers);
+  for (unsigned int w = 0; w < workers; ++w)
+    results.emplace_back(pool->submit([&, w]()
     {
-      std::cout << "CTX INIT FAILED" << std::endl;
-      return std::unique_ptr<BackupFrame>(nullptr);
-    }
+      std::pair<uint64_t, std::unique_ptr<BackupFrame>> result(std::numeric_limits<uint64_t>::max(), nullptr);
 
-    int decodedframelength = encryptedframelength - MACSIZE;
-    unsigned char *decodedframe = new unsigned char[decodedframelength];
+      std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+      if (!ctx || EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, nullptr) != 1) [[unlikely]]
+      {
+        std::cout << "CTX INIT FAILED" << std::endl;
+        return result;
+      }
+      EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
 
-    if (EVP_DecryptUpdate(ctx.get(), decodedframe, &decodedframelength, encryptedframe.get(), encryptedframelength - MACSIZE) != 1)
-    {
-      std::cout << "Failed to decrypt data" << std::endl;
-      delete[] decodedframe;
-      return std::unique_ptr<BackupFrame>(nullptr);
-    }
+      std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+      std::memcpy(iv.get(), d_iv, d_iv_size);
 
-    DEBUGOUT("Decoded hex      : ", bepaald::bytesToHexString(decodedframe, decodedframelength));
+      int const decodedframelength = encryptedframelength - MACSIZE;
+      int const headlength = std::min(decodedframelength, 16);
+      std::unique_ptr<unsigned char[]> decodedframe(new unsigned char[decodedframelength]);
 
-    frame.reset(initBackupFrame(decodedframe, decodedframelength, d_framecount + skipped));
+      for (uint64_t skip = w; skip <= maxskip && skip < best.load(std::memory_order_relaxed); skip += workers)
+      {
+        // only set a new iv on the existing context, then decrypt just the first block...
+        uintToFourBytes(iv.get(), counter + skip);
+        int outlength = 0;
+        if (EVP_DecryptInit_ex(ctx.get(), nullptr, nullptr, nullptr, iv.get()) != 1 ||
+            EVP_DecryptUpdate(ctx.get(), decodedframe.get(), &outlength, encryptedframe, headlength) != 1) [[unlikely]]
+        {
+          std::cout << "Failed to decrypt data" << std::endl;
+          break;
+        }
 
-    delete[] decodedframe;
+        // ...which must start with a field that can start a frame (the header can only be the first frame)
+        unsigned int fieldnum = decodedframe[0] >> 3; // (a set high bit gives a fieldnum > 15, never valid)
+        unsigned int wiretype = BackupFrame::wiretype(decodedframe[0]);
+        if (fieldnum == BackupFrame::FRAMETYPE::END ? wiretype != BackupFrame::WIRETYPE::VARINT :
+            (fieldnum <= BackupFrame::FRAMETYPE::HEADER || fieldnum > BackupFrame::FRAMETYPE::KEYVALUE ||
+             wiretype != BackupFrame::WIRETYPE::LENGTHDELIM)) [[likely]]
+          continue;
+
+        if (decodedframelength > headlength &&
+            EVP_DecryptUpdate(ctx.get(), decodedframe.get() + headlength, &outlength,
+                              encryptedframe + headlength, decodedframelength - headlength) != 1) [[unlikely]]
+        {
+          std::cout << "Failed to decrypt data" << std::endl;
+          break;
+        }
 
-    ++skipped;
+        DEBUGOUT("Decoded hex      : ", bepaald::bytesToHexString(decodedframe.get(), decodedframelength));
 
-    if (!frame)
-    {
-      std::cout << "nope! :(" << std::flush;
-      //if (skipped >
-    }
-    else
-    {
-      if (frame->validate() &&
-          frame->frameType() != BackupFrame::FRAMETYPE::HEADER && // it is impossible to get in this function without the headerframe, and there is only one
-          (frame->frameType() != BackupFrame::FRAMETYPE::END || static_cast<uint64_t>(d_file.tellg()) == d_filesize))
-      {
-        d_counter += skipped;
-        d_framecount += skipped;
-        std::cout << "YEAH! :)" << std::endl;
-        if (d_assumebadframesize && skipped == 1 /*NOTE, skipped was already upped*/)
+        std::unique_ptr<BackupFrame> frame(initBackupFrame(decodedframe.get(), decodedframelength, framecount + skip));
+        if (frame && frame->validate() &&
+            (frame->frameType() != BackupFrame::FRAMETYPE::END || atend)) // an endframe must be at the end
         {
-          std::cout << std::endl << " ! CORRECT FRAME_NUMBER:SIZE = " << frame->frameNumber() - 1 << ":"
-                    << offset - previousframelength - MACSIZE - 4 << std::endl << std::endl;
+          result = {skip, std::move(frame)};
+          uint64_t current = best.load();
+          while (skip < current && !best.compare_exchange_weak(current, skip))
+          {}
+          break; // this worker only has larger skips left
         }
-        std::cout << "Good frame: " << frame->frameNumber() << " (" << frame->frameTypeString() << ")" << std::endl;
-        frame->printInfo();
-        delete[] encryptedframe.release();
-        break;
       }
-      std::cout << "nope! :(" << std::flush;
-      frame.reset();
-    }
-  }
+      return result;
+    }));
 
-  //frame->printInfo();
-  //std::cout << "HEADERTYPE: " << frame->frameType() << std::endl;
-
-  uint32_t attsize = 0;
-  if (!d_badmac && (attsize = frame->attachmentSize()) > 0 &&
-      (frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT ||
-       frame->frameType() == BackupFrame::FRAMETYPE::AVATAR ||
-       frame->frameType() == BackupFrame::FRAMETYPE::STICKER))
+  std::unique_ptr<BackupFrame> frame(nullptr);
+  for (auto &r : results)
   {
-    if (d_verbose) [[unlikely]]
-      std::cout << "Trying to read attachment (bruteforce)" << std::endl;
-
-    uintToFourBytes(d_iv, d_counter++);
-
-    reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(d_iv, d_iv_size, d_mackey, d_mackey_size, d_cipherkey, d_cipherkey_size, attsize, d_filename, d_file.tellg());
-
-    d_file.seekg(attsize + MACSIZE, std::ios_base::cur);
+    std::pair<uint64_t, std::unique_ptr<BackupFrame>> result(r.get());
+    if (result.second && result.first == best.load())
+    {
+      *skipped = result.first;
+      frame = std::move(result.second);
+    }
   }
-
-  //std::cout << "FILEPOS: " << d_file.tellg() << std::endl;
-
-  //delete frame;
   return frame;
 }
@@ -63,6 +63,45 @@ BackupFrame *FileDecryptor::initBackupFrame(unsigned char *data, size_t length,
       //std::cout << "ERROR: unexpected wiretype" << std::endl;
       return nullptr;
     }
-    return BackupFrame::instantiate(static_cast<BackupFrame::FRAMETYPE>(fieldnum), data + offset, datalength, count);
+
+    BackupFrame *frame = nullptr;
+    switch (static_cast<BackupFrame::FRAMETYPE>(fieldnum))
+    {
+      case BackupFrame::FRAMETYPE::SQLSTATEMENT: [[likely]]
+        frame = new SqlStatementFrame(data + offset, datalength, count);
+        break;
+      case BackupFrame::FRAMETYPE::ATTACHMENT:
+        frame = new AttachmentFrame(data + offset, datalength, count);
+        break;
+      case BackupFrame::FRAMETYPE::HEADER:
+        frame = new HeaderFrame(data + offset, datalength, count);
+        break;
+      case BackupFrame::FRAMETYPE::SHAREDPREFERENCE:
+        frame = new SharedPrefFrame(data + offset, datalength, count);
+        break;
+      case BackupFrame::FRAMETYPE::DATABASEVERSION:
+        frame = new DatabaseVersionFrame(data + offset, datalength, count);
+        break;
+      case BackupFrame::FRAMETYPE::AVATAR:
+        frame = new AvatarFrame(data + offset, datalength, count);
+        break;
+      case BackupFrame::FRAMETYPE::STICKER:
+        frame = new StickerFrame(data + offset, datalength, count);
+        break;
+      case BackupFrame::FRAMETYPE::KEYVALUE:
+        frame = new KeyValueFrame(data + offset, datalength, count);
+        break;
+      default: [[unlikely]]
+        //std::cout << "ERROR: Incorrect or unknown frametype (" << fieldnum << ")" << std::endl;
+        return nullptr;
+    }
+
+    if (!frame->ok()) [[unlikely]]
+    {
+      //std::cout << "ERROR: BackupFrame::ok() failed" << std::endl;
+      delete frame;
+      return nullptr;
+    }
+    return frame;
   }
 }
@@ -0,0 +1,60 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// Fills `keystreams' with the first keystream block for `count' counters starting at `counter'. In
+// CTR mode that block is just the encrypted iv, so they are all made with one ECB pass.
+bool FileDecryptor::initKeyStreams(uint64_t counter, uint64_t count, KeyStreams *keystreams) const
+{
+  std::vector<std::array<unsigned char, 16>> blocks(count);
+  for (uint64_t i = 0; i < count; ++i)
+  {
+    std::memcpy(blocks[i].data(), d_iv, 16);
+    uintToFourBytes(blocks[i].data(), counter + i);
+  }
+
+  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  int outlength = 0;
+  if (!ctx || EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_ecb(), nullptr, d_cipherkey, nullptr) != 1 ||
+      EVP_CIPHER_CTX_set_padding(ctx.get(), 0) != 1 ||
+      EVP_EncryptUpdate(ctx.get(), blocks.data()->data(), &outlength, blocks.data()->data(), count * 16) != 1) [[unlikely]]
+  {
+    std::cout << "Failed to create keystream" << std::endl;
+    return false;
+  }
+
+  // bucket on the first byte and the top two bits of the second: a length of at most 3MB
+  // (0x00300000) xor'ed with the keystream leaves those unchanged. The buckets are stored
+  // contiguously, scanning one should not have to jump all over the table.
+  keystreams->bucketstart.assign(1024 + 1, 0);
+  for (auto const &b : blocks)
+    ++keystreams->bucketstart[((b[0] << 2) | (b[1] >> 6)) + 1];
+  for (unsigned int i = 1; i < keystreams->bucketstart.size(); ++i)
+    keystreams->bucketstart[i] += keystreams->bucketstart[i - 1];
+  keystreams->keystreams.resize(count);
+  std::vector<uint32_t> next(keystreams->bucketstart.begin(), keystreams->bucketstart.end() - 1);
+  for (uint32_t skip = 0; skip < count; ++skip)
+  {
+    KeyStreams::KeyStream &k = keystreams->keystreams[next[(blocks[skip][0] << 2) | (blocks[skip][1] >> 6)]++];
+    k.skip = skip;
+    std::memcpy(k.bytes.data(), blocks[skip].data(), k.bytes.size());
+  }
+  return true;
+}
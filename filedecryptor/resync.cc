@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+
+// Searches a mapped backup file, starting after the damaged frame at `filepos' (which would have
+// been encrypted with `counter'), for the next frame that can be verified and decrypted. The
+// offsets are scanned in parallel, in rounds of a few chunks per thread. After each round the
+// earliest hit (if any) is decrypted, else the next round starts. Every so often the scanned
+// position is written to '<backupfile>.resync', an interrupted search for the same damaged frame
+// continues from there on the next run. On success *framepos, *framelength and *skipped (the
+// number of counters, frames or attachments, that were lost) describe the frame that was found.
+std::unique_ptr<BackupFrame> FileDecryptor::resync(MappedFile const &file, ThreadPool *pool, uint64_t filepos, uint64_t counter,
+                                                   uint64_t framecount, uint64_t *framepos, uint32_t *framelength, uint64_t *skipped) const
+{
+  unsigned char const *data = file.data();
+  uint64_t const size = std::min(file.size(), d_filesize);
+  uint64_t const roundsize = 4 * pool->size() * s_bruteforcechunk;
+
+  KeyStreams keystreams;
+  if (d_backupfileversion >= 1 &&
+      !initKeyStreams(counter, std::min(s_maxbruteskip, (size - std::min(size, filepos)) / 10 + 1), &keystreams)) [[unlikely]]
+    return std::unique_ptr<BackupFrame>(nullptr);
+
+  std::string const checkpointfile(d_filename + ".resync");
+  uint64_t start = filepos + 1;
+  {
+    std::ifstream checkpoint(checkpointfile);
+    uint64_t cp_filepos = 0, cp_counter = 0, cp_scanned = 0;
+    if (checkpoint >> cp_filepos >> cp_counter >> cp_scanned &&
+        cp_filepos == filepos && cp_counter == counter && cp_scanned > start && cp_scanned < size)
+    {
+      std::cout << "Resuming from checkpoint, offsets up to " << cp_scanned - filepos << " bytes were already checked" << std::endl;
+      start = cp_scanned;
+    }
+  }
+
+  auto const starttime = std::chrono::steady_clock::now();
+  auto lastcheckpoint = starttime;
+  uint64_t const firststart = start;
+  bool checkpointnoted = false;
+
+  while (start < size)
+  {
+    uint64_t const roundend = std::min(size, start + roundsize);
+    std::atomic<uint64_t> found(roundend);
+    std::vector<std::future<std::pair<uint64_t, uint64_t>>> results;
+    for (uint64_t begin = start; begin < roundend; begin += s_bruteforcechunk)
+      results.emplace_back(pool->submit([&, begin]()
+      {
+        uint64_t const end = std::min(roundend, begin + s_bruteforcechunk);
+        uint64_t skip = 0;
+        uint64_t const pos = d_backupfileversion >= 1 ?
+          scanForFrame(data, size, begin, end, filepos, keystreams, found, &skip) :
+          scanForMac(data, size, begin, end, found);
+        uint64_t current = found.load();
+        while (pos < end && pos < current && !found.compare_exchange_weak(current, pos))
+        {}
+        return std::make_pair(pos < end ? pos : roundend, skip);
+      }));
+
+    std::pair<uint64_t, uint64_t> hit(roundend, 0);
+    for (auto &r : results)
+      if (std::pair<uint64_t, uint64_t> result = r.get(); result.first < hit.first)
+        hit = result;
+
+    if (uint64_t const pos = hit.first; pos < roundend)
+    {
+      std::cout << "" << std::endl;
+      std::cout << "GOT GOOD MAC AT OFFSET " << pos - filepos << " BYTES!" << std::endl;
+
+      std::unique_ptr<BackupFrame> frame(nullptr);
+      uint32_t encryptedframelength = 0;
+      if (d_backupfileversion >= 1)
+      {
+        // the counter is already known here
+        frame.reset(getFrameAt(data, size, pos, counter + hit.second, framecount + hit.second, &encryptedframelength));
+        if (frame && (!frame->validate() ||
+                      (frame->frameType() == BackupFrame::FRAMETYPE::END && pos + 4 + encryptedframelength != size)))
+          frame.reset();
+        *skipped = hit.second;
+      }
+      else
+      {
+        std::memcpy(&encryptedframelength, data + pos, sizeof(decltype(encryptedframelength)));
+        encryptedframelength = bepaald::swap_endian<uint32_t>(encryptedframelength);
+        frame = getFrameBrute(data + pos + 4, encryptedframelength, counter, framecount,
+                              (pos - filepos) / 10, // a frame is at least 10 bytes (MAC alone is 10 bytes)
+                              pos + 4 + encryptedframelength == size, pool, skipped);
+      }
+
+      if (!frame)
+      {
+        std::cout << "No valid frame found at maximum frameskip for this offset..." << std::endl;
+        start = pos + 1;
+        continue;
+      }
+
+      std::remove(checkpointfile.c_str());
+      *framepos = pos;
+      *framelength = encryptedframelength;
+      return frame;
+    }
+
+    start = roundend;
+
+    auto const now = std::chrono::steady_clock::now();
+    double const seconds = std::chrono::duration<double>(now - starttime).count();
+    std::cout << "\rChecking offset " << start - filepos << " bytes (" << std::fixed << std::setprecision(1)
+              << 100.0 * start / size << "%, " << (seconds > 0 ? (start - firststart) / seconds / (1024 * 1024) : 0.0)
+              << " MB/s)" << std::defaultfloat << std::flush;
+
+    if (now - lastcheckpoint > std::chrono::seconds(10) && start < size)
+    {
+      std::ofstream checkpoint(checkpointfile, std::ios_base::trunc);
+      if (checkpoint << filepos << ' ' << counter << ' ' << start << '\n' && !checkpointnoted)
+      {
+        std::cout << std::endl << "(Saving progress to '" << checkpointfile << "', an interrupted search resumes from there)" << std::endl;
+        checkpointnoted = true;
+      }
+      lastcheckpoint = now;
+    }
+  }
+
+  std::remove(checkpointfile.c_str());
+  std::cout << std::endl << "Reached end of file without finding a valid frame" << std::endl;
+  return std::unique_ptr<BackupFrame>(nullptr);
+}
@@ -0,0 +1,265 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+#include <iomanip>
+
+#include "../fileencryptor/fileencryptor.h"
+
+// Rebuilds a valid backup from a damaged one: every frame that can still be verified (with its
+// attachment, if any) is written to `outputfile' in its original order, re-encrypted with
+// `passphrase'. The frames are first located by walking the file from the start, damaged parts are
+// skipped with resync(). Their offsets, counters and types are kept in '<backupfile>.salvage', so
+// an interrupted (or repeated) run does not have to find them again.
+bool FileDecryptor::salvage(std::string const &outputfile, std::string const &passphrase)
+{
+  HeaderFrame const *headerframe = dynamic_cast<HeaderFrame const *>(d_headerframe.get());
+  if (!d_ok || !headerframe) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " Salvaging needs a freshly opened backup file" << std::endl;
+    return false;
+  }
+
+  MappedFile file(d_filename);
+  if (!file.ok()) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " Failed to map '" << d_filename << "' into memory" << std::endl;
+    return false;
+  }
+  unsigned char const *data = file.data();
+  uint64_t const size = std::min(file.size(), d_filesize);
+
+  struct SalvagedFrame
+  {
+    uint64_t filepos;
+    uint64_t counter;
+    unsigned int type;
+    uint32_t length;
+    uint32_t attachmentsize;
+  };
+  std::vector<SalvagedFrame> frames;
+
+  // the first frame follows the unencrypted headerframe
+  uint32_t headerlength = 0;
+  std::memcpy(&headerlength, data, sizeof(decltype(headerlength)));
+  uint64_t pos = 4 + bepaald::swap_endian<uint32_t>(headerlength);
+  uint64_t counter = d_counter;
+  bool complete = false;
+
+  // load the frames found by a previous run
+  std::string const mapfile(d_filename + ".salvage");
+  {
+    std::ifstream in(mapfile);
+    uint64_t mapsize = 0;
+    if (in >> mapsize && mapsize == size)
+    {
+      std::string token;
+      SalvagedFrame f;
+      while (in >> token)
+      {
+        if (token == "END")
+          complete = true;
+        else if (token == "F" && in >> f.filepos >> f.counter >> f.type >> f.length >> f.attachmentsize)
+          frames.push_back(f);
+        else // probably the end of an interrupted write
+          break;
+      }
+      if (!frames.empty())
+      {
+        std::cout << "Loaded " << frames.size() << " frames from '" << mapfile << "'"
+                  << (complete ? "" : ", continuing search") << std::endl;
+        pos = frames.back().filepos + 4 + frames.back().length;
+        counter = frames.back().counter + 1;
+        if (frames.back().attachmentsize)
+        {
+          pos += frames.back().attachmentsize + MACSIZE;
+          ++counter;
+        }
+      }
+    }
+  }
+
+  if (!complete)
+  {
+    // rewrite what was loaded, dropping anything partial at the end
+    std::ofstream map(mapfile, std::ios_base::trunc);
+    map << size << '\n';
+    for (SalvagedFrame const &f : frames)
+      map << "F " << f.filepos << ' ' << f.counter << ' ' << f.type << ' ' << f.length << ' ' << f.attachmentsize << '\n';
+    if (!map)
+      std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " Failed to write '" << mapfile
+                << "', progress will not be saved" << std::endl;
+
+    std::cout << "Searching for good frames..." << std::endl;
+    ThreadPool pool;
+    while (pos < size)
+    {
+      uint32_t length = 0;
+      std::unique_ptr<BackupFrame> frame(getFrameAt(data, size, pos, counter, frames.size() + 1, &length));
+      if (!frame || !frame->validate() || frame->frameType() == BackupFrame::FRAMETYPE::HEADER) [[unlikely]]
+      {
+        std::cout << std::endl << "Damaged data at offset " << pos << ", searching for the next good frame..." << std::endl;
+        map.flush();
+        uint64_t framepos = 0;
+        uint64_t skipped = 0;
+        frame = resync(file, &pool, pos, counter, frames.size() + 1, &framepos, &length, &skipped);
+        if (!frame)
+          break;
+        std::cout << "Continuing at offset " << framepos << " (" << skipped << " frames lost)" << std::endl;
+        pos = framepos;
+        counter += skipped;
+      }
+
+      SalvagedFrame f{pos, counter, frame->frameType(), length, 0};
+      if (frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT ||
+          frame->frameType() == BackupFrame::FRAMETYPE::AVATAR ||
+          frame->frameType() == BackupFrame::FRAMETYPE::STICKER)
+        f.attachmentsize = frame->attachmentSize();
+      frames.push_back(f);
+      map << "F " << f.filepos << ' ' << f.counter << ' ' << f.type << ' ' << f.length << ' ' << f.attachmentsize << '\n';
+
+      pos += 4 + length;
+      ++counter;
+      if (f.attachmentsize)
+      {
+        pos += f.attachmentsize + MACSIZE;
+        ++counter;
+      }
+
+      if (frames.size() % 1000 == 0)
+        std::cout << "\rFRAME " << frames.size() << " (" << std::fixed << std::setprecision(1)
+                  << 100.0 * std::min(pos, size) / size << "%)..." << std::defaultfloat << std::flush;
+
+      if (f.type == BackupFrame::FRAMETYPE::END)
+        break;
+    }
+    map << "END" << std::endl;
+    std::cout << std::endl;
+  }
+
+  // write all good frames to the new file
+  std::cout << "Writing " << frames.size() << " frames to '" << outputfile << "'" << std::endl;
+
+  FileEncryptor fe(passphrase, headerframe->salt(), headerframe->salt_length(), headerframe->iv(), headerframe->iv_length(),
+                   headerframe->version(), d_verbose);
+  if (!fe.ok())
+  {
+    std::cout << "Error initializing FileEncryptor" << std::endl;
+    return false;
+  }
+
+  std::ofstream out(outputfile, std::ios_base::binary);
+  std::pair<unsigned char *, uint64_t> framedata = headerframe->getData();
+  uint32_t besize = bepaald::swap_endian(static_cast<uint32_t>(framedata.second));
+  bool writeok = framedata.first &&
+    out.write(reinterpret_cast<char *>(&besize), sizeof(uint32_t)) &&
+    out.write(reinterpret_cast<char *>(framedata.first), framedata.second);
+  delete[] framedata.first;
+
+  auto writeframe = [&](BackupFrame *frame, unsigned char *attachmentdata)
+  {
+    std::pair<unsigned char *, uint64_t> fd = frame->getData();
+    if (!fd.first) [[unlikely]]
+      return false;
+    std::pair<unsigned char *, uint64_t> encryptedframe = fe.encryptFrame(fd);
+    delete[] fd.first;
+    if (!encryptedframe.first || !out.write(reinterpret_cast<char *>(encryptedframe.first), encryptedframe.second)) [[unlikely]]
+    {
+      delete[] encryptedframe.first;
+      return false;
+    }
+    delete[] encryptedframe.first;
+
+    if (attachmentdata)
+    {
+      std::pair<unsigned char *, uint64_t> encryptedattachment = fe.encryptAttachment(attachmentdata, frame->attachmentSize());
+      bool attachmentok = encryptedattachment.first &&
+        out.write(reinterpret_cast<char *>(encryptedattachment.first), encryptedattachment.second);
+      delete[] encryptedattachment.first;
+      return attachmentok;
+    }
+    return true;
+  };
+
+  uint64_t expectedcounter = d_counter;
+  uint64_t lost = 0;
+  uint64_t badattachments = 0;
+  bool hasversion = false;
+  bool hasend = false;
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  std::memcpy(iv.get(), d_iv, d_iv_size);
+  for (uint64_t i = 0; writeok && i < frames.size(); ++i)
+  {
+    SalvagedFrame const &f = frames[i];
+    lost += f.counter - expectedcounter;
+    expectedcounter = f.counter + (f.attachmentsize ? 2 : 1);
+
+    uint32_t length = 0;
+    std::unique_ptr<BackupFrame> frame(getFrameAt(data, size, f.filepos, f.counter, i + 1, &length));
+    if (!frame || frame->frameType() != f.type || length != f.length) [[unlikely]]
+    {
+      std::cout << std::endl << bepaald::bold_on << "Error" << bepaald::bold_off << " Frame at offset " << f.filepos
+                << " no longer matches '" << mapfile << "'. Was the input changed? (Delete the file to start over)" << std::endl;
+      return false;
+    }
+
+    unsigned char *attachmentdata = nullptr;
+    if (f.attachmentsize)
+    {
+      uintToFourBytes(iv.get(), f.counter + 1);
+      reinterpret_cast<FrameWithAttachment *>(frame.get())->setLazyData(iv.get(), d_iv_size, d_attachmentcontext, f.attachmentsize, f.filepos + 4 + length);
+      bool badmac = false;
+      if (f.filepos + 4 + length + f.attachmentsize + MACSIZE > size ||
+          !(attachmentdata = reinterpret_cast<FrameWithAttachment *>(frame.get())->attachmentData(&badmac)))
+      {
+        ++badattachments;
+        continue;
+      }
+    }
+
+    hasversion |= (f.type == BackupFrame::FRAMETYPE::DATABASEVERSION);
+    hasend |= (f.type == BackupFrame::FRAMETYPE::END);
+    writeok = writeframe(frame.get(), attachmentdata);
+
+    if (i % 1000 == 0 || i == frames.size() - 1)
+      std::cout << "\rFRAME " << i + 1 << "/" << frames.size() << "..." << std::flush;
+  }
+
+  if (writeok && !hasend)
+  {
+    EndFrame endframe(nullptr, 1, frames.size() + 1);
+    writeok = writeframe(&endframe, nullptr);
+  }
+
+  if (!writeok)
+  {
+    std::cout << std::endl << bepaald::bold_on << "Error" << bepaald::bold_off << " Failed to write to '" << outputfile << "'" << std::endl;
+    return false;
+  }
+
+  std::cout << std::endl << "Done! Wrote " << out.tellp() << " bytes. Salvaged " << frames.size() - badattachments << " frames, "
+            << lost << " frames or attachments were lost to damaged data";
+  if (badattachments)
+    std::cout << ", " << badattachments << " frames were dropped for damaged attachment data";
+  std::cout << "." << std::endl;
+  if (!hasversion)
+    std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " The DatabaseVersionFrame was lost, the new backup will not be usable as is" << std::endl;
+  return true;
+}
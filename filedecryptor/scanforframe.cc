@@ -0,0 +1,91 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// Like scanForMac(), but for backup file versions where the frame length is encrypted. For every
+// offset, the counters it could have been encrypted with (each lost frame takes at least 10 bytes,
+// so up to (offset - filepos) / 10 of them were skipped) are tried with the precalculated
+// keystreams. Before any MAC is calculated, the decrypted length must be plausible and the start
+// of the frame must be a frame type whose own length matches it. On a hit, *skip is set to the
+// counter offset that was used.
+uint64_t FileDecryptor::scanForFrame(unsigned char const *data, uint64_t size, uint64_t begin, uint64_t end, uint64_t filepos,
+                                     KeyStreams const &keystreams, std::atomic<uint64_t> const &found, uint64_t *skip) const
+{
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  for (uint64_t pos = begin; pos < end && pos + 4 + 11 <= size; ++pos)
+  {
+    // (unlike in scanForMac(), most offsets are not cheap to reject here)
+    if (pos > found.load(std::memory_order_relaxed)) [[unlikely]]
+      return end;
+
+    uint64_t const maxskip = (pos - filepos) / 10;
+    unsigned int const bucket = (data[pos] << 2) | (data[pos + 1] >> 6);
+    for (uint32_t i = keystreams.bucketstart[bucket]; i < keystreams.bucketstart[bucket + 1]; ++i)
+    {
+      uint32_t const s = keystreams.keystreams[i].skip;
+      if (s > maxskip)
+        break;
+      unsigned char const *k = keystreams.keystreams[i].bytes.data();
+
+      uint32_t length = ((data[pos] ^ k[0]) << 24) | ((data[pos + 1] ^ k[1]) << 16) |
+        ((data[pos + 2] ^ k[2]) << 8) | (data[pos + 3] ^ k[3]);
+      if (length > s_maxbruteframesize || length < 11 || length > size - pos - 4) [[likely]]
+        continue;
+
+      // the frame is a single field: either the endframe's bool, or a message filling the rest of the frame
+      unsigned char const *frame = data + pos + 4;
+      uint32_t const framedatalength = length - MACSIZE;
+      unsigned char const head = frame[0] ^ k[4];
+      if (head == ((BackupFrame::FRAMETYPE::END << 3) | BackupFrame::WIRETYPE::VARINT))
+      {
+        if (framedatalength != 2 || (frame[1] ^ k[5]) != 1)
+          continue;
+      }
+      else
+      {
+        unsigned int fieldnum = head >> 3;
+        if (BackupFrame::wiretype(head) != BackupFrame::WIRETYPE::LENGTHDELIM ||
+            fieldnum <= BackupFrame::FRAMETYPE::HEADER || fieldnum > BackupFrame::FRAMETYPE::KEYVALUE ||
+            fieldnum == BackupFrame::FRAMETYPE::END) [[likely]]
+          continue;
+        uint64_t fieldlength = 0;
+        unsigned int varintsize = 0;
+        bool more = true;
+        while (more && varintsize < 5 && 1 + varintsize < framedatalength)
+        {
+          unsigned char b = frame[1 + varintsize] ^ k[5 + varintsize];
+          fieldlength |= static_cast<uint64_t>(b & 0x7f) << (7 * varintsize++);
+          more = b & 0x80;
+        }
+        if (more || 1 + varintsize + fieldlength != framedatalength) [[likely]]
+          continue;
+      }
+
+      unsigned int digest_size = SHA256_DIGEST_LENGTH;
+      if (HMAC(EVP_sha256(), d_mackey, d_mackey_size, data + pos, 4 + framedatalength, hash, &digest_size) &&
+          std::memcmp(frame + framedatalength, hash, MACSIZE) == 0)
+      {
+        *skip = s;
+        return pos;
+      }
+    }
+  }
+  return end;
+}
@@ -0,0 +1,80 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+// Returns the first offset in [begin, end) where an old style (unencrypted length) frame with a
+// valid MAC starts, or end if there is none. Gives up early once `found' (set by other workers
+// scanning other parts of the file) drops below the current offset.
+uint64_t FileDecryptor::scanForMac(unsigned char const *data, uint64_t size, uint64_t begin, uint64_t end,
+                                   std::atomic<uint64_t> const &found) const
+{
+  // one keyed context, re-initialized (with the same key) for every candidate
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
+  char digest[] = "SHA256";
+  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
+  if (!hctx || EVP_MAC_init(hctx.get(), d_mackey, d_mackey_size, params) != 1) [[unlikely]]
+#else
+  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
+  if (!hctx || HMAC_Init_ex(hctx.get(), d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1) [[unlikely]]
+#endif
+  {
+    std::cout << "Failed to initialize HMAC context" << std::endl;
+    return end;
+  }
+
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  for (uint64_t pos = begin; pos < end && pos + 4 < size; ++pos)
+  {
+    uint32_t encryptedframelength = 0;
+    std::memcpy(&encryptedframelength, data + pos, sizeof(decltype(encryptedframelength)));
+    encryptedframelength = bepaald::swap_endian<uint32_t>(encryptedframelength);
+
+    // nearly every offset is rejected here, before any hashing
+    if (encryptedframelength > s_maxbruteframesize || encryptedframelength < 11 ||
+        encryptedframelength > size - pos - 4) [[likely]]
+      continue;
+
+    if (pos > found.load(std::memory_order_relaxed))
+      return end;
+
+    unsigned char const *frame = data + pos + 4;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    std::size_t digest_size = 0;
+    if (EVP_MAC_init(hctx.get(), nullptr, 0, nullptr) != 1 ||
+        EVP_MAC_update(hctx.get(), frame, encryptedframelength - MACSIZE) != 1 ||
+        EVP_MAC_final(hctx.get(), hash, &digest_size, SHA256_DIGEST_LENGTH) != 1) [[unlikely]]
+#else
+    unsigned int digest_size = 0;
+    if (HMAC_Init_ex(hctx.get(), nullptr, 0, nullptr, nullptr) != 1 ||
+        HMAC_Update(hctx.get(), frame, encryptedframelength - MACSIZE) != 1 ||
+        HMAC_Final(hctx.get(), hash, &digest_size) != 1) [[unlikely]]
+#endif
+    {
+      std::cout << "Failed to calculate MAC" << std::endl;
+      return end;
+    }
+
+    if (std::memcmp(frame + (encryptedframelength - MACSIZE), hash, MACSIZE) == 0) [[unlikely]]
+      return pos;
+  }
+  return end;
+}
@@ -25,25 +25,36 @@
 #include <fstream>
 
 #include "../backupframe/backupframe.h"
+#include "../attachmentcache/attachmentcache.h"
 
 class FrameWithAttachment : public BackupFrame
 {
+ public:
+  // Everything a lazy frame needs to read its data that is identical for all frames from the
+  // same source: the file and the keys. One of these is shared by (potentially hundreds of
+  // thousands of) frames, each frame only holds its own iv and file offset.
+  struct SharedContext
+  {
+    std::string filename;
+    std::unique_ptr<unsigned char[]> mackey;
+    uint64_t mackey_size;
+    std::unique_ptr<unsigned char[]> cipherkey;
+    uint64_t cipherkey_size;
+  };
+
  protected:
-  unsigned char *d_attachmentdata;
+  static constexpr uint32_t s_max_iv_size = 16;
+
+  unsigned char *d_attachmentdata; // owned by this frame, lazily loaded data lives in AttachmentCache
   uint32_t d_attachmentdata_size;
+  uint16_t d_iv_size;
   uint64_t d_filepos;
-  uint32_t d_iv_size;
-  unsigned char *d_iv;
-  uint64_t d_mackey_size;
-  unsigned char *d_mackey;
-  uint64_t d_cipherkey_size;
-  unsigned char *d_cipherkey;
-  std::string d_filename;
+  std::shared_ptr<SharedContext const> d_context;
+  unsigned char d_iv[s_max_iv_size];
 
   //BaseDecryptor *d_dec; // DONT OWN THIS!
  public:
   inline explicit FrameWithAttachment(uint64_t count = 0);
-  inline FrameWithAttachment(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline FrameWithAttachment(FrameWithAttachment &&other);
   inline FrameWithAttachment &operator=(FrameWithAttachment &&other);
   inline FrameWithAttachment(FrameWithAttachment const &other);
@@ -51,21 +62,30 @@ class FrameWithAttachment : public BackupFrame
   inline virtual ~FrameWithAttachment();
   bool setAttachmentData(unsigned char *data) override;
   bool setAttachmentData(std::string const &filename);
-  inline unsigned char *iv() const;
+  inline unsigned char const *iv() const;
   inline uint32_t iv_size() const;
   inline uint64_t filepos() const;
   inline uint32_t length() const;
   inline void setLength(int32_t l);
-  inline unsigned char *mackey() const;
+  inline unsigned char const *mackey() const;
   inline uint64_t mackey_size() const;
-  inline unsigned char *cipherkey() const;
+  inline unsigned char const *cipherkey() const;
   inline uint64_t cipherkey_size() const;
   inline std::string const &filename() const;
-  inline void setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos);
+  inline void setLazyData(unsigned char const *iv, uint32_t iv_size, std::shared_ptr<SharedContext const> const &context, uint32_t attsize, uint64_t filepos);
   inline void setLazyDataRAW(uint32_t attsize, std::string const &filename);
   //inline virtual void setLazyData(unsigned char *iv, uint32_t iv_size, uint32_t attsize, uint64_t filepos, BaseDecryptor *dec);
   inline unsigned char *attachmentData(bool *badmac = nullptr);
+  inline bool needsData() const;
   inline void clearData();
+
+ private:
+  inline void forgetData();
+ public:
+
+  inline static std::shared_ptr<SharedContext const> makeSharedContext(std::string const &filename,
+                                                                       unsigned char const *mackey, uint64_t mackey_size,
+                                                                       unsigned char const *cipherkey, uint64_t cipherkey_size);
 };
 
 inline FrameWithAttachment::FrameWithAttachment(uint64_t count)
@@ -73,28 +93,8 @@ inline FrameWithAttachment::FrameWithAttachment(uint64_t count)
   BackupFrame(count),
   d_attachmentdata(nullptr),
   d_attachmentdata_size(0),
-  d_filepos(0),
   d_iv_size(0),
-  d_iv(nullptr),
-  d_mackey_size(0),
-  d_mackey(nullptr),
-  d_cipherkey_size(0),
-  d_cipherkey(nullptr)
-  //d_dec(nullptr)
-{}
-
-inline FrameWithAttachment::FrameWithAttachment(unsigned char *bytes, size_t length, uint64_t count)
-  :
-  BackupFrame(bytes, length, count),
-  d_attachmentdata(nullptr),
-  d_attachmentdata_size(0),
-  d_filepos(0),
-  d_iv_size(0),
-  d_iv(nullptr),
-  d_mackey_size(0),
-  d_mackey(nullptr),
-  d_cipherkey_size(0),
-  d_cipherkey(nullptr)
+  d_filepos(0)
   //d_dec(nullptr)
 {}
 
@@ -103,24 +103,19 @@ inline FrameWithAttachment::FrameWithAttachment(FrameWithAttachment &&other)
   BackupFrame(std::move(other)),
   d_attachmentdata(std::move(other.d_attachmentdata)),
   d_attachmentdata_size(std::move(other.d_attachmentdata_size)),
-  d_filepos(std::move(other.d_filepos)),
   d_iv_size(std::move(other.d_iv_size)),
-  d_iv(std::move(other.d_iv)),
-  d_mackey_size(std::move(other.d_mackey_size)),
-  d_mackey(std::move(other.d_mackey)),
-  d_cipherkey_size(std::move(other.d_cipherkey_size)),
-  d_cipherkey(std::move(other.d_cipherkey)),
-  d_filename(std::move(other.d_filename))
+  d_filepos(std::move(other.d_filepos)),
+  d_context(other.d_context)
 //d_dec(std::move(other.d_dec))
 {
+  std::memcpy(d_iv, other.d_iv, d_iv_size);
+
+  // cached data is keyed on the frame, take it along
+  if (d_context)
+    AttachmentCache::rekey(&other, this);
   other.d_attachmentdata = nullptr;
   other.d_attachmentdata_size = 0;
   other.d_iv_size = 0;
-  other.d_iv = nullptr;
-  other.d_mackey_size = 0;
-  other.d_mackey = nullptr;
-  other.d_cipherkey_size = 0;
-  other.d_cipherkey = nullptr;
   //other.d_dec = nullptr;
 }
 
@@ -128,31 +123,22 @@ inline FrameWithAttachment &FrameWithAttachment::operator=(FrameWithAttachment &
 {
   if (this != &other)
   {
-    bepaald::destroyPtr(&d_attachmentdata, &d_attachmentdata_size);
-    bepaald::destroyPtr(&d_iv, &d_iv_size);
-    bepaald::destroyPtr(&d_mackey, &d_mackey_size);
-    bepaald::destroyPtr(&d_cipherkey, &d_cipherkey_size);
+    forgetData();
 
     BackupFrame::operator=(std::move(other));
-    d_attachmentdata = std::move(other.d_attachmentdata);
+    d_attachmentdata = other.d_attachmentdata;
     d_attachmentdata_size = std::move(other.d_attachmentdata_size);
-    d_filepos = std::move(other.d_filepos);
     d_iv_size = std::move(other.d_iv_size);
-    d_iv = std::move(other.d_iv);
-    d_mackey_size = std::move(other.d_mackey_size);
-    d_mackey = std::move(other.d_mackey);
-    d_cipherkey_size = std::move(other.d_cipherkey_size);
-    d_cipherkey = std::move(other.d_cipherkey);
+    std::memcpy(d_iv, other.d_iv, d_iv_size);
+    d_filepos = std::move(other.d_filepos);
+    d_context = other.d_context;
     //d_dec = std::move(other.d_dec);
 
+    if (d_context)
+      AttachmentCache::rekey(&other, this);
     other.d_attachmentdata = nullptr;
     other.d_attachmentdata_size = 0;
-    other.d_iv = nullptr;
     other.d_iv_size = 0;
-    other.d_mackey_size = 0;
-    other.d_mackey = nullptr;
-    other.d_cipherkey_size = 0;
-    other.d_cipherkey = nullptr;
     //other.d_dec = nullptr;
   }
   return *this;
@@ -163,55 +149,32 @@ inline FrameWithAttachment::FrameWithAttachment(FrameWithAttachment const &other
   BackupFrame(other),
   d_attachmentdata(nullptr),
   d_attachmentdata_size(other.d_attachmentdata_size),
-  d_filepos(other.d_filepos),
   d_iv_size(other.d_iv_size),
-  d_iv(nullptr),
-  d_mackey_size(other.d_mackey_size),
-  d_mackey(nullptr),
-  d_cipherkey_size(other.d_cipherkey_size),
-  d_cipherkey(nullptr)
+  d_filepos(other.d_filepos),
+  d_context(other.d_context)
   //d_dec(other.d_dec)
 {
+  std::memcpy(d_iv, other.d_iv, d_iv_size);
+
   if (other.d_attachmentdata)
   {
     d_attachmentdata = new unsigned char[d_attachmentdata_size];
     std::memcpy(d_attachmentdata, other.d_attachmentdata, d_attachmentdata_size);
   }
-
-  if (other.d_iv)
-  {
-    d_iv = new unsigned char[d_iv_size];
-    std::memcpy(d_iv, other.d_iv, d_iv_size);
-  }
-
-  if (other.d_mackey)
-  {
-    d_mackey = new unsigned char[d_mackey_size];
-    std::memcpy(d_mackey, other.d_mackey, d_mackey_size);
-  }
-
-  if (other.d_cipherkey)
-  {
-    d_cipherkey = new unsigned char[d_cipherkey_size];
-    std::memcpy(d_cipherkey, other.d_cipherkey, d_cipherkey_size);
-  }
 }
 
 inline FrameWithAttachment &FrameWithAttachment::operator=(FrameWithAttachment const &other)
 {
   if (this != &other)
   {
-    bepaald::destroyPtr(&d_attachmentdata, &d_attachmentdata_size);
-    bepaald::destroyPtr(&d_iv, &d_iv_size);
-    bepaald::destroyPtr(&d_mackey, &d_mackey_size);
-    bepaald::destroyPtr(&d_cipherkey, &d_cipherkey_size);
+    forgetData();
 
     BackupFrame::operator=(other);
     d_attachmentdata_size = other.d_attachmentdata_size;
     d_iv_size = other.d_iv_size;
-    d_mackey_size = other.d_mackey_size;
-    d_cipherkey_size = other.d_cipherkey_size;
+    std::memcpy(d_iv, other.d_iv, d_iv_size);
     d_filepos = other.d_filepos;
+    d_context = other.d_context;
     //d_dec = other.d_dec;
 
     if (other.d_attachmentdata)
@@ -219,39 +182,18 @@ inline FrameWithAttachment &FrameWithAttachment::operator=(FrameWithAttachment c
       d_attachmentdata = new unsigned char[d_attachmentdata_size];
       std::memcpy(d_attachmentdata, other.d_attachmentdata, d_attachmentdata_size);
     }
-
-    if (other.d_iv)
-    {
-      d_iv = new unsigned char[d_iv_size];
-      std::memcpy(d_iv, other.d_iv, d_iv_size);
-    }
-
-    if (other.d_mackey)
-    {
-      d_mackey = new unsigned char[d_mackey_size];
-      std::memcpy(d_mackey, other.d_mackey, d_mackey_size);
-    }
-
-    if (other.d_cipherkey)
-    {
-      d_cipherkey = new unsigned char[d_cipherkey_size];
-      std::memcpy(d_cipherkey, other.d_cipherkey, d_cipherkey_size);
-    }
   }
   return *this;
 }
 
 inline FrameWithAttachment::~FrameWithAttachment()
 {
-  bepaald::destroyPtr(&d_attachmentdata, &d_attachmentdata_size);
-  bepaald::destroyPtr(&d_iv, &d_iv_size);
-  bepaald::destroyPtr(&d_mackey, &d_mackey_size);
-  bepaald::destroyPtr(&d_cipherkey, &d_cipherkey_size);
+  forgetData();
 }
 
-inline unsigned char *FrameWithAttachment::iv() const
+inline unsigned char const *FrameWithAttachment::iv() const
 {
-  return d_iv;
+  return d_iv_size ? d_iv : nullptr;
 }
 
 inline uint32_t FrameWithAttachment::iv_size() const
@@ -269,62 +211,50 @@ inline uint32_t FrameWithAttachment::length() const
   return d_attachmentdata_size;
 }
 
-inline unsigned char *FrameWithAttachment::mackey() const
+inline unsigned char const *FrameWithAttachment::mackey() const
 {
-  return d_mackey;
+  return d_context ? d_context->mackey.get() : nullptr;
 }
 
 inline uint64_t FrameWithAttachment::mackey_size() const
 {
-  return d_mackey_size;
+  return d_context ? d_context->mackey_size : 0;
 }
 
-inline unsigned char *FrameWithAttachment::cipherkey() const
+inline unsigned char const *FrameWithAttachment::cipherkey() const
 {
-  return d_cipherkey;
+  return d_context ? d_context->cipherkey.get() : nullptr;
 }
 
 inline uint64_t FrameWithAttachment::cipherkey_size() const
 {
-  return d_cipherkey_size;
+  return d_context ? d_context->cipherkey_size : 0;
 }
 
 inline std::string const &FrameWithAttachment::filename() const
 {
-  return d_filename;
+  static std::string const empty;
+  return d_context ? d_context->filename : empty;
 }
 
-inline void FrameWithAttachment::setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos/*, BaseDecryptor *dec*/)
+inline void FrameWithAttachment::setLazyData(unsigned char const *iv, uint32_t iv_size, std::shared_ptr<SharedContext const> const &context, uint32_t attsize, uint64_t filepos/*, BaseDecryptor *dec*/)
 {
-  bepaald::destroyPtr(&d_attachmentdata, &d_attachmentdata_size);
-  bepaald::destroyPtr(&d_iv, &d_iv_size);
-  bepaald::destroyPtr(&d_mackey, &d_mackey_size);
-  bepaald::destroyPtr(&d_cipherkey, &d_cipherkey_size);
+  forgetData();
+  d_attachmentdata_size = 0;
 
-  d_iv_size = iv_size;
-  if (iv)
+  if (iv_size > s_max_iv_size) [[unlikely]]
   {
-    d_iv = new unsigned char[d_iv_size];
-    std::memcpy(d_iv, iv, d_iv_size);
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+              << ": Unexpected iv size (" << iv_size << ")" << std::endl;
+    iv = nullptr;
   }
 
-  d_cipherkey_size = cipherkey_size;
-  if (cipherkey)
-  {
-    d_cipherkey = new unsigned char[d_cipherkey_size];
-    std::memcpy(d_cipherkey, cipherkey, d_cipherkey_size);
-  }
-
-  d_mackey_size = mackey_size;
-  if (mackey)
-  {
-    d_mackey = new unsigned char[d_mackey_size];
-    std::memcpy(d_mackey, mackey, d_mackey_size);
-  }
+  d_iv_size = iv ? iv_size : 0;
+  if (iv)
+    std::memcpy(d_iv, iv, d_iv_size);
 
+  d_context = context;
   d_attachmentdata_size = attsize;
-
-  d_filename = filename;
   d_filepos = filepos;
 
   //d_dec = dec;
@@ -332,31 +262,74 @@ inline void FrameWithAttachment::setLazyData(unsigned char *iv, uint32_t iv_size
 
 inline void FrameWithAttachment::setLazyDataRAW(uint32_t attsize, std::string const &filename)
 {
-  setLazyData(nullptr, 0, // iv, iv_size
-              nullptr, 0, // mackey, mackey_size
-              nullptr, 0, // cipherkey, cipherkey_size
-              attsize,    // attachment size
-              filename,   // filename
-              0);         // filepos
+  setLazyData(nullptr, 0,                                         // iv, iv_size
+              makeSharedContext(filename, nullptr, 0, nullptr, 0), // context (no keys)
+              attsize,                                            // attachment size
+              0);                                                 // filepos
+}
+
+inline std::shared_ptr<FrameWithAttachment::SharedContext const>
+FrameWithAttachment::makeSharedContext(std::string const &filename, unsigned char const *mackey, uint64_t mackey_size,
+                                       unsigned char const *cipherkey, uint64_t cipherkey_size) // static
+{
+  auto context = std::make_shared<SharedContext>();
+  context->filename = filename;
+  context->mackey_size = mackey ? mackey_size : 0;
+  if (mackey)
+  {
+    context->mackey.reset(new unsigned char[mackey_size]);
+    std::memcpy(context->mackey.get(), mackey, mackey_size);
+  }
+  context->cipherkey_size = cipherkey ? cipherkey_size : 0;
+  if (cipherkey)
+  {
+    context->cipherkey.reset(new unsigned char[cipherkey_size]);
+    std::memcpy(context->cipherkey.get(), cipherkey, cipherkey_size);
+  }
+  return context;
 }
 
+// Data that is lazily loaded is handed out from AttachmentCache, pinned for this caller until
+// the matching clearData(), so frames can be read from multiple threads at once. Every call
+// that returns non-null data must be paired with exactly one clearData() (or the data stays
+// pinned until the frame is destroyed). Data owned by the frame itself (set explicitly, or
+// loaded with a bad mac) is not reference counted: clearData() frees it for all callers.
 inline unsigned char *FrameWithAttachment::attachmentData(bool *badmac)
 {
-  if (!d_attachmentdata)
+  if (d_attachmentdata)
+    return d_attachmentdata;
+
+  if (!d_context) [[unlikely]]
+    return nullptr;
+
+  if (unsigned char *data = AttachmentCache::acquire(this))
+    return data;
+
+  std::unique_ptr<unsigned char[]> data;
+  int result = BaseDecryptor::decryptAttachment(this, d_attachmentdata_size, &data);
+  if (result == 0 && data) [[likely]]
+    return AttachmentCache::insert(this, data.release(), d_attachmentdata_size);
+
+  if (result == -1) [[unlikely]]
   {
-    int result = BaseDecryptor::getAttachment(this);
-    if (result == -1) [[unlikely]]
-    {
-      if (badmac)
-        *badmac = true;
-      return nullptr;
-    }
-    if (result == 1) [[unlikely]]
-      return nullptr;
+    // never cache data that failed verification (a later cache hit could not report the bad mac
+    // again), the frame keeps it, as it always did
+    d_attachmentdata = data.release();
+    if (badmac)
+      *badmac = true;
   }
-  return d_attachmentdata;
+  return nullptr;
 }
 
+// true if attachmentData() would have to read the data from file (it is lazily loaded, and
+// neither loaded nor cached at the moment)
+inline bool FrameWithAttachment::needsData() const
+{
+  return !d_attachmentdata && d_context && !AttachmentCache::contains(this);
+}
+
+// drops one caller's hold on the data. Data owned by the frame is freed, cached data is
+// released to the cache (which may keep it around for the next call to attachmentData())
 inline void FrameWithAttachment::clearData()
 {
   if (d_attachmentdata) // do not use bepaald::destroyPtr, it will set size to zero
@@ -364,6 +337,16 @@ inline void FrameWithAttachment::clearData()
     delete[] d_attachmentdata;
     d_attachmentdata = nullptr;
   }
+  else if (d_context)
+    AttachmentCache::release(this);
+}
+
+// as clearData(), but also drops any cached copy (the frame is going away, or its data changes)
+inline void FrameWithAttachment::forgetData()
+{
+  clearData();
+  if (d_context)
+    AttachmentCache::erase(this);
 }
 
 #endif
@@ -23,6 +23,7 @@ bool FrameWithAttachment::setAttachmentData(unsigned char *data) // override
 {
   if (!data)
     return false;
+  forgetData();
   d_attachmentdata = data;
   d_attachmentdata_size = length();
   return true;
@@ -37,6 +38,7 @@ bool FrameWithAttachment::setAttachmentData(std::string const &filename) // over
               << ": Setting attachment data. Failed to open '" << filename << "' for reading" << std::endl;
     return false;
   }
+  forgetData();
   file.seekg(0, std::ios_base::end);
   d_attachmentdata_size = file.tellg();
   if (d_attachmentdata_size == 0)
@@ -33,7 +33,9 @@ class HeaderFrame : public BackupFrame
    VERSION = 3 // uint32
   };
 
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 3> s_fields{{{FIELD::IV, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::SALT, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::VERSION, WIRETYPE::VARINT, false}}};
 
  public:
   inline explicit HeaderFrame(uint64_t count = 0);
@@ -45,7 +47,6 @@ class HeaderFrame : public BackupFrame
   inline unsigned char *salt() const;
   inline uint64_t salt_length() const;
   inline uint32_t version() const;
-  inline static BackupFrame *create(unsigned char *data, size_t length, uint64_t count = 0);
   //inline static BackupFrame *createFromHumanData(std::ifstream *datastream, uint64_t count = 0);
   inline virtual void printInfo() const override;
   inline std::pair<unsigned char *, uint64_t> getData() const override;
@@ -63,9 +64,10 @@ inline HeaderFrame::HeaderFrame(uint64_t count)
 
 inline HeaderFrame::HeaderFrame(unsigned char *data, size_t length, uint64_t count)
   :
-  BackupFrame(data, length, count)
+  BackupFrame(count)
 {
-  d_ok = iv_length() == 16;
+  d_constructedsize = length;
+  d_ok = init<s_fields>(data, length, &d_framedata) && iv_length() == 16;
 }
 
 inline BackupFrame::FRAMETYPE HeaderFrame::frameType() const // virtual override
@@ -113,11 +115,6 @@ inline uint32_t HeaderFrame::version() const
   return 0;
 }
 
-inline BackupFrame *HeaderFrame::create(unsigned char *data, size_t length, uint64_t count) // static
-{
-  return new HeaderFrame(data, length, count);
-}
-
 inline void HeaderFrame::printInfo() const
 {
   //DEBUGOUT("TYPE: HEADERFRAME");
@@ -24,7 +24,6 @@
 
 class InvalidFrame : public BackupFrame
 {
-  static Registrar s_registrar;
  public:
   inline InvalidFrame(uint64_t count = 0);
   inline virtual ~InvalidFrame() = default;
@@ -37,12 +37,17 @@ class KeyValueFrame : public BackupFrame
     STRINGVALUE = 7   // string
   };
 
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 7> s_fields{{{FIELD::KEY, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::BLOBVALUE, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::BOOLEANVALUE, WIRETYPE::VARINT, false},
+                                                      {FIELD::FLOATVALUE, WIRETYPE::FIXED32, false},
+                                                      {FIELD::INTEGERVALUE, WIRETYPE::VARINT, false},
+                                                      {FIELD::LONGVALUE, WIRETYPE::VARINT, false},
+                                                      {FIELD::STRINGVALUE, WIRETYPE::LENGTHDELIM, false}}};
  public:
   inline explicit KeyValueFrame(uint64_t count = 0);
   inline KeyValueFrame(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual ~KeyValueFrame() = default;
-  inline static BackupFrame *create(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual void printInfo() const override;
   inline virtual FRAMETYPE frameType() const override;
   inline std::pair<unsigned char *, uint64_t> getData() const override;
@@ -62,12 +67,10 @@ inline KeyValueFrame::KeyValueFrame(uint64_t count)
 
 inline KeyValueFrame::KeyValueFrame(unsigned char *bytes, size_t length, uint64_t count)
   :
-  BackupFrame(bytes, length, count)
-{}
-
-inline BackupFrame *KeyValueFrame::create(unsigned char *bytes, size_t length, uint64_t count)
+  BackupFrame(count)
 {
-  return new KeyValueFrame(bytes, length, count);
+  d_constructedsize = length;
+  d_ok = init<s_fields>(bytes, length, &d_framedata);
 }
 
 inline void KeyValueFrame::printInfo() const // virtual
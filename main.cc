@@ -22,8 +22,11 @@
 #include <vector>
 
 #include "arg/arg.h"
+#include "attachmentcache/attachmentcache.h"
 #include "common_be.h"
 #include "main.h"
+#include "phasestats/phasestats.h"
+#include "trace/trace.h"
 #include "signalbackup/signalbackup.h"
 #include "sqlcipherdecryptor/sqlcipherdecryptor.h"
 
@@ -75,6 +78,18 @@ int main(int argc, char *argv[])
     return 0;
   }
 
+  if (!arg.attachmentcache().empty())
+  {
+    uint64_t cachebudget = 0;
+    if (!bepaald::parseByteSize(arg.attachmentcache(), &cachebudget))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": "
+                << "Invalid size for `--attachmentcache': '" << arg.attachmentcache() << "'" << std::endl;
+      return 1;
+    }
+    AttachmentCache::setBudget(cachebudget);
+  }
+
   bool ipw_interactive = false;
   if ((arg.passphrase().empty() || arg.interactive()) && // prompt for input passphrase
       !bepaald::isDir(arg.input()))
@@ -136,6 +151,26 @@ int main(int argc, char *argv[])
     return 1;
   }
 
+  // timing and resource statistics, printed when statsreport goes out of scope at the end of main
+  if (!arg.stats().empty() && arg.stats() != "text" && arg.stats() != "json")
+  {
+    std::cout << "Error: unknown format for `--stats': `" << arg.stats() << "' (expected `text' or `json')" << std::endl;
+    return 1;
+  }
+  if (!arg.statsfile().empty() && arg.stats().empty())
+  {
+    std::cout << "Error: `--statsfile' requires `--stats'" << std::endl;
+    return 1;
+  }
+  if (!arg.stats().empty())
+    PhaseStats::enable();
+  PhaseStats::Report statsreport(arg.stats() == "json", arg.statsfile());
+
+  // timeline of hot-path spans, written when tracewriter goes out of scope
+  if (!arg.trace().empty())
+    Trace::enable();
+  Trace::Writer tracewriter(arg.trace());
+
   // temporary. REMOVE THIS
   if (arg.strugee() != -1)
   {
@@ -166,15 +201,42 @@ int main(int argc, char *argv[])
     return 0;
   }
 
+  if (arg.salvage())
+  {
+    if (arg.output().empty())
+    {
+      std::cout << "Error: `--salvage' requires an output file (`-o')" << std::endl;
+      return 1;
+    }
+    FileDecryptor fd(arg.input(), arg.passphrase(), arg.verbose(), false, false);
+    if (!fd.ok() || !fd.salvage(arg.output(), arg.opassphrase().empty() ? arg.passphrase() : arg.opassphrase()))
+    {
+      std::cout << "Failed to salvage backup" << std::endl;
+      return 1;
+    }
+    return 0;
+  }
+
   MEMINFO("Start of program, before opening input");
 
   // open input
   if (arg.verbose()) [[unlikely]]
     std::cout << "Opening input" << std::endl;
+  // when none of the requested operations change the backup, an input directory can be read in place
+  bool readonlyinput = arg.source().empty() && !arg.importfromdesktop_bool() && !arg.removedoubles() &&
+    arg.croptodates().empty() && arg.croptothreads().empty() && arg.croptothreadsbyname().empty() &&
+    arg.mergerecipients().empty() && arg.mergegroups().empty() && !arg.deleteattachments() &&
+    arg.replaceattachments().empty() && !arg.replaceattachments_bool() &&
+    arg.runsqlquery().empty() && arg.runprettysqlquery().empty() &&
+    !arg.scramble() && !arg.reordermmssmsids() && !arg.migratedb();
+  // exportHtml() and exportTxt() always migrate a version 167 database, which needs the in-memory copy
+  if (readonlyinput && (!arg.exporthtml().empty() || !arg.exporttxt().empty()) &&
+      bepaald::isDir(arg.input()) && SignalBackup::dirDatabaseVersion(arg.input()) == 167)
+    readonlyinput = false;
   std::unique_ptr<SignalBackup> sb(new SignalBackup(arg.input(), arg.passphrase(), arg.verbose(), arg.showprogress(),
                                                     arg.replaceattachments_bool(),
                                                     arg.assumebadframesizeonbadmac(), arg.editattachmentsize(),
-                                                    arg.stoponerror()));
+                                                    arg.stoponerror(), readonlyinput));
   if (!sb->ok())
   {
     std::cout << "Failed to open backup" << std::endl;
@@ -327,7 +389,7 @@ int main(int argc, char *argv[])
   }
 
   if (!arg.dumpmedia().empty())
-    if (!sb->dumpMedia(arg.dumpmedia(), limittothreads, arg.overwrite()))
+    if (!sb->dumpMedia(arg.dumpmedia(), limittothreads, arg.overwrite(), arg.dedupmedia()))
       return 1;
 
   if (!arg.dumpavatars().empty())
@@ -355,7 +417,7 @@ int main(int argc, char *argv[])
   if (!arg.exporthtml().empty())
     if (!sb->exportHtml(arg.exporthtml(), limittothreads, arg.limittodates(), (arg.split_bool() ? arg.split() : -1),
                         arg.setselfid(), arg.includecalllog(), arg.searchpage(), arg.migratedb(), arg.overwrite(),
-                        arg.append(), arg.light(), arg.themeswitching()))
+                        arg.append(), arg.light(), arg.themeswitching(), arg.dedupmedia()))
       return 1;
 
   if (!arg.exporttxt().empty())
@@ -434,7 +496,7 @@ int main(int argc, char *argv[])
   if (!arg.output().empty())
   {
     sb->checkDbIntegrity(true);
-    if (!sb->exportBackup(arg.output(), arg.opassphrase(), arg.overwrite(), SignalBackup::DROPATTACHMENTDATA, arg.onlydb()))
+    if (!sb->exportBackup(arg.output(), arg.opassphrase(), arg.overwrite(), SignalBackup::DROPATTACHMENTDATA, arg.onlydb(), arg.dedupmedia()))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": "
                 << "Failed to export backup to '" << arg.output() << "'" << std::endl;
@@ -460,6 +522,14 @@ int main(int argc, char *argv[])
 
   MEMINFO("At program end");
 
+  if (arg.verbose() || !arg.attachmentcache().empty())
+  {
+    AttachmentCache::Stats cachestats = AttachmentCache::stats();
+    std::cout << "Attachment cache: " << cachestats.hits << " hits, " << cachestats.misses << " misses, "
+              << cachestats.prefetched << " prefetched, " << cachestats.evictions << " evictions, peak usage " << cachestats.peak / 1024 << " KiB (budget "
+              << AttachmentCache::budget() / 1024 << " KiB)" << std::endl;
+  }
+
   return 0;
 }
 
@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <cstdint>
+#include <string>
+
+#if defined(_WIN32) || defined(__MINGW64__)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Read-only view of an entire file, for the few places that need random access to all of it
+// (eg. scanning a damaged backup for frames) and would otherwise spend most of their time in
+// seekg()/read(). On failure data() is nullptr and ok() is false.
+class MappedFile
+{
+  unsigned char const *d_data;
+  uint64_t d_size;
+#if defined(_WIN32) || defined(__MINGW64__)
+  HANDLE d_file;
+  HANDLE d_mapping;
+#endif
+
+ public:
+  inline explicit MappedFile(std::string const &filename);
+  MappedFile(MappedFile const &other) = delete;
+  MappedFile &operator=(MappedFile const &other) = delete;
+  inline ~MappedFile();
+  inline bool ok() const;
+  inline unsigned char const *data() const;
+  inline uint64_t size() const;
+};
+
+#if defined(_WIN32) || defined(__MINGW64__) // this is untested, I don't have windows
+
+inline MappedFile::MappedFile(std::string const &filename)
+  :
+  d_data(nullptr),
+  d_size(0),
+  d_file(INVALID_HANDLE_VALUE),
+  d_mapping(nullptr)
+{
+  d_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (d_file == INVALID_HANDLE_VALUE)
+    return;
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(d_file, &size) || size.QuadPart == 0)
+    return;
+  d_mapping = CreateFileMappingA(d_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!d_mapping)
+    return;
+  d_data = static_cast<unsigned char const *>(MapViewOfFile(d_mapping, FILE_MAP_READ, 0, 0, 0));
+  if (d_data)
+    d_size = size.QuadPart;
+}
+
+inline MappedFile::~MappedFile()
+{
+  if (d_data)
+    UnmapViewOfFile(d_data);
+  if (d_mapping)
+    CloseHandle(d_mapping);
+  if (d_file != INVALID_HANDLE_VALUE)
+    CloseHandle(d_file);
+}
+
+#else
+
+inline MappedFile::MappedFile(std::string const &filename)
+  :
+  d_data(nullptr),
+  d_size(0)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    return;
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      d_data = static_cast<unsigned char const *>(p);
+      d_size = st.st_size;
+      // the view stays valid after closing the descriptor
+    }
+  }
+  close(fd);
+}
+
+inline MappedFile::~MappedFile()
+{
+  if (d_data)
+    munmap(const_cast<unsigned char *>(d_data), d_size);
+}
+
+#endif
+
+inline bool MappedFile::ok() const
+{
+  return d_data != nullptr;
+}
+
+inline unsigned char const *MappedFile::data() const
+{
+  return d_data;
+}
+
+inline uint64_t MappedFile::size() const
+{
+  return d_size;
+}
+
+#endif
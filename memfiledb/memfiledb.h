@@ -31,20 +31,39 @@
 
 class MemFileDB
 {
+ public:
+  // provides the file data on demand, instead of from one buffer in memory
+  class PageSource
+  {
+   public:
+    virtual ~PageSource() = default;
+    virtual uint64_t size() const = 0;
+    virtual bool read(unsigned char *buffer, uint64_t offset, uint64_t size) = 0;
+  };
+
+ private:
   struct MemFile
   {
     sqlite3_file base; // Base class. Must be first.
     unsigned char *data;
     uint64_t datasize;
+    PageSource *source; // if set, data is read from here (and 'data' is unused)
   };
   static sqlite3_vfs s_memfilevfs;
+  static sqlite3_vfs s_pagesourcevfs;
   static char constexpr s_name[] = {'M', 'e', 'm', 'f', 'i', 'l', 'e', 'V', 'F', 'S', '\0'};
+  static char constexpr s_pagesourcename[] = {'P', 'a', 'g', 'e', 's', 'o', 'u', 'r', 'c', 'e', 'V', 'F', 'S', '\0'};
  public:
   static sqlite3_vfs *sqlite3_memfilevfs(std::pair<unsigned char *, uint64_t> *data);
+  static sqlite3_vfs *sqlite3_pagesourcevfs(PageSource *source);
   static char const *vfsName()
   {
     return s_name;
   }
+  static char const *pageSourceVfsName()
+  {
+    return s_pagesourcename;
+  }
  private:
   static int ioWrite(sqlite3_file *, void const *, int, sqlite_int64);
   static int ioClose(sqlite3_file *pFile);
@@ -59,8 +78,10 @@ class MemFileDB
   static int ioSectorSize(sqlite3_file *pFile);
   static int ioDeviceCharacteristics(sqlite3_file *pFile);
   static int open(sqlite3_vfs *pVfs, char const *zName, sqlite3_file *pFile, int flags, int *pOutFlags);
+  static int openPageSource(sqlite3_vfs *pVfs, char const *zName, sqlite3_file *pFile, int flags, int *pOutFlags);
   static int del(sqlite3_vfs *pVfs, char const *zPath, int dirSync);
   static int access(sqlite3_vfs *pVfs, char const *zPath, int flags, int *pResOut);
+  static int accessPageSource(sqlite3_vfs *pVfs, char const *zPath, int flags, int *pResOut);
   static int fullPathname(sqlite3_vfs *pVfs, char const *zPath, int nPathOut, char *zPathOut);
 
   static sqlite3_io_methods constexpr s_io = {1,                                     /* iVersion */
@@ -98,7 +119,7 @@ inline int MemFileDB::ioRead(sqlite3_file *pFile, void *zBuf, int iAmt, sqlite_i
 {
   //std::cout << "Called: " << __FUNCTION__ << std::endl;
   if (static_cast<uint64_t>(iOfst) >= reinterpret_cast<MemFile *>(pFile)->datasize ||
-      !reinterpret_cast<MemFile *>(pFile)->data)
+      (!reinterpret_cast<MemFile *>(pFile)->data && !reinterpret_cast<MemFile *>(pFile)->source))
   {
     std::cout << " !!! ERROR_READ !!!" << std::endl;
     return SQLITE_IOERR_READ;
@@ -113,7 +134,22 @@ inline int MemFileDB::ioRead(sqlite3_file *pFile, void *zBuf, int iAmt, sqlite_i
     shortread = true;
   }
 
-  std::memcpy(zBuf, reinterpret_cast<MemFile *>(pFile)->data + iOfst, toread);
+  if (reinterpret_cast<MemFile *>(pFile)->source)
+  {
+    if (!reinterpret_cast<MemFile *>(pFile)->source->read(reinterpret_cast<unsigned char *>(zBuf), iOfst, toread))
+    {
+      std::cout << " !!! ERROR_READ !!!" << std::endl;
+      return SQLITE_IOERR_READ;
+    }
+
+    // disable WAL (Write-Ahead Logging) in the header, reading without shm otherwise will not work
+    // see https://www.sqlite.org/fileformat.html
+    for (sqlite_int64 walbyte : {0x12, 0x13})
+      if (iOfst <= walbyte && walbyte < iOfst + toread && reinterpret_cast<unsigned char *>(zBuf)[walbyte - iOfst] == 2)
+        reinterpret_cast<unsigned char *>(zBuf)[walbyte - iOfst] = 1;
+  }
+  else
+    std::memcpy(zBuf, reinterpret_cast<MemFile *>(pFile)->data + iOfst, toread);
 
   if (shortread)
     return SQLITE_IOERR_SHORT_READ;
@@ -220,6 +256,25 @@ inline int MemFileDB::open(sqlite3_vfs *pVfs,                        /* VFS */
   return SQLITE_OK;
 }
 
+inline int MemFileDB::openPageSource(sqlite3_vfs *pVfs,                        /* VFS */
+                                     char const *zName [[maybe_unused]],       /* File to open, or 0 for a temp file */
+                                     sqlite3_file *pFile,                      /* Pointer to DemoFile struct to populate */
+                                     int flags [[maybe_unused]],               /* Input SQLITE_OPEN_XXX flags */
+                                     int *pOutFlags)                           /* Output SQLITE_OPEN_XXX flags (or NULL) */
+{
+  //std::cout << "Called: " << __FUNCTION__ << std::endl;
+  MemFile *p = reinterpret_cast<MemFile *>(pFile); /* Populate this structure */
+  std::memset(p, 0, sizeof(MemFile));
+  if (pOutFlags)
+    *pOutFlags = flags | SQLITE_READONLY | SQLITE_OPEN_MEMORY;
+
+  p->base.pMethods = &s_io;
+  p->source = reinterpret_cast<PageSource *>(pVfs->pAppData);
+  p->datasize = p->source->size();
+
+  return SQLITE_OK;
+}
+
 inline int MemFileDB::del(sqlite3_vfs *pVfs [[maybe_unused]], const char *zPath [[maybe_unused]], int dirSync [[maybe_unused]])
 {
   //std::cout << "Called: " << __FUNCTION__ << std::endl;
@@ -241,6 +296,18 @@ inline int MemFileDB::access(sqlite3_vfs *pVfs, char const *zPath [[maybe_unused
   return SQLITE_IOERR_ACCESS;
 }
 
+inline int MemFileDB::accessPageSource(sqlite3_vfs *pVfs, char const *zPath [[maybe_unused]], int flags [[maybe_unused]], int *pResOut)
+{
+  //std::cout << "Called: " << __FUNCTION__ << std::endl;
+  if (reinterpret_cast<PageSource const *>(pVfs->pAppData)->size() > 0)
+  {
+    *pResOut = 0;
+    return SQLITE_OK;
+  }
+  std::cout << " !!! ERROR_ACCESS !!! "  << std::endl;
+  return SQLITE_IOERR_ACCESS;
+}
+
 inline sqlite3_vfs *MemFileDB::sqlite3_memfilevfs(std::pair<unsigned char *, uint64_t> *data)
 {
   //std::cout << "Called: " << __FUNCTION__ << std::endl;
@@ -279,4 +346,40 @@ inline sqlite3_vfs *MemFileDB::sqlite3_memfilevfs(std::pair<unsigned char *, uin
   return &s_memfilevfs;
 }
 
+inline sqlite3_vfs *MemFileDB::sqlite3_pagesourcevfs(PageSource *source)
+{
+  //std::cout << "Called: " << __FUNCTION__ << std::endl;
+  std::memset(&s_pagesourcevfs, 0, sizeof(s_pagesourcevfs));
+
+  s_pagesourcevfs = {1,                          /* iVersion */
+                     sizeof(MemFile),            /* szOsFile */
+                     sizeof(s_pagesourcename) + 8, /* mxPathname (see above) */
+                     0,                          /* pNext */
+                     pageSourceVfsName(),        /* zName */
+                     source,                     /* pAppData */
+                     openPageSource,             /* xOpen */
+                     del,                        /* xDelete */
+                     accessPageSource,           /* xAccess */
+                     fullPathname,               /* xFullPathname */
+                     nullptr,                    /* xDlOpen */
+                     nullptr,                    /* xDlError */
+                     nullptr,                    /* xDlSym */
+                     nullptr,                    /* xDlClose */
+                     nullptr,                    /* xRandomness */
+                     nullptr,                    /* xSleep */
+                     nullptr,                    /* xCurrentTime */
+                     nullptr,                    /* xGetLastError */
+
+                     /* since we specified iversion == 1 above, the next fields actually
+                        should not exist, but just to suppress gcc warnings....  */
+
+                     nullptr,                    /* xCurrentTimeInt64 */
+                     nullptr,                    /* xSetSystemCall */
+                     nullptr,                    /* xGetSystemCall */
+                     nullptr,                    /* xNextSystemCall */
+  };
+
+  return &s_pagesourcevfs;
+}
+
 #endif
@@ -20,3 +20,4 @@
 #include "memfiledb.h"
 
 sqlite3_vfs MemFileDB::s_memfilevfs; // static
+sqlite3_vfs MemFileDB::s_pagesourcevfs; // static
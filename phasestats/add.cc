@@ -0,0 +1,41 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "phasestats.ih"
+
+void PhaseStats::add(Scope const &scope, double wall, double cpu) // static
+{
+  uint64_t const rss = peakRss();
+
+  std::lock_guard<std::mutex> lock(s_mutex);
+  auto it = std::find_if(s_phases.begin(), s_phases.end(), [&](Phase const &p)
+  {
+    return p.name == scope.d_name || std::strcmp(p.name, scope.d_name) == 0;
+  });
+  if (it == s_phases.end()) [[unlikely]]
+    it = s_phases.insert(s_phases.end(), Phase{scope.d_name, 0, 0, 0, 0, 0, 0, 0});
+
+  ++it->calls;
+  it->wall += wall;
+  it->cpu += cpu;
+  it->bytesread += scope.d_bytesread;
+  it->byteswritten += scope.d_byteswritten;
+  it->items += scope.d_items;
+  it->peakrss = std::max(it->peakrss, rss);
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2019-2023  Selwin van Dijk
+  Copyright (C) 2023  Selwin van Dijk
 
   This file is part of signalbackup-tools.
 
@@ -17,6 +17,11 @@
   along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
 */
 
-#include "avatarframe.ih"
+#include "phasestats.ih"
 
-AvatarFrame::Registrar AvatarFrame::s_registrar(FRAMETYPE::AVATAR, create);
+void PhaseStats::enable() // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_start = std::chrono::steady_clock::now();
+  s_enabled = true;
+}
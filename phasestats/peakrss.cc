@@ -0,0 +1,47 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "phasestats.ih"
+
+#if defined(_WIN32) || defined(__MINGW64__)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// highest resident set size of the process so far, in bytes
+uint64_t PhaseStats::peakRss() // static
+{
+#if defined(_WIN32) || defined(__MINGW64__) // untested
+  PROCESS_MEMORY_COUNTERS pmc;
+  if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+    return 0;
+  return pmc.PeakWorkingSetSize;
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#if defined(__APPLE__) && defined(__MACH__)
+  return usage.ru_maxrss; // bytes on macOS...
+#else
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024; // ...kilobytes on Linux
+#endif
+#endif
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2019-2023  Selwin van Dijk
+  Copyright (C) 2023  Selwin van Dijk
 
   This file is part of signalbackup-tools.
 
@@ -17,6 +17,10 @@
   along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
 */
 
-#include "headerframe.ih"
+#include "phasestats.ih"
 
-HeaderFrame::Registrar HeaderFrame::s_registrar(FRAMETYPE::HEADER, HeaderFrame::create);
+std::vector<PhaseStats::Phase> PhaseStats::phases() // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  return s_phases;
+}
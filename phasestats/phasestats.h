@@ -0,0 +1,156 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef PHASESTATS_H_
+#define PHASESTATS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Process wide record of where a run spends its time and resources (`--stats'). Code marks a
+// phase by putting a PhaseStats::Scope on the stack, every scope adds its wall time, the CPU
+// time of its own thread and the peak RSS at its end to the phase of that name, together with
+// any bytes/items it was told about. CPU time is per thread so phases running at the same time
+// on different threads (attachment decryption on the prefetcher vs frame decryption) are not
+// charged for each other's work, work a phase hands off to a thread pool is therefore not
+// counted in that phase. The CPU time of the whole process is only reported as the total.
+// Phases may nest (reading a backup includes key derivation and frame decryption), so their
+// times do not add up to the total. When not enabled, a Scope only costs a (relaxed) atomic load.
+class PhaseStats
+{
+ public:
+  struct Phase
+  {
+    char const *name;
+    uint64_t calls;
+    double wall;         // ms
+    double cpu;          // ms, summed over the threads the phase ran on
+    uint64_t bytesread;
+    uint64_t byteswritten;
+    uint64_t items;      // frames, rows, statements, ... whatever the phase processes
+    uint64_t peakrss;    // bytes, highest value seen at the end of the phase
+  };
+
+  class Scope
+  {
+    char const *d_name;
+    bool d_active;
+    std::chrono::steady_clock::time_point d_start;
+    double d_cpustart;
+    uint64_t d_bytesread;
+    uint64_t d_byteswritten;
+    uint64_t d_items;
+    friend class PhaseStats;
+   public:
+    inline explicit Scope(char const *name); // name must be a string literal (it is kept)
+    Scope(Scope const &other) = delete;
+    Scope &operator=(Scope const &other) = delete;
+    inline ~Scope();
+    inline void addBytesRead(uint64_t bytes);
+    inline void addBytesWritten(uint64_t bytes);
+    inline void addItems(uint64_t items);
+  };
+
+  // prints the collected stats (if enabled) when it goes out of scope, however main() returns
+  class Report
+  {
+    bool d_json;
+    std::string d_filename;
+   public:
+    inline Report(bool json, std::string const &filename);
+    Report(Report const &other) = delete;
+    Report &operator=(Report const &other) = delete;
+    ~Report();
+  };
+
+ private:
+  static std::atomic<bool> s_enabled;
+  static std::mutex s_mutex;
+  static std::vector<Phase> s_phases; // in order of first use
+  static std::chrono::steady_clock::time_point s_start;
+
+ public:
+  static void enable();
+  inline static bool enabled();
+  static std::vector<Phase> phases();
+  static void print(std::ostream &out);
+  static void printJson(std::ostream &out);
+  static double processCpuTime(); // ms
+  static double threadCpuTime();  // ms
+  static uint64_t peakRss();      // bytes
+
+ private:
+  static void add(Scope const &scope, double wall, double cpu);
+};
+
+inline bool PhaseStats::enabled() // static
+{
+  return s_enabled.load(std::memory_order_relaxed);
+}
+
+inline PhaseStats::Scope::Scope(char const *name)
+  :
+  d_name(name),
+  d_active(PhaseStats::enabled()),
+  d_cpustart(0),
+  d_bytesread(0),
+  d_byteswritten(0),
+  d_items(0)
+{
+  if (d_active) [[unlikely]]
+  {
+    d_cpustart = PhaseStats::threadCpuTime();
+    d_start = std::chrono::steady_clock::now();
+  }
+}
+
+inline PhaseStats::Scope::~Scope()
+{
+  if (d_active) [[unlikely]]
+    PhaseStats::add(*this, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - d_start).count(),
+                    PhaseStats::threadCpuTime() - d_cpustart);
+}
+
+inline void PhaseStats::Scope::addBytesRead(uint64_t bytes)
+{
+  d_bytesread += bytes;
+}
+
+inline void PhaseStats::Scope::addBytesWritten(uint64_t bytes)
+{
+  d_byteswritten += bytes;
+}
+
+inline void PhaseStats::Scope::addItems(uint64_t items)
+{
+  d_items += items;
+}
+
+inline PhaseStats::Report::Report(bool json, std::string const &filename)
+  :
+  d_json(json),
+  d_filename(filename)
+{}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "phasestats.ih"
+
+void PhaseStats::print(std::ostream &out) // static
+{
+  double const mib = 1024 * 1024;
+  double const wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - s_start).count();
+  std::vector<Phase> const p = phases();
+
+  std::ios_base::fmtflags const flags = out.flags();
+  std::streamsize const precision = out.precision();
+  char const fill = out.fill(' ');
+
+  out << std::fixed << std::setprecision(1) << std::endl
+      << "Phase statistics (total: " << wall << "s wall, " << processCpuTime() / 1e3 << "s cpu, peak RSS "
+      << peakRss() / mib << " MiB):" << std::endl
+      << "  " << std::left << std::setw(24) << "phase" << std::right << std::setw(9) << "calls" << std::setw(11) << "wall (s)"
+      << std::setw(11) << "cpu (s)" << std::setw(12) << "read (MiB)" << std::setw(14) << "written (MiB)" << std::setw(11) << "items"
+      << std::setw(16) << "peak RSS (MiB)" << std::endl;
+  for (Phase const &phase : p)
+    out << "  " << std::left << std::setw(24) << phase.name << std::right << std::setw(9) << phase.calls
+        << std::setprecision(3) << std::setw(11) << phase.wall / 1e3 << std::setw(11) << phase.cpu / 1e3
+        << std::setprecision(1) << std::setw(12) << phase.bytesread / mib << std::setw(14) << phase.byteswritten / mib
+        << std::setw(11) << phase.items << std::setw(16) << phase.peakrss / mib << std::endl;
+
+  out.flags(flags);
+  out.precision(precision);
+  out.fill(fill);
+}
@@ -0,0 +1,46 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "phasestats.ih"
+
+void PhaseStats::printJson(std::ostream &out) // static
+{
+  double const wall = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - s_start).count();
+  std::vector<Phase> const p = phases();
+
+  std::ios_base::fmtflags const flags = out.flags();
+  std::streamsize const precision = out.precision();
+
+  // phase names are string literals from the source, no escaping needed
+  out << std::fixed << std::setprecision(3)
+      << "{" << std::endl
+      << "  \"wall_ms\": " << wall << "," << std::endl
+      << "  \"cpu_ms\": " << processCpuTime() << "," << std::endl
+      << "  \"peak_rss\": " << peakRss() << "," << std::endl
+      << "  \"phases\": [";
+  for (unsigned int i = 0; i < p.size(); ++i)
+    out << (i ? "," : "") << std::endl
+        << "    {\"name\": \"" << p[i].name << "\", \"calls\": " << p[i].calls << ", \"wall_ms\": " << p[i].wall
+        << ", \"cpu_ms\": " << p[i].cpu << ", \"bytes_read\": " << p[i].bytesread << ", \"bytes_written\": "
+        << p[i].byteswritten << ", \"items\": " << p[i].items << ", \"peak_rss\": " << p[i].peakrss << "}";
+  out << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+  out.flags(flags);
+  out.precision(precision);
+}
@@ -0,0 +1,46 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "phasestats.ih"
+
+#if defined(_WIN32) || defined(__MINGW64__)
+#include <windows.h>
+#else
+#include <ctime>
+#endif
+
+// CPU time used by the process so far (all threads, user + system), in ms
+double PhaseStats::processCpuTime() // static
+{
+#if defined(_WIN32) || defined(__MINGW64__) // untested
+  FILETIME creation, exit, kernel, user;
+  if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+    return 0;
+  auto toMs = [](FILETIME const &ft) // 100 ns units
+  {
+    return ((static_cast<uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) / 1e4;
+  };
+  return toMs(kernel) + toMs(user);
+#else
+  timespec ts;
+  if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) != 0)
+    return 0;
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+#endif
+}
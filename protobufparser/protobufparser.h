@@ -24,6 +24,7 @@
 #include <memory>
 #include <vector>
 #include <optional>
+#include <algorithm>
 
 #include "../base64/base64.h"
 #include "../common_be.h"
@@ -179,6 +180,22 @@ class ProtoBufParser
   unsigned char *d_data;
   int64_t d_size;
 
+  // Built on first lookup (for messages of at least s_minindexsize bytes): one
+  // entry per field in d_data, sorted on field number (and position), so lookups
+  // do not need to rescan (and redecode) the data from the start every time. Any
+  // change to d_data drops it.
+  static int64_t constexpr s_minindexsize = 128;
+  struct FieldRef
+  {
+    int32_t field;
+    uint32_t tagpos;   // start of field (tag)
+    uint32_t datapos;  // start of value (after tag and length)
+    uint32_t length;   // length of value
+    bool varint;
+  };
+  mutable std::vector<FieldRef> d_index;
+  mutable bool d_indexed;
+
  public:
   inline ProtoBufParser();
   ProtoBufParser(std::string const &base64);
@@ -236,6 +253,10 @@ class ProtoBufParser
   std::pair<unsigned char *, int64_t> getField(int num, bool *isvarint, int *pos) const;
   void getPosAndLengthForField(int num, int startpos, int *pos, int *fieldlength) const;
   bool fieldExists(int num) const;
+  void buildIndex() const;
+  inline int readFieldRef(int64_t *pos, FieldRef *ref) const;
+  inline bool findField(int num, int startpos, FieldRef *ref) const;
+  inline void dropIndex();
   template <int idx>
   inline constexpr uint64_t fieldSize() const;
   inline uint64_t varIntSize(uint64_t value) const;
@@ -268,14 +289,16 @@ template <typename... Spec>
 inline ProtoBufParser<Spec...>::ProtoBufParser()
   :
   d_data(nullptr),
-  d_size(0)
+  d_size(0),
+  d_indexed(false)
 {}
 
 template <typename... Spec>
 inline ProtoBufParser<Spec...>::ProtoBufParser(ProtoBufParser const &other)
   :
   d_data(nullptr),
-  d_size(0)
+  d_size(0),
+  d_indexed(false)
 {
   d_data = new unsigned char[other.d_size];
   std::memcpy(d_data, other.d_data, other.d_size);
@@ -286,17 +309,21 @@ template <typename... Spec>
 inline ProtoBufParser<Spec...>::ProtoBufParser(ProtoBufParser &&other)
   :
   d_data(other.d_data),
-  d_size(other.d_size)
+  d_size(other.d_size),
+  d_index(std::move(other.d_index)),
+  d_indexed(other.d_indexed)
 {
   other.d_data = nullptr;
   other.d_size = 0;
+  other.dropIndex();
 }
 
 template <typename... Spec>
 ProtoBufParser<Spec...>::ProtoBufParser(std::string const &base64)
   :
   d_data(nullptr),
-  d_size(0)
+  d_size(0),
+  d_indexed(false)
 {
   std::pair<unsigned char *, size_t> data = Base64::base64StringToBytes(base64);
   d_data = data.first;
@@ -315,7 +342,8 @@ template <typename... Spec>
 ProtoBufParser<Spec...>::ProtoBufParser(unsigned char *data, int64_t size)
   :
   d_data(nullptr),
-  d_size(0)
+  d_size(0),
+  d_indexed(false)
 {
   d_data = new unsigned char[size];
   std::memcpy(d_data, data, size);
@@ -333,6 +361,7 @@ template <typename... Spec>
 inline void ProtoBufParser<Spec...>::clear()
 {
   bepaald::destroyPtr(&d_data, &d_size);
+  dropIndex();
 }
 
 template <typename... Spec>
@@ -353,6 +382,7 @@ inline void ProtoBufParser<Spec...>::setData(std::string const &base64)
 
   d_data = data.first;
   d_size = data.second;
+  dropIndex();
 }
 
 template <typename... Spec>
@@ -365,6 +395,7 @@ inline void ProtoBufParser<Spec...>::setData(unsigned char *data, int64_t size)
   d_data = new unsigned char[size];
   std::memcpy(d_data, data, size);
   d_size = size;
+  dropIndex();
 }
 
 template <typename... Spec>
@@ -635,6 +666,7 @@ bool ProtoBufParser<Spec...>::deleteFirstField(int num, T const *value [[maybe_u
     delete[] d_data;
     d_data = newdata;
     d_size = d_size - fieldlength;
+    dropIndex();
 
     //std::cout << "After delete" << std::endl;
     //std::cout << "DATA:  " << bepaald::bytesToHexString(d_data, d_size) << std::endl;
@@ -852,6 +884,7 @@ inline bool ProtoBufParser<Spec...>::addFieldInternal(T const &value)
     delete[] d_data;
   d_data = newdata;
   d_size = d_size + size;
+  dropIndex();
 
   //std::cout << "OUTPUT: " << bepaald::bytesToHexString(d_data, d_size) << std::endl;
 
@@ -933,94 +966,122 @@ int64_t ProtoBufParser<Spec...>::getVarIntFieldLength(int pos, unsigned char *da
   return ++length;
 }
 
+// reads the field starting at *pos into *ref and moves *pos past it. Returns 1 if
+// a field was read, 0 if the tag was skipped (groups are not supported) and -1 on
+// the end of (or truncated/corrupt) data
 template <typename... Spec>
-void ProtoBufParser<Spec...>::getPosAndLengthForField(int num, int startpos, int *pos, int *fieldlength) const
+inline int ProtoBufParser<Spec...>::readFieldRef(int64_t *pos, FieldRef *ref) const
 {
-  int localpos = startpos;
-  while (localpos < d_size)
+  if (*pos >= d_size)
+    return -1;
+
+  ref->tagpos = *pos;
+  int32_t field    = (d_data[*pos] & 0b00000000000000000000000001111000) >> 3;
+  int32_t wiretype = d_data[*pos] & 0b00000000000000000000000000000111;
+  int fieldshift = 4;
+  while (d_data[*pos] & 0b00000000000000000000000010000000 && // skipping the shift
+         *pos < d_size - 1)
+  {
+    field |= (d_data[++(*pos)] & 0b00000000000000000000000001111111) << fieldshift;
+    fieldshift += 7;
+  }
+  ++(*pos);
+
+  uint64_t fieldlength = 0;
+  switch (wiretype)
   {
-    int32_t field    = (d_data[localpos] & 0b00000000000000000000000001111000) >> 3;
-    int32_t wiretype = d_data[localpos] & 0b00000000000000000000000000000111;
-    int fieldshift = 4;
-    unsigned int localpos2 = localpos;
-    while (d_data[localpos2] & 0b00000000000000000000000010000000 && // skipping the shift
-           localpos2 < d_size - 1)
+    case WIRETYPE::LENGTH_DELIMITED:
     {
-      field |= (d_data[++localpos2] & 0b00000000000000000000000001111111) << fieldshift;
-      fieldshift += 7;
+      if (*pos >= d_size) [[unlikely]]
+        return -1;
+      int varintpos = *pos;
+      fieldlength = readVarInt(&varintpos, d_data, d_size);
+      *pos = varintpos;
+      break;
     }
-    int nextpos = localpos2 + 1;
-
-    switch (wiretype)
+    case WIRETYPE::VARINT:
     {
-      case WIRETYPE::LENGTH_DELIMITED:
-      {
-        uint64_t localfieldlength = readVarInt(&nextpos, d_data, d_size);
-        if (field == num)
-        {
-          *pos = localpos;
-          *fieldlength = localfieldlength + nextpos - localpos;
-          return;
-        }
-        localpos = nextpos + localfieldlength;
-        break;
-      }
-      case WIRETYPE::VARINT:
-      {
-        uint64_t localfieldlength = getVarIntFieldLength(nextpos, d_data, d_size);
-        if (field == num)
-        {
-          *pos = localpos;
-          *fieldlength = localfieldlength + nextpos - localpos;
-          return;
-        }
-        localpos = nextpos + localfieldlength;
-        break;
-      }
-      case WIRETYPE::FIXED64:
-      {
-        uint64_t localfieldlength = 8;
-        if (field == num)
-        {
-          *pos = localpos;
-          *fieldlength = localfieldlength + 1;
-          return;
-        }
-        localpos = nextpos + localfieldlength;
-        break;
-      }
-      case WIRETYPE::FIXED32:
-      {
-        uint64_t localfieldlength = 4;
-        if (field == num)
-        {
-          *pos = localpos;
-          *fieldlength = localfieldlength + 1;
-          return;
-        }
-        localpos = nextpos + localfieldlength;
-        break;
-      }
-      case WIRETYPE::STARTGROUP:
-      {
-        if (field == num)
-          std::cout << "Skipping startgroup for now" << std::endl;
-        break;
-      }
-      case WIRETYPE::ENDGROUP:
-      {
-        if (field == num)
-          std::cout << "Skipping endgroup for now" << std::endl;
-        break;
-      }
-      default:
-      {
-        std::cout << "Unknown wiretype: " << wiretype << std::endl;
-        return;
-        break;
-      }
+      if (*pos >= d_size) [[unlikely]]
+        return -1;
+      fieldlength = getVarIntFieldLength(*pos, d_data, d_size);
+      break;
     }
+    case WIRETYPE::FIXED64:
+      fieldlength = 8;
+      break;
+    case WIRETYPE::FIXED32:
+      fieldlength = 4;
+      break;
+    default: // STARTGROUP/ENDGROUP (deprecated/not implemented yet), or garbage: skip the tag
+      return 0;
   }
+  if (*pos + fieldlength > static_cast<uint64_t>(d_size)) [[unlikely]]
+    return -1;
+
+  ref->field = field;
+  ref->datapos = *pos;
+  ref->length = fieldlength;
+  ref->varint = (wiretype == WIRETYPE::VARINT);
+  *pos += fieldlength;
+  return 1;
+}
+
+template <typename... Spec>
+void ProtoBufParser<Spec...>::buildIndex() const
+{
+  d_index.clear();
+  int64_t pos = 0;
+  FieldRef ref;
+  int res;
+  while ((res = readFieldRef(&pos, &ref)) >= 0)
+    if (res)
+      d_index.push_back(ref);
+  std::stable_sort(d_index.begin(), d_index.end(), [](FieldRef const &lhs, FieldRef const &rhs) { return lhs.field < rhs.field; });
+  d_indexed = true;
+}
+
+// finds the first occurrence of field num starting at or after startpos
+template <typename... Spec>
+inline bool ProtoBufParser<Spec...>::findField(int num, int startpos, FieldRef *ref) const
+{
+  if (d_size < s_minindexsize) // small messages: just scan, building the index costs more than it saves
+  {
+    int64_t pos = startpos;
+    int res;
+    while ((res = readFieldRef(&pos, ref)) >= 0)
+      if (res && ref->field == num)
+        return true;
+    return false;
+  }
+
+  if (!d_indexed)
+    buildIndex();
+  auto it = std::lower_bound(d_index.begin(), d_index.end(), std::make_pair(num, startpos),
+                             [](FieldRef const &lhs, std::pair<int, int> const &key)
+                             {
+                               return lhs.field < key.first || (lhs.field == key.first && static_cast<int64_t>(lhs.tagpos) < key.second);
+                             });
+  if (it == d_index.end() || it->field != num)
+    return false;
+  *ref = *it;
+  return true;
+}
+
+template <typename... Spec>
+inline void ProtoBufParser<Spec...>::dropIndex()
+{
+  d_index.clear();
+  d_indexed = false;
+}
+
+template <typename... Spec>
+void ProtoBufParser<Spec...>::getPosAndLengthForField(int num, int startpos, int *pos, int *fieldlength) const
+{
+  FieldRef ref;
+  if (!findField(num, startpos, &ref))
+    return;
+  *pos = ref.tagpos;
+  *fieldlength = ref.datapos + ref.length - ref.tagpos;
 }
 
 template <typename... Spec>
@@ -1030,133 +1091,26 @@ std::pair<unsigned char *, int64_t> ProtoBufParser<Spec...>::getField(int num, b
   return getField(num, isvarint, &pos);
 }
 
+// *pos is the position to start searching from, and is set to the start of the returned value
 template <typename... Spec>
 std::pair<unsigned char *, int64_t> ProtoBufParser<Spec...>::getField(int num, bool *isvarint, int *pos) const
 {
-  while (*pos < d_size)
+  FieldRef ref;
+  if (!findField(num, *pos, &ref))
   {
-    //std::cout << "AT: " << *pos << " : " << "0x" << std::hex << static_cast<int>(d_data[*pos] & 0xff) << std::dec << std::endl;
-    int32_t field    = (d_data[*pos] & 0b00000000000000000000000001111000) >> 3;
-    int32_t wiretype = d_data[*pos] & 0b00000000000000000000000000000111;
-    int fieldshift = 4;
-    while (d_data[*pos] & 0b00000000000000000000000010000000 && // skipping the shift
-           *pos < d_size - 1)
-    {
-      //std::cout << "Adding byte to varint field number" << std::endl;
-      field |= (d_data[++(*pos)] & 0b00000000000000000000000001111111) << fieldshift;
-      fieldshift += 7;
-    }
-    // std::cout << "field: " << field << std::endl;
-    // std::cout << "wiret: " << wiretype << std::endl;
-
-    ++(*pos);
-    switch (wiretype)
-    {
-      case WIRETYPE::LENGTH_DELIMITED:
-      {
-        uint64_t fieldlength = readVarInt(pos, d_data, d_size);
-        if (field == num)
-          return std::make_pair(d_data + *pos, fieldlength);
-        *pos += fieldlength;
-        break;
-      }
-      case WIRETYPE::VARINT:
-      {
-        *isvarint = true;
-        //std::cout << "AT: " << *pos << " : " << "0x" << std::hex << static_cast<int>(d_data[*pos] & 0xff) << std::dec << std::endl;
-        uint64_t fieldlength = getVarIntFieldLength(*pos, d_data, d_size);
-        if (field == num)
-          return std::make_pair(d_data + *pos, fieldlength);
-        *pos += fieldlength;
-        break;
-      }
-      case WIRETYPE::FIXED64:
-      {
-        if (field == num)
-          return std::make_pair(d_data + *pos, 8);
-        *pos += 8;
-        break;
-      }
-      case WIRETYPE::FIXED32:
-      {
-        if (field == num)
-          return std::make_pair(d_data + *pos, 4);
-        *pos += 4;
-        break;
-      }
-      case WIRETYPE::STARTGROUP:
-      {
-        if (field == num)
-          std::cout << "Skipping startgroup for now" << std::endl;
-        break;
-      }
-      case WIRETYPE::ENDGROUP:
-      {
-        if (field == num)
-          std::cout << "Skipping endgroup for now" << std::endl;
-        break;
-      }
-    }
+    *pos = d_size;
+    return std::pair<unsigned char *, int64_t>(nullptr, 0);
   }
-  return std::pair<unsigned char *, int64_t>(nullptr, 0);
+  *isvarint = ref.varint;
+  *pos = ref.datapos;
+  return std::make_pair(d_data + ref.datapos, static_cast<int64_t>(ref.length));
 }
 
 template <typename... Spec>
 bool ProtoBufParser<Spec...>::fieldExists(int num) const
 {
-  int pos = 0;
-  while (pos < d_size)
-  {
-    int32_t field    = (d_data[pos] & 0b00000000000000000000000001111000) >> 3;
-    int32_t wiretype = d_data[pos] & 0b00000000000000000000000000000111;
-    int fieldshift = 4;
-    while (d_data[pos] & 0b00000000000000000000000010000000 && // skipping the shift
-           pos < d_size - 1)
-    {
-      field |= (d_data[++pos] & 0b00000000000000000000000001111111) << fieldshift;
-      fieldshift += 7;
-    }
-
-    if (field == num)
-      return true;
-
-    ++pos;
-
-    switch (wiretype)
-    {
-      case WIRETYPE::LENGTH_DELIMITED:
-      {
-        uint64_t fieldlength = readVarInt(&pos, d_data, d_size);
-        pos += fieldlength;
-        break;
-      }
-      case WIRETYPE::VARINT:
-      {
-        uint64_t fieldlength = getVarIntFieldLength(pos, d_data, d_size);
-        pos += fieldlength;
-        break;
-      }
-      case WIRETYPE::FIXED64:
-      {
-        pos += 8;
-        break;
-      }
-      case WIRETYPE::FIXED32:
-      {
-        pos += 4;
-        break;
-      }
-      case WIRETYPE::STARTGROUP: // deprecated/not implemented yet
-      {
-        break;
-      }
-      case WIRETYPE::ENDGROUP: // deprecated/not implemented yet
-      {
-        break;
-      }
-    }
-  }
-  return false;
+  FieldRef ref;
+  return findField(num, 0, &ref);
 }
 
 template <typename... Spec>
@@ -35,12 +35,16 @@ class SharedPrefFrame : public BackupFrame
     ISSTRINGSETVALUE = 6 // bool
   };
 
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 6> s_fields{{{FIELD::FILE, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::KEY, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::VALUE, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::BOOLEANVALUE, WIRETYPE::VARINT, false},
+                                                      {FIELD::STRINGSETVALUE, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::ISSTRINGSETVALUE, WIRETYPE::VARINT, false}}};
  public:
   inline explicit SharedPrefFrame(uint64_t count = 0);
   inline SharedPrefFrame(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual ~SharedPrefFrame() = default;
-  inline static BackupFrame *create(unsigned char *bytes, size_t length, uint64_t count = 0);
   inline virtual void printInfo() const override;
   inline virtual FRAMETYPE frameType() const override;
   inline std::pair<unsigned char *, uint64_t> getData() const override;
@@ -58,12 +62,10 @@ inline SharedPrefFrame::SharedPrefFrame(uint64_t count)
 
 inline SharedPrefFrame::SharedPrefFrame(unsigned char *bytes, size_t length, uint64_t count)
   :
-  BackupFrame(bytes, length, count)
-{}
-
-inline BackupFrame *SharedPrefFrame::create(unsigned char *bytes, size_t length, uint64_t count)
+  BackupFrame(count)
 {
-  return new SharedPrefFrame(bytes, length, count);
+  d_constructedsize = length;
+  d_ok = init<s_fields>(bytes, length, &d_framedata);
 }
 
 inline void SharedPrefFrame::printInfo() const // virtual
@@ -0,0 +1,63 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+/*
+  Fills d_recipientidbyuuid and d_recipientidbyphone with all recipients in
+  the database, so getRecipientIdFromUuid()/getRecipientIdFromPhone() do not
+  need to query the database for every (new) uuid/phone during a bulk import.
+  Like those functions, keys match case insensitively and only if they match
+  a single recipient. Anything not found here still gets looked up normally.
+*/
+void SignalBackup::buildRecipientIdIndex()
+{
+  d_recipientidbyuuid.clear();
+  d_recipientidbyphone.clear();
+
+  SqliteDB::QueryResults res;
+  if (!d_database.exec("SELECT _id, " + d_recipient_aci + " AS aci, group_id, " + d_recipient_e164 + " AS e164 FROM recipient", &res))
+    return;
+
+  std::set<std::string> ambiguous_uuids;
+  std::set<std::string> ambiguous_phones;
+  auto add = [](std::unordered_map<std::string, long long int> *index, std::set<std::string> *ambiguous,
+                std::string const &key, long long int rid)
+  {
+    if (key.empty() || ambiguous->contains(key))
+      return;
+    if (!index->emplace(key, rid).second)
+    {
+      index->erase(key);
+      ambiguous->insert(key);
+    }
+  };
+
+  d_recipientidbyuuid.reserve(res.rows());
+  d_recipientidbyphone.reserve(res.rows());
+  for (uint i = 0; i < res.rows(); ++i)
+  {
+    if (!res.valueHasType<long long int>(i, "_id"))
+      continue;
+    long long int rid = res.getValueAs<long long int>(i, "_id");
+    add(&d_recipientidbyuuid, &ambiguous_uuids, bepaald::toLower(res.valueAsString(i, "aci")), rid);
+    add(&d_recipientidbyuuid, &ambiguous_uuids, bepaald::toLower(res.valueAsString(i, "group_id")), rid);
+    add(&d_recipientidbyphone, &ambiguous_phones, bepaald::toLower(res.valueAsString(i, "e164")), rid);
+  }
+}
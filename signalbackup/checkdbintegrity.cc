@@ -21,6 +21,8 @@
 
 bool SignalBackup::checkDbIntegrity(bool warn) const
 {
+  PhaseStats::Scope phase("integrity check");
+
   SqliteDB::QueryResults results;
 
   // CHECKING FOREIGN KEY CONSTRAINTS
@@ -21,6 +21,8 @@
 
 void SignalBackup::compactIds(std::string const &table, std::string const &col)
 {
+  PhaseStats::Scope phase("compact ids");
+
   std::cout << __FUNCTION__ << std::endl;
 
   std::cout << "  Compacting table: " << table << " (" << col << ")" << std::endl;
@@ -32,6 +34,7 @@ void SignalBackup::compactIds(std::string const &table, std::string const &col)
   // gets first available _id in table
   d_database.exec("SELECT t1." + col + "+1 FROM " + table + " t1 LEFT OUTER JOIN " + table + " t2 ON t2." + col + "=t1." + col + "+1 WHERE t2." + col + " IS NULL AND t1." + col + " > 0 ORDER BY t1." + col + " LIMIT 1", &results);
 
+  std::map<uint64_t, uint64_t> partidchanges; // old rowid -> new rowid
   while (results.rows() > 0 && results.valueHasType<long long int>(0, 0))
   {
     long long int nid = results.getValueAs<long long int>(0, 0);
@@ -97,18 +100,8 @@ void SignalBackup::compactIds(std::string const &table, std::string const &col)
       }
       else */if (table == "part")
       {
-        for (auto att = d_attachments.begin(); att != d_attachments.end(); )
-        {
-          if (reinterpret_cast<AttachmentFrame *>(att->second.get())->rowId() == static_cast<uint64_t>(valuetochange))
-          {
-            AttachmentFrame *a = reinterpret_cast<AttachmentFrame *>(att->second.release());
-            att = d_attachments.erase(att);
-            a->setRowId(nid);
-            d_attachments.emplace(std::make_pair(a->rowId(), a->attachmentId()), a);
-          }
-          else
-            ++att;
-        }
+        // the attachment frames are rekeyed in one go after the loop
+        partidchanges[valuetochange] = nid;
 
         /*
         // update rowid in previews (mms.previews contains a json string referencing the 'rowId' == part._id)
@@ -163,6 +156,16 @@ void SignalBackup::compactIds(std::string const &table, std::string const &col)
     // gets first available _id in table
     d_database.exec("SELECT t1." + col + "+1 FROM " + table + " t1 LEFT OUTER JOIN " + table + " t2 ON t2." + col + "=t1." + col + "+1 WHERE t2." + col + " IS NULL AND t1." + col + " > 0 ORDER BY t1." + col + " LIMIT 1", &results);
   }
+
+  // every id is moved at most once (it moves down into the first gap, and all ids below that
+  // gap are already in place), so the changes can be applied to the original rowids directly
+  if (!partidchanges.empty())
+    d_attachments.rekey([&partidchanges](AttachmentFrame *a)
+    {
+      auto change = partidchanges.find(a->rowId());
+      if (change != partidchanges.end())
+        a->setRowId(change->second);
+    });
   // d_database.exec("SELECT _id FROM " + table, &results);
   // results.prettyPrint();
 }
@@ -21,6 +21,8 @@
 
 void SignalBackup::cropToDates(std::vector<std::pair<std::string, std::string>> const &dateranges)
 {
+  PhaseStats::Scope phase("crop to dates");
+
   std::cout << __FUNCTION__ << std::endl;
 
   std::string smsq;
@@ -26,6 +26,8 @@ void SignalBackup::cropToThread(long long int threadid)
 
 void SignalBackup::cropToThread(std::vector<long long int> const &threadids)
 {
+  PhaseStats::Scope phase("crop to threads");
+
   std::cout << __FUNCTION__ << std::endl;
 
   std::string smsq;
@@ -25,6 +25,8 @@ bool SignalBackup::deleteAttachments(std::vector<long long int> const &threadids
                                      std::string const &append, std::string const &prepend,
                                      std::vector<std::pair<std::string, std::string>> replace)
 {
+  PhaseStats::Scope phase("delete attachments");
+
   std::string query_delete("DELETE FROM part");
   std::string query_list("SELECT _id,mid,unique_id,ct,quote FROM part");
 
@@ -190,6 +192,16 @@ bool SignalBackup::deleteAttachments(std::vector<long long int> const &threadids
     return (lhs.first == "default" ? false : (rhs.first == "default" ? true : lhs.first.length() > rhs.first.length()));
   });
 
+  // the replacement files are the same for every attachment, probe them once
+  std::vector<std::string> replacementfiles;
+  for (auto const &r : replace)
+    if (std::find(replacementfiles.begin(), replacementfiles.end(), r.second) == replacementfiles.end())
+      replacementfiles.push_back(r.second);
+  std::vector<AttachmentMetadata> replacementmetadata = getAttachmentMetaData(replacementfiles);
+  std::map<std::string, AttachmentMetadata> probed;
+  for (uint j = 0; j < replacementfiles.size(); ++j)
+    probed.emplace(replacementfiles[j], replacementmetadata[j]);
+
   for (uint i = 0; i < res.rows(); ++i)
   {
     // get ct (mimetype), if it matches replace[i].first -> replace with replace[i].second
@@ -210,7 +222,7 @@ bool SignalBackup::deleteAttachments(std::vector<long long int> const &threadids
           continue;
         }
 
-        AttachmentMetadata amd = getAttachmentMetaData(replace[j].second);
+        AttachmentMetadata const &amd = probed.at(replace[j].second);
         if (!amd)
         {
           std::cout << "Failed to get metadata on new attachment: \"" << replace[j].second << "\", skipping..." << std::endl;
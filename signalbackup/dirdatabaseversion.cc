@@ -0,0 +1,32 @@
+/*
+  Copyright (C) 2019-2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "signalbackup.ih"
+
+// reads the database version of a backup dumped to a directory, without opening the rest of it.
+// DatabaseVersion.sbf holds the single line "VERSION:uint32:<version>"
+long long int SignalBackup::dirDatabaseVersion(std::string const &inputdir) // static
+{
+  std::ifstream file(inputdir + "/DatabaseVersion.sbf", std::ios_base::in);
+  std::string line;
+  std::string const prefix("VERSION:uint32:");
+  while (std::getline(file, line))
+    if (line.compare(0, prefix.size(), prefix) == 0)
+      return bepaald::toNumber<long long int>(line.substr(prefix.size()));
+  return -1;
+}
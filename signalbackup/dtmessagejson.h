@@ -0,0 +1,117 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.h"
+
+#include <unordered_map>
+
+// All nodes of a single Signal Desktop `messages.json', as returned by one
+// json_tree() query. Values are looked up by the same paths json_extract()
+// takes (eg "$.quote.bodyRanges[0].start"), so the import can read any field
+// of a message without having the database parse its json again.
+struct DTMessageJson
+{
+  SqliteDB::QueryResults tree; // columns: key, fullkey, path, type, atom
+  std::unordered_map<std::string, unsigned int> index; // fullkey -> row in tree
+
+  inline bool load(SqliteDB const &ddb, long long int rowid)
+  {
+    index.clear();
+    if (!ddb.exec("SELECT tree.key, tree.fullkey, tree.path, tree.type, tree.atom "
+                  "FROM messages, json_tree(messages.json) AS tree WHERE messages.rowid = ?", rowid, &tree))
+      return false;
+    index.reserve(tree.rows());
+    for (unsigned int i = 0; i < tree.rows(); ++i)
+      index.emplace(tree.valueAsString(i, 1), i);
+    return true;
+  }
+
+  inline bool contains(std::string const &path) const
+  {
+    return index.contains(path);
+  }
+
+  // true if path does not exist or is json null
+  inline bool isNull(std::string const &path) const
+  {
+    auto it = index.find(path);
+    return it == index.end() || tree.isNull(it->second, 4);
+  }
+
+  template <typename T>
+  inline bool valueHasType(std::string const &path) const
+  {
+    auto it = index.find(path);
+    return it != index.end() && tree.valueHasType<T>(it->second, 4);
+  }
+
+  // the value as returned by json_extract() (nullptr if path does not exist), eg for use as query parameter
+  inline std::any value(std::string const &path) const
+  {
+    auto it = index.find(path);
+    return it == index.end() ? std::any(nullptr) : tree.value(it->second, 4);
+  }
+
+  // empty if path does not exist, is null, or is an object/array
+  inline std::string valueAsString(std::string const &path) const
+  {
+    auto it = index.find(path);
+    return it == index.end() ? std::string() : tree.valueAsString(it->second, 4);
+  }
+
+  // numbers stored as string are converted, -1 if not a number
+  inline long long int valueAsInt(std::string const &path, long long int defaultval = -1) const
+  {
+    auto it = index.find(path);
+    return (it == index.end() || tree.isNull(it->second, 4)) ? defaultval : tree.valueAsInt(it->second, 4);
+  }
+
+  // the fullkeys of all direct members of the array or object at path, in document order
+  inline std::vector<std::string> children(std::string const &path) const
+  {
+    std::vector<std::string> res;
+    auto it = index.find(path);
+    if (it == index.end())
+      return res;
+    for (unsigned int i = it->second + 1; i < tree.rows(); ++i) // json_tree walks depth first: the subtree of path follows it
+    {
+      std::string const &parent = tree.getValueAs<std::string>(i, 2);
+      if (!parent.starts_with(path))
+        break;
+      if (parent == path)
+        res.emplace_back(tree.valueAsString(i, 1));
+    }
+    return res;
+  }
+
+  inline long long int arrayLength(std::string const &path) const
+  {
+    auto it = index.find(path);
+    if (it == index.end() || tree.valueAsString(it->second, 3) != "array")
+      return 0;
+    return children(path).size();
+  }
+
+  // the object key (or array index) of the node at path
+  inline std::string key(std::string const &path) const
+  {
+    auto it = index.find(path);
+    return it == index.end() ? std::string() : tree.valueAsString(it->second, 0);
+  }
+};
@@ -18,8 +18,9 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
-void SignalBackup::dtSetMessageDeliveryReceipts(SqliteDB const &ddb, long long int rowid, std::map<std::string, long long int> *savedmap,
+void SignalBackup::dtSetMessageDeliveryReceipts(SqliteDB const &ddb, DTMessageJson const &msgjson, std::map<std::string, long long int> *savedmap,
                                                 std::string const &databasedir, bool createcontacts, long long int msg_id, bool is_mms,
                                                 bool isgroup, bool *warn)
 {
@@ -32,16 +33,7 @@ void SignalBackup::dtSetMessageDeliveryReceipts(SqliteDB const &ddb, long long i
   long long int constexpr STATUS_DELIVERED = 1;
   long long int constexpr STATUS_READ = 2;
 
-  SqliteDB::QueryResults status_results;
-  if (!ddb.exec("SELECT "
-                "delivery_details.key AS conv_id,"
-                "conversations." + d_dt_c_uuid + " AS uuid,"
-                "conversations.e164 AS e164,"
-                "json_extract(delivery_details.value, '$.status') AS status,"
-                "COALESCE(json_extract(delivery_details.value, '$.updatedAt'), delivery_details.sent_at) AS updated_timestamp"
-                " FROM "
-                "(SELECT sent_at,key,value FROM messages,json_each(messages.json, '$.sendStateByConversationId') WHERE rowid IS ?) delivery_details"
-                " LEFT JOIN conversations ON conversations.id IS conv_id", rowid, &status_results))
+  if (msgjson.tree.empty())
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Getting message delivery status" << std::endl;
   }
@@ -56,25 +48,39 @@ void SignalBackup::dtSetMessageDeliveryReceipts(SqliteDB const &ddb, long long i
     //           status = Delivered
     //updated_timestamp = 1668710612716
 
-    //status_results.prettyPrint();
+
+    // the member's uuid and phone are only needed (and looked up) for group receipts
+    SqliteDB::QueryResults member_results;
+    auto memberdata = [&](std::string const &conv_id, std::string const &column) -> std::string
+    {
+      if (member_results.empty() &&
+          !ddb.exec("SELECT " + d_dt_c_uuid + " AS uuid, e164 FROM conversations WHERE id IS ?", conv_id, &member_results))
+        return std::string();
+      return member_results.rows() ? member_results.valueAsString(0, column) : std::string();
+    };
 
     long long int deliveryreceiptcount = 0;
     long long int readreceiptcount = 0;
-    for (uint i = 0; i < status_results.rows(); ++i)
+    for (std::string const &details : msgjson.children("$.sendStateByConversationId"))
     {
-      if (status_results.valueAsString(i, "status") == "Delivered")
+      std::string conv_id = msgjson.key(details);
+      std::string status = msgjson.valueAsString(details + ".status");
+      std::any updated_timestamp = msgjson.isNull(details + ".updatedAt") ? msgjson.value("$.sent_at") : msgjson.value(details + ".updatedAt");
+      member_results.clear();
+
+      if (status == "Delivered")
       {
         ++deliveryreceiptcount;
-        if (isgroup && !status_results.isNull(i, "updated_timestamp")) // add per-group-member details to cdelivery_receipts table
+        if (isgroup && updated_timestamp.type() != typeid(std::nullptr_t)) // add per-group-member details to cdelivery_receipts table
         {
-          long long int member_id = getRecipientIdFromUuid(status_results.valueAsString(i, "uuid"), savedmap, createcontacts);
+          long long int member_id = getRecipientIdFromUuid(memberdata(conv_id, "uuid"), savedmap, createcontacts);
           if (member_id == -1) // try phone
-            member_id = getRecipientIdFromPhone(status_results.valueAsString(i, "e164"), savedmap, createcontacts);
+            member_id = getRecipientIdFromPhone(memberdata(conv_id, "e164"), savedmap, createcontacts);
           if (member_id == -1)
           {
             if (createcontacts)
             {
-              if ((member_id = dtCreateRecipient(ddb, status_results.valueAsString(i, "uuid"), std::string(), std::string(), databasedir, savedmap, warn)) == -1)
+              if ((member_id = dtCreateRecipient(ddb, memberdata(conv_id, "uuid"), std::string(), std::string(), databasedir, savedmap, warn)) == -1)
               {
                 std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to create delivery_receipt member. Skipping" << std::endl;
                 continue;
@@ -89,23 +95,23 @@ void SignalBackup::dtSetMessageDeliveryReceipts(SqliteDB const &ddb, long long i
           if (!insertRow("group_receipts", {{"mms_id", msg_id},
                                             {"address", member_id},
                                             {"status", STATUS_DELIVERED},
-                                            {"timestamp", status_results.getValueAs<long long int>(i, "updated_timestamp")}}))
+                                            {"timestamp", updated_timestamp}}))
             std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Inserting group_receipt" << std::endl;
         }
       }
-      else if (status_results.valueAsString(i, "status") == "Read")
+      else if (status == "Read")
       {
         ++readreceiptcount;
-        if (isgroup && !status_results.isNull(i, "updated_timestamp")) // add per-group-member details to cdelivery_receipts table
+        if (isgroup && updated_timestamp.type() != typeid(std::nullptr_t)) // add per-group-member details to cdelivery_receipts table
         {
-          long long int member_id = getRecipientIdFromUuid(status_results.valueAsString(i, "uuid"), savedmap, createcontacts);
+          long long int member_id = getRecipientIdFromUuid(memberdata(conv_id, "uuid"), savedmap, createcontacts);
           if (member_id == -1) // try phone
-            member_id = getRecipientIdFromPhone(status_results.valueAsString(i, "e164"), savedmap, createcontacts);
+            member_id = getRecipientIdFromPhone(memberdata(conv_id, "e164"), savedmap, createcontacts);
           if (member_id == -1)
           {
             if (createcontacts)
             {
-              if ((member_id = dtCreateRecipient(ddb, status_results.valueAsString(i, "uuid"), std::string(), std::string(), databasedir, savedmap, warn)) == -1)
+              if ((member_id = dtCreateRecipient(ddb, memberdata(conv_id, "uuid"), std::string(), std::string(), databasedir, savedmap, warn)) == -1)
               {
                 std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to create delivery_receipt member. Skipping" << std::endl;
                 continue;
@@ -120,7 +126,7 @@ void SignalBackup::dtSetMessageDeliveryReceipts(SqliteDB const &ddb, long long i
           if (!insertRow("group_receipts", {{"mms_id", msg_id},
                                             {"address", member_id},
                                             {"status", STATUS_READ},
-                                            {"timestamp", status_results.getValueAs<long long int>(i, "updated_timestamp")}}))
+                                            {"timestamp", updated_timestamp}}))
             std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Inserting group_receipt" << std::endl;
         }
       }
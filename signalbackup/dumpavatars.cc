@@ -21,6 +21,8 @@
 
 bool SignalBackup::dumpAvatars(std::string const &dir, std::vector<std::string> const &contacts, bool overwrite) const
 {
+  PhaseStats::Scope phase("dump avatars");
+
   std::cout << "Dumping avatars to dir '" << dir << "'" << std::endl;
 
   if (!d_database.containsTable("recipient"))
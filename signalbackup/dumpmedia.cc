@@ -18,9 +18,14 @@
 */
 
 #include "signalbackup.ih"
+#include "mediastore.h"
 
-bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite) const
+#include <unordered_map>
+
+bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite, bool dedupmedia) const
 {
+  PhaseStats::Scope phase("dump media");
+
   std::cout << "Dumping media to dir '" << dir << "'" << std::endl;
 
   if (!d_database.containsTable("part") || !d_database.tableContainsColumn("part", "display_order"))
@@ -50,112 +55,117 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
     }
   }
 
+  MediaStore mediastore;
+  if (dedupmedia && !initMediaStore(dir, &mediastore))
+    return false;
+
   MimeTypes mimetypes;
-  std::pair<std::vector<int>, std::vector<std::string>> conversations; // links thread_id to thread title, if the
-                                                                       // folder already exists, but from another _id,
-                                                                       // it is a different thread with the same name
 
-#if __cplusplus > 201703L
-  for (int count = 0; auto const &aframe : d_attachments)
-#else
-    int count = 0;
-  for (auto const &aframe : d_attachments)
-#endif
+  // get the info for all attachments in one go. Attachments in threads that were not
+  // selected are not in the results and are skipped before anything is decrypted.
+  bool fullbackup = false;
+  std::string query = "SELECT part._id, part.unique_id, part.mid, part.ct, part.file_name, part.display_order FROM part";
+  // if all tables for detailed info are present...
+  if (d_database.containsTable(d_mms_table) && d_database.containsTable("thread") &&
+      d_database.containsTable("groups") && d_database.containsTable("recipient"))
   {
+    fullbackup = true;
+    query = "SELECT part._id, part.unique_id, part.mid, part.ct, part.file_name, part.display_order, " +
+      d_mms_table + ".date_received, " + d_mms_table + "." + d_mms_type + ", " +
+      d_mms_table + ".thread_id, thread." + d_thread_recipient_id +
+      ", COALESCE(groups.title,recipient." + d_recipient_system_joined_name + ", recipient.profile_joined_name, "
+      "recipient." + d_recipient_profile_given_name + ")"
+      " AS 'chatpartner' FROM part "
+      "LEFT JOIN " + d_mms_table + " ON part.mid == " + d_mms_table + "._id "
+      "LEFT JOIN thread ON " + d_mms_table + ".thread_id == thread._id "
+      "LEFT JOIN recipient ON thread." + d_thread_recipient_id + " == recipient._id "
+      "LEFT JOIN groups ON recipient.group_id == groups.group_id";
+  }
 
-    ++count;
-    std::cout << "\33[2K\rSaving attachments...  " << count << "/" << d_attachments.size() << std::flush;
-
-    AttachmentFrame *a = aframe.second.get();
-
-    //std::cout << "Looking for attachment: " << std::endl;
-    //std::cout << "rid: " << a->rowId() << std::endl;
-    //std::cout << "uid: " << a->attachmentId() << std::endl;
-
-    SqliteDB::QueryResults results;
-
-    // minimal query, for incomplete database
-    bool fullbackup = false;
-    std::string query = "SELECT part.mid, part.ct, part.file_name, part.display_order FROM part WHERE part._id == ? AND part.unique_id == ?";
-    // if all tables for detailed info are present...
-    if (d_database.containsTable(d_mms_table) && d_database.containsTable("thread") &&
-        d_database.containsTable("groups") && d_database.containsTable("recipient"))
-    {
-      fullbackup = true;
-      query = "SELECT part.mid, part.ct, part.file_name, part.display_order, " +
-        d_mms_table + ".date_received, " + d_mms_table + "." + d_mms_type + ", " +
-        d_mms_table + ".thread_id, thread." + d_thread_recipient_id +
-        ", COALESCE(groups.title,recipient." + d_recipient_system_joined_name + ", recipient.profile_joined_name, "
-        "recipient." + d_recipient_profile_given_name + ")"
-        " AS 'chatpartner' FROM part "
-        "LEFT JOIN " + d_mms_table + " ON part.mid == " + d_mms_table + "._id "
-        "LEFT JOIN thread ON " + d_mms_table + ".thread_id == thread._id "
-        "LEFT JOIN recipient ON thread." + d_thread_recipient_id + " == recipient._id "
-        "LEFT JOIN groups ON recipient.group_id == groups.group_id "
-        "WHERE part._id == ? AND part.unique_id == ?";
-    }
+  if (!threads.empty())
+  {
+    query += " WHERE thread._id IN (";
+    for (uint i = 0; i < threads.size(); ++i)
+      query += bepaald::toString(threads[i]) + ((i == threads.size() - 1) ? ")" : ",");
+  }
 
-    if (!threads.empty())
-    {
-      query += " AND thread._id IN (";
-      for (uint i = 0; i < threads.size(); ++i)
-        query += bepaald::toString(threads[i]) + ((i == threads.size() - 1) ? ")" : ",");
-    }
+  SqliteDB::QueryResults results;
+  if (!d_database.exec(query, &results))
+    return false;
 
-    if (!d_database.exec(query, {static_cast<long long int>(a->rowId()), static_cast<long long int>(a->attachmentId())},  &results))
-      return false;
+  auto pairhash = [](std::pair<long long int, long long int> const &p)
+  {
+    return std::hash<long long int>()(p.first) ^ (std::hash<long long int>()(p.second) << 1);
+  };
+  std::unordered_map<std::pair<long long int, long long int>, uint, decltype(pairhash)> partrows(results.rows(), pairhash);
+  for (uint i = 0; i < results.rows(); ++i)
+    partrows.emplace(std::make_pair(results.valueAsInt(i, "_id"), results.valueAsInt(i, "unique_id")), i);
+
+  // decide on all file names first, the files can then be written in any order
+  struct MediaJob
+  {
+    AttachmentFrame *frame;
+    std::string filename; // full path
+    long long int datum;
+  };
+  std::vector<MediaJob> jobs;
+  jobs.reserve(partrows.size());
+  std::set<std::string> reserved; // file names taken by earlier jobs
 
-    //results.prettyPrint();
+  std::pair<std::vector<int>, std::vector<std::string>> conversations; // links thread_id to thread title, if the
+                                                                       // folder already exists, but from another _id,
+                                                                       // it is a different thread with the same name
 
-    if (results.rows() == 0 && !threads.empty()) // probably an attachment for a de-selected thread
-      continue;
+  for (auto const &aframe : d_attachments)
+  {
+    AttachmentFrame *a = aframe.second.get();
 
-    if (results.rows() != 1)
+    auto partrow = partrows.find({static_cast<long long int>(a->rowId()), static_cast<long long int>(a->attachmentId())});
+    if (partrow == partrows.end())
     {
-      std::cout << " ERROR Unexpected number of results: " << results.rows()
-                << " (rowid: " << a->rowId() << ", uniqueid: " << a->attachmentId() << ")" << std::endl;
+      if (threads.empty()) // else, probably an attachment for a de-selected thread
+        std::cout << " ERROR Unexpected number of results: 0"
+                  << " (rowid: " << a->rowId() << ", uniqueid: " << a->attachmentId() << ")" << std::endl;
       continue;
     }
+    uint row = partrow->second;
 
     std::string filename;
     long long int datum = a->attachmentId();
 
-    if (fullbackup && !results.isNull(0, "date_received"))
-      datum = results.getValueAs<long long int>(0, "date_received");
-    long long int order = results.getValueAs<long long int>(0, "display_order");
+    if (fullbackup && !results.isNull(row, "date_received"))
+      datum = results.getValueAs<long long int>(row, "date_received");
+    long long int order = results.getValueAs<long long int>(row, "display_order");
 
-    if (!results.isNull(0, "file_name")) // file name IS SET in database
-      filename = sanitizeFilename(results.valueAsString(0, "file_name"));
+    if (!results.isNull(row, "file_name")) // file name IS SET in database
+      filename = sanitizeFilename(results.valueAsString(row, "file_name"));
 
     if (filename.empty()) // filename was not set in database or was not impossible
     {                     // to sanitize (eg reserved name in windows 'COM1')
       // get datestring
-      std::time_t epoch = datum / 1000;
-      std::ostringstream tmp;
-      tmp << std::put_time(std::localtime(&epoch), "signal-%Y-%m-%d-%H%M%S");
-      //tmp << "." << datum % 1000;
+      std::string datestring = bepaald::toDateString(datum / 1000, "signal-%Y-%m-%d-%H%M%S");
 
       // get file ext
-      std::string mime = results.valueAsString(0, "ct");
+      std::string mime = results.valueAsString(row, "ct");
       std::string ext = std::string(mimetypes.getExtension(mime));
       if (ext.empty())
       {
         ext = "attach";
         std::cout << " WARNING: mimetype not found in database (" << mime
-                  << ") -> saving as '" << tmp.str() << "." << ext << "'" << std::endl;
+                  << ") -> saving as '" << datestring << "." << ext << "'" << std::endl;
       }
 
       //build filename
-      filename = tmp.str() + ((order) ? ("_" + bepaald::toString(order)) : "") + "." + ext;
+      filename = datestring + ((order) ? ("_" + bepaald::toString(order)) : "") + "." + ext;
     }
 
     // std::cout << "FILENAME: " << filename << std::endl;
     std::string targetdir = dir;
-    if (fullbackup && !results.isNull(0, "thread_id") && !results.isNull(0, "chatpartner")
-        && !results.isNull(0, d_mms_type))
+    if (fullbackup && !results.isNull(row, "thread_id") && !results.isNull(row, "chatpartner")
+        && !results.isNull(row, d_mms_type))
     {
-      long long int tid = results.getValueAs<long long int>(0, "thread_id");
-      std::string chatpartner = sanitizeFilename(results.valueAsString(0, "chatpartner"));
+      long long int tid = results.getValueAs<long long int>(row, "thread_id");
+      std::string chatpartner = sanitizeFilename(results.valueAsString(row, "chatpartner"));
       if (chatpartner.empty())
         chatpartner = "Contact " + bepaald::toString(tid);
 
@@ -192,7 +202,7 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
         }
       }
 
-      long long int msg_box = results.getValueAs<long long int>(0, d_mms_type);
+      long long int msg_box = results.getValueAs<long long int>(row, d_mms_type);
       targetdir = dir + "/" + conversations.second[idx_of_thread] + "/" + (Types::isOutgoing(msg_box) ? "sent" : "received");
 
       // create dir if not exists
@@ -208,57 +218,86 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
     }
 
     // make filename unique
-    if (!makeFilenameUnique(targetdir, &filename))
+    if (!makeFilenameUnique(targetdir, &filename, &reserved))
     {
       std::cout << " ERROR getting unique filename for '" << targetdir << "/" << filename << "'" << std::endl;
       continue;
     }
-    /*
-    while (bepaald::fileOrDirExists(targetdir + "/" + filename))
-    {
-      //std::cout << std::endl << "File exists: " << targetdir << "/" << filename << " -> ";
-
-      std::filesystem::path p(filename);
-      std::regex numberedfile(".*( \\(([0-9]*)\\))$");
-      std::smatch sm;
-      std::string filestem(p.stem().string());
-      std::string ext(p.extension().string());
-      int counter = 2;
-      if (regex_match(filestem, sm, numberedfile) && sm.size() >= 3 && sm[2].matched)
-      {
-        // increase the counter
-        counter = bepaald::toNumber<int>(sm[2]) + 1;
-        // remove " (xx)" part from stem
-        filestem.erase(sm[1].first, sm[1].second);
-      }
-      filename = filestem + " (" + bepaald::toString(counter) + ")" + p.extension().string();
+    reserved.insert(targetdir + "/" + filename);
+    jobs.push_back({a, targetdir + "/" + filename, datum});
+  }
 
-      //std::cout << filename << std::endl;
+  if (dedupmedia)
+  {
+    // the media store is shared by all files (and hard linked files share their timestamp), this is
+    // done in order. The attachments are still read ahead.
+    std::vector<FrameWithAttachment *> frames;
+    frames.reserve(jobs.size());
+    for (MediaJob const &job : jobs)
+      frames.push_back(job.frame);
+    AttachmentPrefetcher prefetcher(std::move(frames));
+
+    for (uint i = 0; i < jobs.size(); ++i)
+    {
+      prefetcher.advance(i);
+      std::cout << "\33[2K\rSaving attachments...  " << i + 1 << "/" << jobs.size() << std::flush;
+      if (writeAttachmentDeduplicated(jobs[i].frame, jobs[i].filename, &mediastore))
+        setFileTimeStamp(jobs[i].filename, jobs[i].datum); // ignoring return for now...
     }
-    */
-    std::ofstream attachmentstream(targetdir + "/" + filename, std::ios_base::binary);
+  }
+  else
+  {
+    // every file is written by one job, read them in the order they are in the backup file
+    std::stable_sort(jobs.begin(), jobs.end(), [](MediaJob const &lhs, MediaJob const &rhs)
+                                               { return lhs.frame->filepos() < rhs.frame->filepos(); });
 
-    if (!attachmentstream.is_open())
+    auto writemedia = [this](MediaJob const &job) -> std::string
     {
-      std::cout << " ERROR Failed to open file for writing: " << targetdir << "/" << filename << std::endl;
-      continue;
-    }
-    else
-      if (!attachmentstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
+      std::ofstream attachmentstream(job.filename, std::ios_base::binary);
+      if (!attachmentstream.is_open())
+        return " ERROR Failed to open file for writing: " + job.filename;
+
+      if (!attachmentstream.write(reinterpret_cast<char *>(job.frame->attachmentData()), job.frame->attachmentSize()))
       {
-        std::cout << " ERROR Failed to write data to file: " << targetdir << "/" << filename << std::endl;
-        a->clearData();
-        continue;
+        job.frame->clearData();
+        return " ERROR Failed to write data to file: " + job.filename;
       }
-    attachmentstream.close(); // need to close, or the auto-close will change files mtime again.
-    a->clearData();
-
-    setFileTimeStamp(targetdir + "/" + filename, datum); // ignoring return for now...
-
-    // !! ifdef c++20
-    //std::error_code ec;
-    //std::filesystem::last_write_time(dir + "/" + chatpartner + "/" + filename, std::chrono::clock_cast<std::filesystem::file_time_type>(datum / 1000), ec);
+      attachmentstream.close(); // need to close, or the auto-close will change files mtime again.
+      job.frame->clearData();
+
+      setFileTimeStamp(job.filename, job.datum); // ignoring return for now...
+
+      // !! ifdef c++20
+      //std::error_code ec;
+      //std::filesystem::last_write_time(dir + "/" + chatpartner + "/" + filename, std::chrono::clock_cast<std::filesystem::file_time_type>(datum / 1000), ec);
+      return std::string();
+    };
+
+    // at most a few jobs per thread are in flight, so only a few attachments are in memory at once
+    ThreadPool pool;
+    std::deque<std::future<std::string>> pending;
+    uint done = 0;
+    auto finishone = [&]()
+    {
+      std::string error = pending.front().get();
+      pending.pop_front();
+      std::cout << "\33[2K\rSaving attachments...  " << ++done << "/" << jobs.size() << std::flush;
+      if (!error.empty())
+        std::cout << error << std::endl;
+    };
+    for (MediaJob const &job : jobs)
+    {
+      if (pending.size() >= 4 * pool.size())
+        finishone();
+      pending.emplace_back(pool.submit([&writemedia, &job]() { return writemedia(job); }));
+    }
+    while (!pending.empty())
+      finishone();
   }
-  std::cout << std::endl << "done." << std::endl;
+
+  std::cout << std::endl;
+  if (dedupmedia)
+    std::cout << "Stored " << mediastore.stored << " distinct attachments, " << mediastore.duplicates << " duplicates were linked" << std::endl;
+  std::cout << "done." << std::endl;
   return true;
 }
@@ -0,0 +1,169 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+#include "mediastore.h"
+
+#ifndef USE_CRYPTOPP
+#include <openssl/sha.h>
+#endif
+
+/*
+  Writes every attachment as 'Attachment_<rowid>_<uniqueid>.sbf' and the decrypted data to a '.bin'
+  file of the same name. The attachments are read in the order they appear in the backup file, and
+  decrypted and written on the threadpool.
+
+  With dedupmedia, no '.bin' files are written. Instead, each distinct attachment is stored once
+  in '<directory>/.media/<sha256>.bin', and a '.ref' file (containing only the hash) takes the place of
+  the '.bin' file. Attachments that the database already knows to be identical (same data hash) are
+  decrypted only once.
+*/
+bool SignalBackup::exportAttachmentsToDir(std::string const &directory, bool keepattachmentdatainmemory, bool dedupmedia) const
+{
+  MediaStore mediastore;
+  std::unordered_map<long long int, std::string> datahashes;
+  if (dedupmedia)
+  {
+    if (!initMediaStore(directory, &mediastore))
+      return false;
+
+    SqliteDB::QueryResults res;
+    if (!mediastore.datahashcolumn.empty() &&
+        d_database.exec("SELECT _id, " + mediastore.datahashcolumn + " AS datahash FROM part WHERE datahash IS NOT NULL AND datahash != ''", &res))
+      for (uint i = 0; i < res.rows(); ++i)
+        datahashes.emplace(res.getValueAs<long long int>(i, "_id"), res.valueAsString(i, "datahash"));
+  }
+
+  // group the attachments, each group is decrypted once
+  std::vector<std::vector<AttachmentFrame *>> groups;
+  groups.reserve(d_attachments.size());
+  std::map<std::string, uint64_t> datahashgroups;
+  for (auto const &aframe : d_attachments)
+  {
+    AttachmentFrame *a = aframe.second.get();
+    if (auto dh = datahashes.find(a->rowId()); dh != datahashes.end())
+    {
+      auto [it, inserted] = datahashgroups.emplace(dh->second, groups.size());
+      if (!inserted)
+      {
+        groups[it->second].push_back(a);
+        continue;
+      }
+    }
+    groups.push_back({a});
+  }
+  std::stable_sort(groups.begin(), groups.end(), [](auto const &lhs, auto const &rhs)
+                                                 { return lhs.front()->filepos() < rhs.front()->filepos(); });
+
+  std::mutex storemutex;
+  std::set<std::string> storedhashes;
+  auto basefilename = [&directory](AttachmentFrame const *a)
+  {
+    return directory + "/Attachment_" + bepaald::toString(a->rowId()) + "_" + bepaald::toString(a->attachmentId());
+  };
+
+  auto writegroup = [&](std::vector<AttachmentFrame *> const &group) -> std::string
+  {
+    for (AttachmentFrame *a : group)
+      if (!writeRawFrameDataToFile(basefilename(a) + ".sbf", a))
+        return "Failed to write frame for attachment: " + basefilename(a) + ".sbf";
+
+    AttachmentFrame *a = group.front();
+    unsigned char *data = a->attachmentData();
+    if (!data)
+      return "Failed to get attachment data for: " + basefilename(a);
+
+    std::string error;
+    if (!dedupmedia)
+    {
+      std::ofstream attachmentstream(basefilename(a) + ".bin", std::ios_base::binary);
+      if (!attachmentstream.is_open())
+        error = "Failed to open file for writing: " + basefilename(a) + ".bin";
+      else if (!attachmentstream.write(reinterpret_cast<char *>(data), a->attachmentSize()))
+        error = "Failed to write file: " + basefilename(a) + ".bin";
+    }
+    else
+    {
+      unsigned char rawhash[SHA256_DIGEST_LENGTH];
+      if (EVP_Digest(data, a->attachmentSize(), rawhash, nullptr, EVP_sha256(), nullptr) != 1)
+        error = "Failed to hash attachment data for: " + basefilename(a);
+      else
+      {
+        std::string hash = bepaald::bytesToHexString(rawhash, SHA256_DIGEST_LENGTH, true);
+
+        bool store;
+        {
+          std::lock_guard<std::mutex> lock(storemutex);
+          store = storedhashes.insert(hash).second;
+          if (store)
+            ++mediastore.stored;
+          mediastore.duplicates += group.size() - (store ? 1 : 0);
+        }
+
+        std::string storedfile = mediastore.directory + "/" + hash + ".bin";
+        if (store)
+        {
+          std::ofstream storestream(storedfile, std::ios_base::binary);
+          if (!storestream.is_open() ||
+              !storestream.write(reinterpret_cast<char *>(data), a->attachmentSize()))
+            error = "Failed to write file: " + storedfile;
+        }
+
+        for (uint i = 0; i < group.size() && error.empty(); ++i)
+        {
+          std::ofstream refstream(basefilename(group[i]) + ".ref", std::ios_base::binary);
+          if (!refstream.is_open() || !(refstream << hash))
+            error = "Failed to write file: " + basefilename(group[i]) + ".ref";
+        }
+      }
+    }
+
+    if (!keepattachmentdatainmemory)
+      a->clearData();
+    return error;
+  };
+
+  // at most a few groups per thread are in flight, so only a few attachments are in memory at once
+  ThreadPool pool;
+  std::deque<std::future<std::string>> pending;
+  bool failed = false;
+  auto finishone = [&]()
+  {
+    std::string error = pending.front().get();
+    pending.pop_front();
+    if (!error.empty())
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": " << error << std::endl;
+      failed = true;
+    }
+  };
+  for (uint i = 0; i < groups.size() && !failed; ++i)
+  {
+    if (pending.size() >= 4 * pool.size())
+      finishone();
+    pending.emplace_back(pool.submit([&writegroup, &group = groups[i]]() { return writegroup(group); }));
+  }
+  while (!pending.empty())
+    finishone();
+
+  if (dedupmedia && !failed)
+    std::cout << " - Stored " << mediastore.stored << " distinct attachments, " << mediastore.duplicates << " duplicates were referenced" << std::endl;
+
+  return !failed;
+}
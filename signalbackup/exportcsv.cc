@@ -28,6 +28,8 @@ void SignalBackup::duplicateQuotes(std::string *s) const
 
 void SignalBackup::exportCsv(std::string const &filename, std::string const &table) const
 {
+  PhaseStats::Scope phase("export csv");
+
   /*
   if (checkFileExists(filename))
   {
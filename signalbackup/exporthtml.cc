@@ -25,13 +25,20 @@
 
 #include "signalbackup.ih"
 
+#include "htmlexportmanifest.h"
+#include "htmlsearchindex.h"
+#include "mediastore.h"
+
 #include <cerrno>
 
 bool SignalBackup::exportHtml(std::string const &directory, std::vector<long long int> const &limittothreads,
                               std::vector<std::string> const &daterangelist, long long int split,
                               std::string const &selfphone, bool calllog, bool searchpage, bool migrate,
-                              bool overwrite, bool append, bool lighttheme, bool themeswitching) const
+                              bool overwrite, bool append, bool lighttheme, bool themeswitching,
+                              bool dedupmedia) const
 {
+  PhaseStats::Scope phase("export html");
+
   bool databasemigrated = false;
   SqliteDB backup_database(":memory:");
 
@@ -151,7 +158,10 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
   std::vector<long long int> threads = ((limittothreads.empty() || (limittothreads.size() == 1 && limittothreads[0] == -1)) ?
                                         threadIds() : limittothreads);
 
+  // these are shared by all threads, every recipient, group and avatar is only handled once
   std::map<long long int, RecipientInfo> recipient_info;
+  std::map<long long int, std::string> written_avatars; // maps recipient_ids to the path of a written avatar file.
+  std::map<long long int, std::pair<GroupInfo, std::vector<long long int>>> groupinfo_cache;
 
   // set where-clause for date requested
   std::vector<std::pair<std::string, std::string>> dateranges;
@@ -191,20 +201,53 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
   //   if (skv->key() == "releasechannel.recipient_id")
   //     releasechannel = bepaald::toNumber<int>(skv->value());
 
-  SqliteDB::QueryResults search_idx_results;
-  std::ofstream searchidx;
-  bool searchidx_write_started = false;
-  // start search index page
+  MediaStore mediastore;
+  if (dedupmedia && !initMediaStore(directory, &mediastore))
+  {
+    if (databasemigrated)
+      SqliteDB::copyDb(backup_database, d_database);
+    return false;
+  }
+
+  // start search index
+  HTMLSearchIndex searchindex;
   if (searchpage)
   {
-    searchidx.open(directory + "/" + "searchidx.js", std::ios_base::binary);
-    if (!searchidx.is_open())
+    std::error_code ec;
+    std::filesystem::remove_all(directory + "/searchidx", ec); // shards of a previous export
+    if (!std::filesystem::create_directory(directory + "/searchidx", ec) || ec)
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
-                << ": Failed to open 'searchidx.js' for writing" << std::endl;
-     return false;
+                << ": Failed to create directory '" << directory << "/searchidx'" << std::endl;
+      if (databasemigrated)
+        SqliteDB::copyDb(backup_database, d_database);
+      return false;
     }
-    searchidx << "message_idx = [" << std::endl;
+  }
+
+  // the manifest records the pages written for each thread. When appending to an
+  // earlier export, pages whose content did not change are not regenerated.
+  HTMLExportManifest manifest;
+  HTMLExportManifest previous_manifest;
+  manifest.optionshash = HTMLExportManifest::s_hashinit;
+  HTMLExportManifest::hashAdd(&manifest.optionshash, VERSIONDATE);
+  HTMLExportManifest::hashAdd(&manifest.optionshash, d_databaseversion);
+  HTMLExportManifest::hashAdd(&manifest.optionshash, split);
+  HTMLExportManifest::hashAdd(&manifest.optionshash, datewhereclause);
+  HTMLExportManifest::hashAdd(&manifest.optionshash, note_to_self_thread_id);
+  HTMLExportManifest::hashAdd(&manifest.optionshash, lighttheme);
+  HTMLExportManifest::hashAdd(&manifest.optionshash, themeswitching);
+  HTMLExportManifest::hashAdd(&manifest.optionshash, searchpage);
+  bool incremental = false;
+  if (append && HTMLreadManifest(directory, &previous_manifest))
+  {
+    if (previous_manifest.optionshash == manifest.optionshash)
+    {
+      incremental = true;
+      manifest.threads = previous_manifest.threads; // keep entries for threads not exported this run
+    }
+    else
+      std::cout << "Export options changed since previous export, regenerating all pages" << std::endl;
   }
 
   for (uint t_idx = 0; t_idx < threads.size(); ++t_idx)
@@ -320,31 +363,209 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
       return false;
     }
 
-    // now append messages to html
-    std::map<long long int, std::string> written_avatars; // maps recipient_ids to the path of a written avatar file.
-    unsigned int messagecount = 0;
-    unsigned int max_msg_per_page = messages.rows();
-    int pagenumber = 0;
-    int totalpages = 1;
-    if (split > 0)
+    std::string raw_base_filename = (is_note_to_self ? "Note to self" : recipient_info[thread_recipient_id].display_name);
+    auto pagefilename = [&](int page)
     {
-      totalpages = (messages.rows() / split) + (messages.rows() % split > 0 ? 1 : 0);
-      max_msg_per_page = messages.rows() / totalpages + (messages.rows() % totalpages ? 1 : 0);
+      return sanitizeFilename(raw_base_filename + (page > 0 ? "_" + bepaald::toString(page) : "") + ".html");
+    };
+
+    // hash everything that ends up in the page header (thread name, avatars, group members)...
+    uint64_t headerhash = HTMLExportManifest::s_hashinit;
+    for (long long int rid : all_recipients_ids)
+    {
+      RecipientInfo const &ri = getRecipientInfoFromMap(&recipient_info, rid);
+      HTMLExportManifest::hashAdd(&headerhash, rid);
+      for (std::string const *field : {&ri.display_name, &ri.initial, &ri.uuid, &ri.phone, &ri.username,
+                                       &ri.color, &ri.wall_light, &ri.wall_dark})
+        HTMLExportManifest::hashAdd(&headerhash, *field);
+      HTMLExportManifest::hashAdd(&headerhash, ri.hasavatar);
+    }
+    if (isgroup)
+    {
+      SqliteDB::QueryResults groupdata;
+      d_database.exec("SELECT * FROM groups WHERE group_id = (SELECT group_id FROM recipient WHERE _id = ?)", thread_recipient_id, &groupdata);
+      for (uint c = 0; groupdata.rows() == 1 && c < groupdata.columns(); ++c)
+        HTMLExportManifest::hashAdd(&headerhash, groupdata.valueAsString(0, c));
     }
 
+    // ...and everything that ends up in the messages themselves
+    std::map<long long int, uint64_t> msg_extra_hashes;
+    SqliteDB::QueryResults msg_extra_data;
+    d_database.exec("SELECT message_id AS mid, emoji AS a, author_id AS b, date_sent AS c FROM reaction "
+                    "WHERE message_id IN (SELECT _id FROM " + d_mms_table + " WHERE thread_id = ?1) "
+                    "UNION ALL "
+                    "SELECT mid, _id, unique_id, ct || '/' || IFNULL(file_name, '') || '/' || pending_push FROM part "
+                    "WHERE mid IN (SELECT _id FROM " + d_mms_table + " WHERE thread_id = ?1) "
+                    "UNION ALL "
+                    "SELECT message_id, recipient_id, range_start, range_length FROM mention "
+                    "WHERE message_id IN (SELECT _id FROM " + d_mms_table + " WHERE thread_id = ?1) "
+                    "ORDER BY 1, 2, 3, 4", t, &msg_extra_data);
+    for (uint i = 0; i < msg_extra_data.rows(); ++i)
+    {
+      auto [it, inserted] = msg_extra_hashes.try_emplace(msg_extra_data.valueAsInt(i, "mid"), HTMLExportManifest::s_hashinit);
+      for (uint c = 1; c < msg_extra_data.columns(); ++c)
+        HTMLExportManifest::hashAdd(&it->second, msg_extra_data.valueAsString(i, c));
+    }
+    auto pagehash = [&](unsigned int begin, unsigned int end)
+    {
+      uint64_t hash = HTMLExportManifest::s_hashinit;
+      for (uint i = begin; i < end; ++i)
+      {
+        for (uint c = 0; c < messages.columns(); ++c)
+          HTMLExportManifest::hashAdd(&hash, messages.valueAsString(i, c));
+        auto it = msg_extra_hashes.find(messages.getValueAs<long long int>(i, "_id"));
+        HTMLExportManifest::hashAdd(&hash, (it != msg_extra_hashes.end()) ? static_cast<long long int>(it->second) : 0);
+      }
+      return hash;
+    };
+
+    // determine the pages. pageends[p] is one past the index of the last message on page p
+    std::vector<unsigned int> pageends;
+    int firstpagetowrite = 0;
+    HTMLExportManifest::Thread const *previous_export = nullptr;
+    if (incremental && bepaald::contains(previous_manifest.threads, thread_id))
+    {
+      previous_export = &previous_manifest.threads[thread_id];
+      if (previous_export->headerhash != headerhash ||
+          previous_export->threaddir != threaddir ||
+          previous_export->basefilename != raw_base_filename)
+        previous_export = nullptr;
+    }
+    if (previous_export)
+    {
+      // keep every previously exported page, up to the first one that changed...
+      unsigned int start = 0;
+      for (uint p = 0; p < previous_export->pages.size(); ++p)
+      {
+        HTMLExportManifest::Page const &page = previous_export->pages[p];
+        std::error_code ec;
+        if (start + page.messagecount > messages.rows() ||
+            messages.getValueAs<long long int>(start, "_id") != page.first_msg_id ||
+            messages.getValueAs<long long int>(start + page.messagecount - 1, "_id") != page.last_msg_id ||
+            std::filesystem::file_size(directory + "/" + threaddir + "/" + pagefilename(p), ec) < page.footeroffset || ec ||
+            pagehash(start, start + page.messagecount) != page.hash)
+          break;
+        start += page.messagecount;
+        pageends.push_back(start);
+      }
+
+      if (pageends.size() == previous_export->pages.size() && start == messages.rows()) // nothing changed
+        firstpagetowrite = pageends.size();
+      else if (split > 0 && pageends.size() + 1 >= previous_export->pages.size()) // only last page changed, or new messages
+      {
+        // ...but always redo the (possibly not yet full) last page of the previous export
+        if (pageends.size() == previous_export->pages.size())
+          pageends.pop_back();
+        firstpagetowrite = pageends.size();
+      }
+      else // an older page changed, redo the entire thread
+        pageends.clear();
+    }
+    unsigned int pagesstart = pageends.empty() ? 0 : pageends.back();
+    if (split > 0 && messages.rows() > pagesstart)
+    {
+      unsigned int remaining = messages.rows() - pagesstart;
+      unsigned int newpages = (remaining / split) + (remaining % split > 0 ? 1 : 0);
+      unsigned int max_msg_per_page = remaining / newpages + (remaining % newpages ? 1 : 0);
+      for (unsigned int end = pagesstart + max_msg_per_page; pageends.empty() || pageends.back() < messages.rows(); end += max_msg_per_page)
+        pageends.push_back(std::min(end, static_cast<unsigned int>(messages.rows())));
+    }
+    else if (pageends.empty() || pageends.back() < messages.rows())
+      pageends.push_back(messages.rows());
+    int totalpages = pageends.size();
+
     // std::cout << "Split: " << split << std::endl;
     // std::cout << "N MSG: " << messages.rows() << std::endl;
-    // std::cout << "MAX PER PAGE: " << max_msg_per_page << std::endl;
     // std::cout << "N PAGES: " << totalpages << std::endl;
 
+    HTMLExportManifest::Thread &thread_manifest = (manifest.threads[thread_id] = HTMLExportManifest::Thread{threaddir, raw_base_filename, headerhash,
+                                                                                                          messages.getValueAs<long long int>(messages.rows() - 1, "_id"),
+                                                                                                          messages.getValueAs<long long int>(messages.rows() - 1, "date_received"),
+                                                                                                          {}});
+
+    if (searchpage)
+    {
+      std::vector<std::string> pagepaths;
+      for (int p = 0; p < totalpages; ++p)
+        pagepaths.push_back(threaddir + "/" + pagefilename(p));
+      if (!HTMLaddToSearchIndex(directory, thread_id, thread_recipient_id, messages, pageends, pagepaths, &searchindex))
+      {
+        if (databasemigrated)
+          SqliteDB::copyDb(backup_database, d_database);
+        return false;
+      }
+    }
+
+    // pages kept from previous export: only fix the page navigation if the number of pages changed
+    for (int pagenumber = 0; pagenumber < firstpagetowrite; ++pagenumber)
+    {
+      HTMLExportManifest::Page const &page = previous_export->pages[pagenumber];
+      thread_manifest.pages.push_back(page);
+      std::string filename = pagefilename(pagenumber);
+      if (totalpages != static_cast<int>(previous_export->pages.size()))
+      {
+        std::error_code ec;
+        std::filesystem::resize_file(directory + "/" + threaddir + "/" + filename, page.footeroffset, ec);
+        std::ofstream htmloutput(directory + "/" + threaddir + "/" + filename, std::ios_base::binary | std::ios_base::app);
+        if (ec || !htmloutput.is_open())
+        {
+          std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off
+                    << ": Failed to open '" << directory << "/" << threaddir << "/" << filename << " for writing." << std::endl;
+          if (databasemigrated)
+            SqliteDB::copyDb(backup_database, d_database);
+          return false;
+        }
+        HTMLwritePageFooter(htmloutput, raw_base_filename, pagenumber, totalpages, thread_recipient_id, searchpage, themeswitching);
+      }
+    }
+    if (firstpagetowrite)
+      std::cout << "  Kept " << firstpagetowrite << " unchanged page" << (firstpagetowrite > 1 ? "s" : "") << " from previous export" << std::endl;
+
+    // now append messages to html
+    int pagenumber = firstpagetowrite;
+    unsigned int messagecount = (pagenumber > 0 ? pageends[pagenumber - 1] : 0);
+
     unsigned int daterangeidx = 0;
+    if (messagecount < messages.rows())
+      while (!dateranges.empty() &&
+             daterangeidx < dateranges.size() - 1 &&
+             messages.getValueAs<long long int>(messagecount, "date_received") > bepaald::toNumber<long long int>(dateranges[daterangeidx].second))
+        ++daterangeidx;
+
+    // read the attachments of the messages still to be written ahead, in file order
+    std::vector<FrameWithAttachment *> threadframes;
+    std::vector<std::size_t> msgframeidx(messages.rows(), 0); // index in threadframes of each message's first attachment
+    {
+      std::map<long long int, std::vector<FrameWithAttachment *>> msgframes;
+      SqliteDB::QueryResults parts;
+      d_database.exec("SELECT _id, unique_id, mid FROM part WHERE mid IN (SELECT _id FROM " + d_mms_table + " WHERE thread_id = ?) "
+                      "AND quote IS 0 ORDER BY _id", t, &parts);
+      for (uint i = 0; i < parts.rows(); ++i)
+      {
+        long long int rowid = parts.valueAsInt(i, "_id");
+        long long int uniqueid = parts.valueAsInt(i, "unique_id");
+        auto attachment = d_attachments.find({rowid, uniqueid});
+        if (attachment == d_attachments.end() ||
+            (append && bepaald::fileOrDirExists(directory + "/" + threaddir + "/media/Attachment_" + bepaald::toString(rowid) +
+                                                "_" + bepaald::toString(uniqueid) + ".bin"))) // will not be rewritten
+          continue;
+        msgframes[parts.valueAsInt(i, "mid")].push_back(attachment->second.get());
+      }
+      for (uint i = messagecount; i < messages.rows(); ++i)
+      {
+        msgframeidx[i] = threadframes.size();
+        if (auto it = msgframes.find(messages.getValueAs<long long int>(i, "_id")); it != msgframes.end())
+          threadframes.insert(threadframes.end(), it->second.begin(), it->second.end());
+      }
+    }
+    AttachmentPrefetcher prefetcher(std::move(threadframes));
 
-    while (true)
+    while (pagenumber < totalpages)
     {
       std::string previous_day_change;
       // create output-file
-      std::string raw_base_filename = (is_note_to_self ? "Note to self" : recipient_info[thread_recipient_id].display_name);
-      std::string filename = sanitizeFilename(raw_base_filename + (pagenumber > 0 ? "_" + bepaald::toString(pagenumber) : "") + ".html");
+      std::string filename = pagefilename(pagenumber);
+      unsigned int pagefirstmessage = messagecount;
       std::ofstream htmloutput(directory + "/" + threaddir + "/" + filename, std::ios_base::binary);
       if (!htmloutput.is_open())
       {
@@ -356,11 +577,12 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
       }
 
       // create start of html (css, head, start of body
-      HTMLwriteStart(htmloutput, thread_recipient_id, directory, threaddir, isgroup, is_note_to_self,
-                     all_recipients_ids, &recipient_info, &written_avatars, overwrite, append,
+      HTMLwriteStart(htmloutput, thread_recipient_id, directory, isgroup, is_note_to_self,
+                     all_recipients_ids, &recipient_info, &written_avatars, &groupinfo_cache, overwrite, append,
                      lighttheme, themeswitching, searchpage);
-      while (messagecount < (max_msg_per_page * (pagenumber + 1)))
+      while (messagecount < pageends[pagenumber])
       {
+        prefetcher.advance(msgframeidx[messagecount]);
 
         long long int msg_id = messages.getValueAs<long long int>(messagecount, "_id");
         long long int msg_recipient_id = messages.valueAsInt(messagecount, d_mms_recipient_id);
@@ -518,6 +740,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                                   &attachment_results,
                                   &reaction_results,
                                   &edit_revisions,
+                                  dedupmedia ? &mediastore : nullptr,
 
                                   body,
                                   quote_body,
@@ -531,56 +754,6 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
           });
         HTMLwriteMessage(htmloutput, msg_info, &recipient_info, searchpage);
 
-        if (searchpage && (!Types::isStatusMessage(msg_info.type) && !msg_info.body.empty()))
-        {
-          // because the body is already escaped for html at this point, we get it fresh from database (and have sqlite do the json formatting)
-          if (!d_database.exec("SELECT json_object("
-                               "'id', " + d_mms_table + "._id, "
-                               "'b', " + d_mms_table + ".body, "
-                               "'f', " + d_mms_table + "." + d_mms_recipient_id + ", "
-                               "'tr', thread." + d_thread_recipient_id + ", "
-                               "'o', (" + d_mms_table + "." + d_mms_type + " & 0x1F) IN (2,11,21,22,23,24,25,26), "
-                               "'d', " + d_mms_table + ".date_received, "
-                               "'p', " + "\"" + msg_info.threaddir + "/" + msg_info.filename + "\"" + ") AS line, "
-                               "part._id AS rowid, "
-                               "part.unique_id AS uniqueid "
-                               "FROM " + d_mms_table + " "
-                               "LEFT JOIN thread ON thread._id IS " + d_mms_table + ".thread_id "
-                               "LEFT JOIN part ON part.mid IS " + d_mms_table + "._id AND part.ct = 'text/x-signal-plain' "
-                               "WHERE " + d_mms_table + "._id = ?",
-                               msg_info.msg_id, &search_idx_results) ||
-              search_idx_results.rows() != 1)
-          {
-            std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
-                      << ": search_idx query failed " << search_idx_results.rows() << " results" << std::endl;
-            continue;
-          }
-
-          std::string line = search_idx_results("line");
-          if (line.empty()) [[unlikely]]
-            continue;
-
-          if (search_idx_results.valueAsInt(0, "rowid") != -1 &&
-              search_idx_results.valueAsInt(0, "uniqueid") != -1) [[unlikely]]
-          {
-            long long int rowid = search_idx_results.valueAsInt(0, "rowid");
-            long long int uniqueid = search_idx_results.valueAsInt(0, "uniqueid");
-            AttachmentFrame *a = d_attachments.at({rowid, uniqueid}).get();
-            std::string longbody = std::string(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize());
-            a->clearData();
-
-            longbody = d_database.getSingleResultAs<std::string>("SELECT json_set(?, '$.b', ?)", {line, longbody}, std::string());
-            if (!longbody.empty()) [[likely]]
-              line = longbody;
-          }
-
-          if (searchidx_write_started) [[likely]]
-            searchidx << "," << std::endl;
-
-          searchidx << "  " << line;
-          searchidx_write_started = true;
-        }
-
         if (++messagecount >= messages.rows())
           break;
 
@@ -595,7 +768,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
             daterangeidx < dateranges.size() - 1 && // dont split if it's the last range
             messages.getValueAs<long long int>(messagecount, "date_received") > bepaald::toNumber<long long int>(dateranges[daterangeidx].second))
         {
-          if (messagecount < (max_msg_per_page * (pagenumber + 1)))
+          if (messagecount < pageends[pagenumber])
           {
             //std::cout << "SPLITTING! (rangeend(" << daterangeidx << "): " << dateranges[daterangeidx].second << ")" << std::endl;
             htmloutput << "        </div>" << std::endl;
@@ -614,108 +787,14 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
       htmloutput << "      </div>" << std::endl; // closes conversation-wrapper
       htmloutput << std::endl;
 
-      HTMLescapeUrl(&raw_base_filename);
-
-      if (totalpages > 1)
-      {
-        htmloutput << "      <div class=\"conversation-link conversation-link-left\">" << std::endl;
-        htmloutput << "        <div title=\"First page\">" << std::endl;
-        htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + ".html") << "\">" << std::endl;
-        htmloutput << "            <div class=\"menu-icon nav-max" << (pagenumber > 0 ? "" : " nav-disabled") << "\"></div>" << std::endl;
-        htmloutput << "          </a>" << std::endl;
-        htmloutput << "        </div>" << std::endl;
-        htmloutput << "        <div title=\"Previous page\">" << std::endl;
-        htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + (pagenumber - 1 > 0 ? ("_" + bepaald::toString(pagenumber - 1)) : "") + ".html") << "\">" << std::endl;
-        htmloutput << "            <div class=\"menu-icon nav-one" << (pagenumber > 0 ? "" : " nav-disabled") << "\"></div>" << std::endl;
-        htmloutput << "          </a>" << std::endl;
-        htmloutput << "        </div>" << std::endl;
-        htmloutput << "      </div>" << std::endl;
-        htmloutput << "      <div class=\"conversation-link conversation-link-right\">" << std::endl;
-        htmloutput << "        <div title=\"Next page\">" << std::endl;
-        htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + "_" + (pagenumber + 1 <= totalpages - 1 ?  bepaald::toString(pagenumber + 1) : bepaald::toString(totalpages - 1)) + ".html") << "\">" << std::endl;
-        htmloutput << "            <div class=\"menu-icon nav-one nav-fwd" << (pagenumber < totalpages - 1 ? "" : " nav-disabled") << "\"></div>" << std::endl;
-        htmloutput << "          </a>" << std::endl;
-        htmloutput << "        </div>" << std::endl;
-        htmloutput << "        <div title=\"Last page\">" << std::endl;
-        htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + "_" + bepaald::toString(totalpages - 1) + ".html") << "\">" << std::endl;
-        htmloutput << "            <div class=\"menu-icon nav-max nav-fwd" << (pagenumber < totalpages - 1 ? "" : " nav-disabled") << "\"></div>" << std::endl;
-        htmloutput << "          </a>" << std::endl;
-        htmloutput << "        </div>" << std::endl;
-        htmloutput << "      </div>" << std::endl;
-        htmloutput << std::endl;
-      }
-      htmloutput << "     </div>" << std::endl; // closes controls-wrapper
-      htmloutput << std::endl;
-      htmloutput << "       <div id=\"bottom\">" << std::endl;
-      htmloutput << "         <a href=\"#pagebottom\" title=\"Jump to bottom\">" << std::endl;
-      htmloutput << "           <div class=\"menu-item-bottom\">" << std::endl;
-      htmloutput << "             <span class=\"menu-icon nav-one nav-bottom\">" << std::endl;
-      htmloutput << "             </span>" << std::endl;
-      htmloutput << "           </div>" << std::endl;
-      htmloutput << "         </a>" << std::endl;
-      htmloutput << "      </div>" << std::endl;
-      htmloutput << "      <div id=\"menu\">" << std::endl;
-      htmloutput << "        <a href=\"../index.html\">" << std::endl;
-      htmloutput << "          <div class=\"menu-item\">" << std::endl;
-      htmloutput << "            <div class=\"menu-icon nav-up\">" << std::endl;
-      htmloutput << "            </div>" << std::endl;
-      htmloutput << "            <div>" << std::endl;
-      htmloutput << "              index" << std::endl;
-      htmloutput << "            </div>" << std::endl;
-      htmloutput << "          </div>" << std::endl;
-      htmloutput << "        </a>" << std::endl;
-      htmloutput << "      </div>" << std::endl;
-      htmloutput << std::endl;
-      if (themeswitching || searchpage)
-      {
-        htmloutput << "      <div id=\"theme\">" << std::endl;
-        if (searchpage)
-        {
-          htmloutput << "        <div class=\"menu-item\">" << std::endl;
-          htmloutput << "          <a href=\"../searchpage.html?recipient=" << thread_recipient_id << "\" title=\"Search\">" << std::endl;
-          htmloutput << "            <span class=\"menu-icon searchbutton\">" << std::endl;
-          htmloutput << "            </span>" << std::endl;
-          htmloutput << "          </a>" << std::endl;
-          htmloutput << "        </div>" << std::endl;
-        }
-        if (themeswitching)
-        {
-          htmloutput << "        <div class=\"menu-item\">" << std::endl;
-          htmloutput << "          <label for=\"theme-switch\">" << std::endl;
-          htmloutput << "            <span class=\"menu-icon themebutton\">" << std::endl;
-          htmloutput << "            </span>" << std::endl;
-          htmloutput << "          </label>" << std::endl;
-          htmloutput << "        </div>" << std::endl;
-        }
-        htmloutput << "      </div>" << std::endl;
-        htmloutput << std::endl;
-      }
-      htmloutput << "  </div>" << std::endl; // closes div id=page (I think)
-      if (themeswitching)
-      {
-        htmloutput << R"(  <script>
-    const themeSwitch = document.querySelector('#theme-switch');
-    themeSwitch.addEventListener('change', function(e)
-    {
-      if (e.currentTarget.checked === true)
-      {
-        //alert('Setting theme light');
-        setCookie('theme', 'light');
-        document.documentElement.dataset.theme = 'light';
-      }
-      else
-      {
-        //alert('Setting theme dark');
-        setCookie('theme', 'dark');
-        document.documentElement.dataset.theme = 'dark';
-      }
-    });
-  </script>
+      uint64_t footeroffset = htmloutput.tellp();
+      HTMLwritePageFooter(htmloutput, raw_base_filename, pagenumber, totalpages, thread_recipient_id, searchpage, themeswitching);
 
-)";
-      }
-      htmloutput << "  </body>" << std::endl;
-      htmloutput << "</html>" << std::endl;
+      thread_manifest.pages.push_back({messages.getValueAs<long long int>(pagefirstmessage, "_id"),
+                                       messages.getValueAs<long long int>(messagecount - 1, "_id"),
+                                       messagecount - pagefirstmessage,
+                                       pagehash(pagefirstmessage, messagecount),
+                                       footeroffset});
 
       ++pagenumber;
       if (messagecount >= messages.rows())
@@ -723,26 +802,14 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
     }
   }
 
-  if (searchpage)
-  {
-    if (searchidx_write_started) [[likely]]
-      searchidx << std::endl << "];" << std::endl;
+  // a failed manifest is not fatal, the next --append will just regenerate everything
+  HTMLwriteManifest(directory, manifest);
 
-    // write recipient info:
-    //std::map<long long int, RecipientInfo> recipient_info;
-    searchidx << "recipient_idx = [" << std::endl;
-    for (auto r = recipient_info.begin(); r != recipient_info.end(); ++r)
-    {
-      std::string line = d_database.getSingleResultAs<std::string>("SELECT json_object('_id', ?, 'display_name', ?)", {r->first, r->second.display_name}, std::string());
-      if (line.empty()) [[unlikely]]
-        continue;
-
-      searchidx << "  " << line;
-      if (std::next(r) != recipient_info.end()) [[likely]]
-        searchidx << "," << std::endl;
-      else
-        searchidx << std::endl << "];" << std::endl;
-    }
+  if (searchpage && !HTMLwriteSearchIndex(directory, &searchindex, &recipient_info))
+  {
+    if (databasemigrated)
+      SqliteDB::copyDb(backup_database, d_database);
+    return false;
   }
 
   // disable calllog if not presents in database, or it is empty
@@ -750,16 +817,19 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
       d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM call", -1) == 0)
     calllog = false;
 
-  HTMLwriteIndex(threads, directory, &recipient_info, note_to_self_thread_id,
+  HTMLwriteIndex(threads, directory, &recipient_info, &written_avatars, note_to_self_thread_id,
                  calllog, searchpage, overwrite, append, lighttheme, themeswitching);
 
   if (calllog)
-    HTMLwriteCallLog(threads, directory, &recipient_info, note_to_self_thread_id,
+    HTMLwriteCallLog(threads, directory, &recipient_info, &written_avatars, note_to_self_thread_id,
                      overwrite, append, lighttheme, themeswitching);
 
   if (searchpage)
     HTMLwriteSearchpage(directory, lighttheme, themeswitching);
 
+  if (dedupmedia)
+    std::cout << "Stored " << mediastore.stored << " distinct attachments, " << mediastore.duplicates << " duplicates were linked" << std::endl;
+
   std::cout << "All done!" << std::endl;
   if (databasemigrated)
   {
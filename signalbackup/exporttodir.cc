@@ -19,8 +19,11 @@
 
 #include "signalbackup.ih"
 
-bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb)
+bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb,
+                                     bool dedupmedia)
 {
+  PhaseStats::Scope phase("export backup");
+
   std::cout << std::endl << "Exporting backup into '" << directory << "/'" << std::endl;
 
   // maybe check directory exists, and is empty or make it empty if overwrite was requested.
@@ -53,33 +56,8 @@ bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrit
 
     // export attachments
     std::cout << "Writing Attachments..." << std::endl;
-    for (auto const &aframe : d_attachments)
-    {
-      AttachmentFrame *a = aframe.second.get();
-      std::string attachment_basefilename = directory + "/Attachment_" + bepaald::toString(a->rowId()) + "_" + bepaald::toString(a->attachmentId());
-
-      // write frame
-      if (!writeRawFrameDataToFile(attachment_basefilename + ".sbf", a))
-        return false;
-
-      // write actual attachment:
-      std::ofstream attachmentstream(attachment_basefilename + ".bin", std::ios_base::binary);
-      if (!attachmentstream.is_open())
-      {
-        std::cout << "Failed to open file for writing: " << directory << attachment_basefilename << ".bin" << std::endl;
-        return false;
-      }
-      else
-        if (!attachmentstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
-          return false;
-
-      if (!keepattachmentdatainmemory)
-      {
-        MEMINFO("BEFORE DROPPING ATTACHMENT DATA");
-        a->clearData();
-        MEMINFO("AFTER DROPPING ATTACHMENT DATA");
-      }
-    }
+    if (!exportAttachmentsToDir(directory, keepattachmentdatainmemory, dedupmedia))
+      return false;
 
     // export avatars
     std::cout << "Writing Avatars..." << std::endl;
@@ -110,6 +88,9 @@ bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrit
       else
         if (!avatarstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
           return false;
+
+      if (!keepattachmentdatainmemory)
+        a->clearData();
     }
 
     // export sharedpreferences
@@ -160,6 +141,9 @@ bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrit
       else
         if (!stickerstream.write(reinterpret_cast<char *>(s->attachmentData()), s->attachmentSize()))
           return false;
+
+      if (!keepattachmentdatainmemory)
+        s->clearData();
     }
 
     // export endframe
@@ -21,6 +21,8 @@
 
 bool SignalBackup::exportBackupToFile(std::string const &filename, std::string const &passphrase, bool overwrite, bool keepattachmentdatainmemory)
 {
+  PhaseStats::Scope phase("export backup");
+
   std::cout << std::endl << "Exporting backup to '" << filename << "'" << std::endl;
 
   std::string newpw = passphrase;
@@ -148,6 +150,29 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
 
     d_database.exec("SELECT * FROM " + table, &results);
 
+    // every part-row is followed by its attachment, read those ahead (in file order) while writing
+    std::unique_ptr<AttachmentPrefetcher> prefetcher;
+    if (table == "part")
+    {
+      std::vector<FrameWithAttachment *> partframes(results.rows(), nullptr);
+      int idcol = -1;
+      int uniqueidcol = -1;
+      for (uint j = 0; j < results.columns(); ++j)
+        if (results.header(j) == "_id")
+          idcol = j;
+        else if (results.header(j) == "unique_id")
+          uniqueidcol = j;
+      for (uint i = 0; idcol != -1 && i < results.rows(); ++i)
+      {
+        uint64_t rowid = results.valueHasType<long long int>(i, idcol) ? results.getValueAs<long long int>(i, idcol) : 0;
+        uint64_t uniqueid = (uniqueidcol != -1 && results.valueHasType<long long int>(i, uniqueidcol)) ?
+          results.getValueAs<long long int>(i, uniqueidcol) : 0;
+        if (auto attachment = d_attachments.find({rowid, uniqueid}); attachment != d_attachments.end())
+          partframes[i] = attachment->second.get();
+      }
+      prefetcher.reset(new AttachmentPrefetcher(std::move(partframes)));
+    }
+
     if (!d_showprogress)
       std::cout << "  Dealing with table '" << table << "'... " << std::flush;
 
@@ -164,6 +189,7 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
 
       if (table == "part") // find corresponding attachment
       {
+        prefetcher->advance(i);
         uint64_t rowid = 0, uniqueid = 0;
         for (uint j = 0; j < results.columns(); ++j)
         {
@@ -24,6 +24,8 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
                              std::vector<std::string> const &daterangelist, std::string const &selfphone [[maybe_unused]],
                              bool migrate, bool overwrite) const
 {
+  PhaseStats::Scope phase("export txt");
+
   bool databasemigrated = false;
   SqliteDB backup_database(":memory:");
 
@@ -178,10 +180,18 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
   std::sort(dateranges.begin(), dateranges.end());
 
 
-  // handle each thread
+  // Threads are prepared serially (resolving recipient info needs to write to the shared map and may
+  // hit the database a lot), then each thread is formatted and written to its own file on a thread pool.
+  // Messages are read in pages (keyset-paginated on (date_received, _id)), so a worker never holds
+  // more than one page of a thread in memory.
+  struct TxtJob
+  {
+    long long int thread_id;
+    std::string filename;
+  };
+  std::vector<TxtJob> jobs;
   for (int t : threads)
   {
-
     std::cout << "Dealing with thread " << t << std::endl;
 
     //bool is_note_to_self = false;//(t == note_to_self_thread_id);
@@ -198,40 +208,8 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
     }
     long long int thread_id = recid.getValueAs<long long int>(0, "_id");
 
-    // bool isgroup = false;
-    // SqliteDB::QueryResults groupcheck;
-    // d_database.exec("SELECT group_id FROM recipient WHERE _id = ? AND group_id IS NOT NULL", thread_recipient_id, &groupcheck);
-    // if (groupcheck.rows())
-    //   isgroup = true;
-
-    // now get all messages
-    SqliteDB::QueryResults messages;
-    if (!d_database.exec("SELECT "s
-                         "_id, " + d_mms_recipient_id + ", body, "
-                         "date_received, " + d_mms_type + ", "
-                         //"quote_id, quote_author, quote_body, quote_mentions, "
-                         //"delivery_receipt_count, read_receipt_count, "
-                         "IFNULL(remote_deleted, 0) AS remote_deleted, "
-                         "IFNULL(view_once, 0) AS view_once, "
-                         "expires_in"
-                         //, message_ranges, "
-                         //+ (d_database.tableContainsColumn(d_mms_table, "original_message_id") ? "original_message_id, " : "") +
-                         //+ (d_database.tableContainsColumn(d_mms_table, "revision_number") ? "revision_number, " : "") +
-                         //"json_extract(link_previews, '$[0].title') AS link_preview_title, "
-                         //"json_extract(link_previews, '$[0].description') AS link_preview_description "
-                         " FROM " + d_mms_table + " "
-                         "WHERE thread_id = ?"
-                         + datewhereclause +
-                         + (d_database.tableContainsColumn(d_mms_table, "latest_revision_id") ? " AND latest_revision_id IS NULL" : "") +
-                         " ORDER BY date_received ASC", t, &messages))
-    {
-      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
-                << ": Failed to query database for messages" << std::endl;
-      if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
-      return false;
-    }
-    if (messages.rows() == 0)
+    if (d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM " + d_mms_table + " WHERE thread_id = ?" + datewhereclause +
+                                                    (d_database.tableContainsColumn(d_mms_table, "latest_revision_id") ? " AND latest_revision_id IS NULL" : ""), t, 0) == 0)
       continue;
 
     // get all recipients in thread (group member (past and present), quote/reaction authors, mentions)
@@ -251,7 +229,8 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
     std::string filename = /*(is_note_to_self ? "Note to self (_id"s + bepaald::toString(thread_id) + ")"
                              : */sanitizeFilename(recipient_info[thread_recipient_id].display_name + " (_id" + bepaald::toString(thread_id) + ").txt")/*)*/;
 
-    if (bepaald::fileOrDirExists(directory + "/" + filename))
+    if (bepaald::fileOrDirExists(directory + "/" + filename) ||
+        std::any_of(jobs.begin(), jobs.end(), [&](TxtJob const &j) { return j.filename == filename; }))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Refusing to overwrite existing file" << std::endl;
@@ -259,100 +238,176 @@ bool SignalBackup::exportTxt(std::string const &directory, std::vector<long long
         SqliteDB::copyDb(backup_database, d_database);
       return false;
     }
+    jobs.push_back({thread_id, std::move(filename)});
+  }
 
-    std::ofstream txtoutput(directory + "/" + filename, std::ios_base::binary);
+  // from here on, recipient_info is only read
+  auto displayname = [&recipient_info](long long int rid) -> std::string const &
+  {
+    static std::string const unknown("(unknown)");
+    auto it = recipient_info.find(rid);
+    return it != recipient_info.end() ? it->second.display_name : unknown;
+  };
+
+  std::string const messagesquery("SELECT "s
+                                  "_id, " + d_mms_recipient_id + ", body, "
+                                  "date_received, " + d_mms_type + ", "
+                                  //"quote_id, quote_author, quote_body, quote_mentions, "
+                                  //"delivery_receipt_count, read_receipt_count, "
+                                  "IFNULL(remote_deleted, 0) AS remote_deleted, "
+                                  "IFNULL(view_once, 0) AS view_once, "
+                                  "expires_in"
+                                  //, message_ranges, "
+                                  //+ (d_database.tableContainsColumn(d_mms_table, "original_message_id") ? "original_message_id, " : "") +
+                                  //+ (d_database.tableContainsColumn(d_mms_table, "revision_number") ? "revision_number, " : "") +
+                                  //"json_extract(link_previews, '$[0].title') AS link_preview_title, "
+                                  //"json_extract(link_previews, '$[0].description') AS link_preview_description "
+                                  " FROM " + d_mms_table + " "
+                                  "WHERE thread_id = ?"
+                                  + datewhereclause +
+                                  + (d_database.tableContainsColumn(d_mms_table, "latest_revision_id") ? " AND latest_revision_id IS NULL" : "") +
+                                  " AND (IFNULL(date_received, 0), _id) > (?, ?)"
+                                  " ORDER BY IFNULL(date_received, 0), _id ASC LIMIT 1000");
+  bool const hasmentiontable = d_database.containsTable("mention");
+
+  auto writethread = [&](TxtJob const &job) -> bool
+  {
+    std::ofstream txtoutput(directory + "/" + job.filename, std::ios_base::binary);
     if (!txtoutput.is_open())
     {
       std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off
-                << ": Failed to open '" << directory << "/" << filename << " for writing." << std::endl;
-      if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
+                << ": Failed to open '" << directory << "/" << job.filename << " for writing." << std::endl;
       return false;
     }
 
-    for (uint i = 0; i < messages.rows(); ++i)
+    SqliteDB::QueryResults messages;
+    long long int lastdate = std::numeric_limits<long long int>::min();
+    long long int lastid = std::numeric_limits<long long int>::min();
+    while (true)
     {
-      bool is_deleted = messages.getValueAs<long long int>(i, "remote_deleted") == 1;
-      bool is_viewonce = messages.getValueAs<long long int>(i, "view_once") == 1;
-      if (is_deleted || is_viewonce)
-        continue;
-
-      long long int msg_id = messages.getValueAs<long long int>(i, "_id");
-      //bool incoming = !Types::isOutgoing(messages.getValueAs<long long int>(i, d_mms_type));
-      long long int msg_recipient_id = messages.valueAsInt(i, d_mms_recipient_id);
-      if (msg_recipient_id == -1) [[unlikely]]
+      if (!d_database.exec(messagesquery, {job.thread_id, lastdate, lastid}, &messages))
       {
-        std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
-                  << ": Failed to get message recipient id. Skipping." << std::endl;
-        continue;
+        std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                  << ": Failed to query database for messages" << std::endl;
+        return false;
       }
-      std::string body = messages.valueAsString(i, "body");
-      long long int type = messages.getValueAs<long long int>(i, d_mms_type);
-      std::string readable_date = bepaald::toDateString(messages.getValueAs<long long int>(i, "date_received") / 1000,
+      if (messages.rows() == 0)
+        break;
+      lastdate = getIntOr(messages, messages.rows() - 1, "date_received", 0);
+      lastid = messages.getValueAs<long long int>(messages.rows() - 1, "_id");
+
+      // format the page into a buffer first, one write per page
+      std::ostringstream out;
+      for (uint i = 0; i < messages.rows(); ++i)
+      {
+        bool is_deleted = messages.getValueAs<long long int>(i, "remote_deleted") == 1;
+        bool is_viewonce = messages.getValueAs<long long int>(i, "view_once") == 1;
+        if (is_deleted || is_viewonce)
+          continue;
+
+        long long int msg_id = messages.getValueAs<long long int>(i, "_id");
+        //bool incoming = !Types::isOutgoing(messages.getValueAs<long long int>(i, d_mms_type));
+        long long int msg_recipient_id = messages.valueAsInt(i, d_mms_recipient_id);
+        if (msg_recipient_id == -1) [[unlikely]]
+        {
+          std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
+                    << ": Failed to get message recipient id. Skipping." << std::endl;
+          continue;
+        }
+        std::string body = messages.valueAsString(i, "body");
+        long long int type = messages.getValueAs<long long int>(i, d_mms_type);
+        std::string readable_date = bepaald::toDateString(messages.getValueAs<long long int>(i, "date_received") / 1000,
                                                           "%b %d, %Y %H:%M:%S");
-      SqliteDB::QueryResults attachment_results;
-      d_database.exec("SELECT _id,unique_id,ct,file_name,pending_push,sticker_pack_id FROM part WHERE mid IS ? AND quote IS 0", msg_id, &attachment_results);
+        SqliteDB::QueryResults attachment_results;
+        d_database.exec("SELECT _id,unique_id,ct,file_name,pending_push,sticker_pack_id FROM part WHERE mid IS ? AND quote IS 0", msg_id, &attachment_results);
         // check attachments for long message body -> replace cropped body & remove from attachment results
         setLongMessageBody(&body, &attachment_results);
 
-      SqliteDB::QueryResults mention_results;
-      if (d_database.containsTable("mention"))
-        d_database.exec("SELECT recipient_id, range_start, range_length FROM mention WHERE message_id IS ?", msg_id, &mention_results);
+        SqliteDB::QueryResults mention_results;
+        if (hasmentiontable)
+          d_database.exec("SELECT recipient_id, range_start, range_length FROM mention WHERE message_id IS ?", msg_id, &mention_results);
 
-      SqliteDB::QueryResults reaction_results;
-      d_database.exec("SELECT emoji, author_id, DATETIME(ROUND(date_sent / 1000), 'unixepoch', 'localtime') AS 'date_sent', "
-                      "DATETIME(ROUND(date_received / 1000), 'unixepoch', 'localtime') AS 'date_received' "
-                      "FROM reaction WHERE message_id IS ?", msg_id, &reaction_results);
+        SqliteDB::QueryResults reaction_results;
+        d_database.exec("SELECT emoji, author_id, DATETIME(ROUND(date_sent / 1000), 'unixepoch', 'localtime') AS 'date_sent', "
+                        "DATETIME(ROUND(date_received / 1000), 'unixepoch', 'localtime') AS 'date_received' "
+                        "FROM reaction WHERE message_id IS ?", msg_id, &reaction_results);
 
-      if (Types::isStatusMessage(type) || Types::isCallType(type))
-      {
-        std::string statusmsg = decodeStatusMessage(body, messages.getValueAs<long long int>(i, "expires_in"), type, getRecipientInfoFromMap(&recipient_info, msg_recipient_id).display_name);
-        txtoutput << "[" << readable_date << "] " << "***" << " " << statusmsg <<  std::endl;
-      }
-      else
-      {
-        // get originating username
-        std::string user = getRecipientInfoFromMap(&recipient_info, msg_recipient_id).display_name;
-
-        for (uint a = 0; a < attachment_results.rows(); ++a)
+        if (Types::isStatusMessage(type) || Types::isCallType(type))
         {
-          std::string content_type = attachment_results.valueAsString(a, "ct");
-          std::string attachment_filename;
-          if (!attachment_results.isNull(a, "file_name") && !attachment_results(a, "file_name").empty())
-            attachment_filename = '"' + attachment_results(a, "file_name") + '"';
-          else if (!content_type.empty())
-            attachment_filename = "of type " + content_type;
-
-          txtoutput << "[" << readable_date << "] *** <" << user << "> sent file"
-                    << (attachment_filename.empty() ? "" : " " + attachment_filename);
-          if (body.empty())
-            TXTaddReactions(&reaction_results, &txtoutput);
-          txtoutput << std::endl;
+          std::string statusmsg = decodeStatusMessage(body, messages.getValueAs<long long int>(i, "expires_in"), type, displayname(msg_recipient_id));
+          out << "[" << readable_date << "] " << "***" << " " << statusmsg << '\n';
         }
-        if (!body.empty())
+        else
         {
-          // prep body for mentions...
-          std::vector<Range> ranges;
-          for (uint m = 0; m < mention_results.rows(); ++m)
+          // get originating username
+          std::string const &user = displayname(msg_recipient_id);
+
+          for (uint a = 0; a < attachment_results.rows(); ++a)
           {
-            std::string displayname = getNameFromRecipientId(mention_results.getValueAs<long long int>(m, "recipient_id"));
-            if (displayname.empty())
-              continue;
-            ranges.emplace_back(Range{mention_results.getValueAs<long long int>(m, "range_start"),
-                                      mention_results.getValueAs<long long int>(m, "range_length"),
-                                      "",
-                                      "@" + displayname,
-                                      "",
-                                      false});
+            std::string content_type = attachment_results.valueAsString(a, "ct");
+            std::string attachment_filename;
+            if (!attachment_results.isNull(a, "file_name") && !attachment_results(a, "file_name").empty())
+              attachment_filename = '"' + attachment_results(a, "file_name") + '"';
+            else if (!content_type.empty())
+              attachment_filename = "of type " + content_type;
+
+            out << "[" << readable_date << "] *** <" << user << "> sent file"
+                << (attachment_filename.empty() ? "" : " " + attachment_filename);
+            if (body.empty())
+              TXTaddReactions(&reaction_results, &out);
+            out << '\n';
+          }
+          if (!body.empty())
+          {
+            // prep body for mentions...
+            std::vector<Range> ranges;
+            for (uint m = 0; m < mention_results.rows(); ++m)
+            {
+              std::string mentionname = getNameFromRecipientId(mention_results.getValueAs<long long int>(m, "recipient_id"));
+              if (mentionname.empty())
+                continue;
+              ranges.emplace_back(Range{mention_results.getValueAs<long long int>(m, "range_start"),
+                                        mention_results.getValueAs<long long int>(m, "range_length"),
+                                        "",
+                                        "@" + mentionname,
+                                        "",
+                                        false});
+            }
+            applyRanges(&body, &ranges, nullptr);
+
+            out << "[" << readable_date << "] <" << user << "> " << body;
+            TXTaddReactions(&reaction_results, &out);
+            out << '\n';
           }
-          applyRanges(&body, &ranges, nullptr);
-
-          txtoutput << "[" << readable_date << "] <" << user << "> " << body;
-          TXTaddReactions(&reaction_results, &txtoutput);
-          txtoutput << std::endl;
         }
       }
+      txtoutput << std::move(out).str();
+      if (messages.rows() < 1000)
+        break;
     }
+    return txtoutput.good();
+  };
+
+  bool success = true;
+  if (sqlite3_threadsafe() == 1) [[likely]] // connection may only be shared between threads in serialized mode
+  {
+    ThreadPool threadpool;
+    std::vector<std::future<bool>> results;
+    results.reserve(jobs.size());
+    for (auto const &job : jobs)
+      results.emplace_back(threadpool.submit([&writethread, &job]() { return writethread(job); }));
+    for (auto &r : results)
+      success = r.get() && success;
+  }
+  else
+    for (auto const &job : jobs)
+      success = writethread(job) && success;
+
+  if (!success)
+  {
+    if (databasemigrated)
+      SqliteDB::copyDb(backup_database, d_database);
+    return false;
   }
 
   std::cout << "All done!" << std::endl;
@@ -20,7 +20,7 @@
 #include "signalbackup.ih"
 #include "msgrange.h"
 
-void SignalBackup::handleSms(SqliteDB::QueryResults const &results, std::ofstream &outputfile, std::string const &self [[maybe_unused]], int i) const
+void SignalBackup::handleSms(SqliteDB::QueryResults const &results, std::ostream &outputfile, std::string const &self [[maybe_unused]], int i) const
 {
   /* protocol - Protocol used by the message, its mostly 0 in case of SMS messages. */
   /* OPTIONAL */
@@ -106,10 +106,7 @@ void SignalBackup::handleSms(SqliteDB::QueryResults const &results, std::ofstrea
   if (results.valueHasType<long long int>(i, d_sms_date_received))
   {
     long long int datum = results.getValueAs<long long int>(i, d_sms_date_received);
-    std::time_t epoch = datum / 1000;
-    std::ostringstream tmp;
-    tmp << std::put_time(std::localtime(&epoch), "%b %d, %Y %H:%M:%S");
-    readable_date = tmp.str();
+    readable_date = bepaald::toDateString(datum / 1000, "%b %d, %Y %H:%M:%S");
   }
 
   /* address - The phone number of the sender/recipient. */
@@ -188,7 +185,7 @@ void SignalBackup::handleSms(SqliteDB::QueryResults const &results, std::ofstrea
              << "/>" << std::endl;
 }
 
-void SignalBackup::handleMms(SqliteDB::QueryResults const &results, std::ofstream &outputfile, std::string const &self, int i, bool keepattachmentdatainmemory) const
+void SignalBackup::handleMms(SqliteDB::QueryResults const &results, std::ostream &outputfile, std::string const &self, int i, bool keepattachmentdatainmemory) const
 {
   // msg_box - The type of message, 1 = Received, 2 = Sent, 3 = Draft, 4 = Outbox
   long long int msg_box = 5;
@@ -238,10 +235,7 @@ void SignalBackup::handleMms(SqliteDB::QueryResults const &results, std::ofstrea
   if (results.valueHasType<long long int>(i, "date_received"))
   {
     long long int datum = results.getValueAs<long long int>(i, "date_received");
-    std::time_t epoch = datum / 1000;
-    std::ostringstream tmp;
-    tmp << std::put_time(std::localtime(&epoch), "%b %d, %Y %H:%M:%S");
-    readable_date = tmp.str();
+    readable_date = bepaald::toDateString(datum / 1000, "%b %d, %Y %H:%M:%S");
   }
 
 
@@ -559,8 +553,12 @@ void SignalBackup::handleMms(SqliteDB::QueryResults const &results, std::ofstrea
     if (attachment != d_attachments.end())
     {
       // add this for testing, or your xml file will be huge
-      outputfile << " data=\"" << Base64::bytesToBase64String(attachment->second->attachmentData(), attachment->second->attachmentSize())/*.substr(0, 50)*/ << "\" ";
-      if (!keepattachmentdatainmemory)
+      outputfile << " data=\"";
+      unsigned char *data = attachment->second->attachmentData();
+      if (data)
+        Base64::bytesToBase64Stream(data, attachment->second->attachmentSize(), outputfile);
+      outputfile << "\" ";
+      if (data && !keepattachmentdatainmemory)
         attachment->second.get()->clearData();
     }
     outputfile << "></part>" << std::endl;
@@ -603,6 +601,8 @@ void SignalBackup::handleMms(SqliteDB::QueryResults const &results, std::ofstrea
 
 bool SignalBackup::exportXml(std::string const &filename, bool overwrite, std::string self, bool includemms, bool keepattachmentdatainmemory) const
 {
+  PhaseStats::Scope phase("export xml");
+
   if (d_databaseversion < 24)
   {
     std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Unsupported database version (" << d_databaseversion << "). Please upgrade first." << std::endl;
@@ -640,69 +640,168 @@ bool SignalBackup::exportXml(std::string const &filename, bool overwrite, std::s
   outputfile << "<?xml version='1.0' encoding='UTF-8' standalone='yes' ?>" << std::endl;
   outputfile << "<?xml-stylesheet type=\"text/xsl\" href=\"sms.xsl\"?>" << std::endl;
 
-  SqliteDB::QueryResults sms_results;
+  std::vector<std::any> const types_params{Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
+                                           Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE};
+
+  std::string sms_query;
   if (d_database.containsTable("sms"))
   {
     if (d_database.tableContainsColumn("sms", "protocol") &&
         d_database.tableContainsColumn("sms", "service_center") &&
         d_database.tableContainsColumn("sms", "subject")) // removed in dbv166
-      d_database.exec("SELECT _id,thread_id,protocol,subject,service_center,read,status,date_sent," + d_sms_date_received + "," + d_sms_recipient_id + ",type,body,expires_in FROM sms WHERE "
-                      + d_sms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
-                      "(type & ?) == 0 AND ((type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ?)",
-                      {Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
-                       Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE}, &sms_results);
+      sms_query = "SELECT _id,thread_id,protocol,subject,service_center,read,status,date_sent," + d_sms_date_received + "," + d_sms_recipient_id + ",type,body,expires_in FROM sms WHERE "
+        + d_sms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
+        "(type & ?) == 0 AND ((type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ?)";
     else
-      d_database.exec("SELECT _id,thread_id,read,status,date_sent," + d_sms_date_received + "," + d_sms_recipient_id + ",type,body,expires_in FROM sms WHERE "
-                      + d_sms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
-                      "(type & ?) == 0 AND ((type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ?)",
-                      {Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
-                       Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE}, &sms_results);
+      sms_query = "SELECT _id,thread_id,read,status,date_sent," + d_sms_date_received + "," + d_sms_recipient_id + ",type,body,expires_in FROM sms WHERE "
+        + d_sms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
+        "(type & ?) == 0 AND ((type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ? OR (type & 0x1F) == ?)";
   }
 
-  SqliteDB::QueryResults mms_results;
+  std::string mms_query;
   if (includemms)
   {
     // at dbv 109 many columns were removed from the mms table.
     if (d_databaseversion >= 109)
-      d_database.exec("SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? ",to_recipient_id" : "") +
-                      "," + d_mms_type + ","
-                      "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,ct_l,m_type,m_size,exp,tr_id,st FROM " + d_mms_table +
-                      " WHERE "
-                      + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " +
-                      (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? "to_recipient_id IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " : "") +
-                      "(" + d_mms_type + " & ?) == 0 AND "
-                      "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)",
-                      {Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
-                       Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE}, &mms_results);
+      mms_query = "SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? ",to_recipient_id" : "") +
+        "," + d_mms_type + ","
+        "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,ct_l,m_type,m_size,exp,tr_id,st FROM " + d_mms_table +
+        " WHERE "
+        + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " +
+        (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? "to_recipient_id IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " : "") +
+        "(" + d_mms_type + " & ?) == 0 AND "
+        "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)";
     else
-      d_database.exec("SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + "," + d_mms_type + ","
-                      "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,m_id,sub,ct_t,ct_l,m_type,m_size,rr,read_status,"
-                      "m_cls,sub_cs,ct_cls,v,pri,retr_st,retr_txt,retr_txt_cs,d_tm,d_rpt,exp,resp_txt,tr_id,st,resp_st,rpt_a FROM " + d_mms_table + " WHERE "
-                      + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
-                      "(" + d_mms_type + " & ?) == 0 AND "
-                      "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)",
-                      {Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
-                       Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE}, &mms_results);
+      mms_query = "SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + "," + d_mms_type + ","
+        "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,m_id,sub,ct_t,ct_l,m_type,m_size,rr,read_status,"
+        "m_cls,sub_cs,ct_cls,v,pri,retr_st,retr_txt,retr_txt_cs,d_tm,d_rpt,exp,resp_txt,tr_id,st,resp_st,rpt_a FROM " + d_mms_table + " WHERE "
+        + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
+        "(" + d_mms_type + " & ?) == 0 AND "
+        "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)";
   }
 
+  long long int messagecount = (sms_query.empty() ? 0 : d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM (" + sms_query + ")", types_params, 0)) +
+    (mms_query.empty() ? 0 : d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM (" + mms_query + ")", types_params, 0));
+
   std::string date;
-  outputfile << "<smses count=\"" << bepaald::toString(sms_results.rows() + mms_results.rows())
+  outputfile << "<smses count=\"" << bepaald::toString(messagecount)
              << "\" backup_date=\"" << date << "\" type=\"full\">" << std::endl;
-  uint sms_row = 0;
-  uint mms_row = 0;
-  while (sms_row < sms_results.rows() ||
-         mms_row < mms_results.rows())
+
+  // The messages are not loaded all at once, but read in pages (keyset-paginated on (date, _id), which
+  // acts as a cursor over both tables). Batches of merged rows are formatted on a thread pool, the
+  // results are written in order as soon as the oldest pending batch is done. At most a few batches
+  // per thread are in flight, so memory use does not grow with the size of the database (attachment
+  // data is base64 encoded straight into the batch buffer and freed right after).
+  struct MessagePage
+  {
+    std::string const *query;
+    std::string datecolumn;
+    std::shared_ptr<SqliteDB::QueryResults> results;
+    uint row;
+    bool done;
+    bool failed;
+  };
+  MessagePage sms_page{&sms_query, d_sms_date_received, nullptr, 0, sms_query.empty(), false};
+  MessagePage mms_page{&mms_query, "date_received", nullptr, 0, mms_query.empty(), false};
+
+  uint const PAGESIZE = 1000;
+  auto nextrow = [&](MessagePage *page) -> bool // returns false when page is exhausted (or query failed)
   {
-    if (mms_row >= mms_results.rows() ||
-        (sms_row < sms_results.rows() &&
-         (sms_results.getValueAs<long long int>(sms_row, d_sms_date_received) <
-          mms_results.getValueAs<long long int>(mms_row, "date_received"))))
-      handleSms(sms_results, outputfile, self, sms_row++);
-    else if (mms_row < mms_results.rows())
-      handleMms(mms_results, outputfile, self, mms_row++, keepattachmentdatainmemory);
-
-    //std::cout << "Handled row! Indices now: " << sms_row << "/" << sms_results.rows() << " " << mms_row << "/" << mms_results.rows() << std::endl;
+    if (page->done)
+      return false;
+    if (page->results && page->row < page->results->rows())
+      return true;
+
+    std::vector<std::any> params(types_params);
+    long long int lastdate = std::numeric_limits<long long int>::min();
+    long long int lastid = std::numeric_limits<long long int>::min();
+    if (page->results && page->results->rows())
+    {
+      lastdate = getIntOr(*page->results, page->results->rows() - 1, page->datecolumn, 0);
+      lastid = getIntOr(*page->results, page->results->rows() - 1, "_id", 0);
+    }
+    params.emplace_back(lastdate);
+    params.emplace_back(lastid);
+
+    page->results = std::make_shared<SqliteDB::QueryResults>();
+    page->row = 0;
+    if (!d_database.exec("SELECT * FROM (" + *page->query + ") WHERE (IFNULL(" + page->datecolumn + ", 0), _id) > (?, ?) "
+                         "ORDER BY IFNULL(" + page->datecolumn + ", 0), _id LIMIT " + bepaald::toString(PAGESIZE), params, page->results.get())) [[unlikely]]
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to query database for messages" << std::endl;
+      page->failed = true;
+      page->done = true;
+    }
+    else if (page->results->rows() == 0)
+      page->done = true;
+    return !page->done;
+  };
+
+  std::unique_ptr<ThreadPool> threadpool;
+  if (sqlite3_threadsafe() == 1) // connection may only be shared between threads in serialized mode
+    threadpool.reset(new ThreadPool);
+  uint const BATCHSIZE = 250;
+  std::deque<std::future<std::string>> pending;
+
+  while (true)
+  {
+    std::vector<std::tuple<bool, std::shared_ptr<SqliteDB::QueryResults>, uint>> batch; // {is_sms, results, row}
+    batch.reserve(BATCHSIZE);
+    while (batch.size() < BATCHSIZE)
+    {
+      bool have_sms = nextrow(&sms_page);
+      bool have_mms = nextrow(&mms_page);
+      if (sms_page.failed || mms_page.failed) [[unlikely]]
+        break;
+      if (!have_sms && !have_mms)
+        break;
+
+      if (!have_mms ||
+          (have_sms &&
+           (getIntOr(*sms_page.results, sms_page.row, d_sms_date_received, 0) <
+            getIntOr(*mms_page.results, mms_page.row, "date_received", 0))))
+        batch.emplace_back(true, sms_page.results, sms_page.row++);
+      else
+        batch.emplace_back(false, mms_page.results, mms_page.row++);
+    }
+    if (batch.empty() || sms_page.failed || mms_page.failed)
+      break;
+
+    auto formatbatch = [this, batch = std::move(batch), &self, keepattachmentdatainmemory]()
+    {
+      std::ostringstream out;
+      for (auto const &[is_sms, results, row] : batch)
+      {
+        if (is_sms)
+          handleSms(*results, out, self, row);
+        else
+          handleMms(*results, out, self, row, keepattachmentdatainmemory);
+      }
+      return std::move(out).str();
+    };
+
+    if (!threadpool) [[unlikely]]
+    {
+      outputfile << formatbatch();
+      continue;
+    }
+
+    pending.emplace_back(threadpool->submit(std::move(formatbatch)));
+    while (pending.size() > 2 * threadpool->size())
+    {
+      outputfile << pending.front().get();
+      pending.pop_front();
+    }
   }
+  while (!pending.empty())
+  {
+    outputfile << pending.front().get();
+    pending.pop_front();
+  }
+
+  if (sms_page.failed || mms_page.failed) [[unlikely]]
+    return false;
 
   outputfile << "</smses>" << std::endl;
 
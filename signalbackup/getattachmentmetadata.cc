@@ -25,6 +25,215 @@
 
 #include "../base64/base64.h"
 
+namespace
+{
+  // Gets type and dimensions of PNG, GIF and JPEG images from the data as it is read. The data
+  // can be fed in chunks of any size, so this runs along with hashing the file in a single pass.
+  class ImageHeaderSniffer
+  {
+    enum class State
+    {
+      HEADER,          // collecting the first 24 bytes
+      JPEG_MARKER,     // expecting 0xFF
+      JPEG_MARKERTYPE, // skipping fill bytes (0xFF), then the marker type
+      JPEG_LENGTH,     // two bytes block length (including these two bytes)
+      JPEG_SKIP,       // skipping the rest of an uninteresting block
+      JPEG_FRAME,      // precision, y, x of a start-of-frame block
+      DONE
+    };
+
+    static unsigned int constexpr s_headersize = 24;
+
+    State d_state;
+    unsigned char d_buf[s_headersize];
+    unsigned int d_count;
+    unsigned int d_needed;
+    uint64_t d_skip;
+    bool d_startofframe;
+    int d_width;
+    int d_height;
+    std::string d_filetype;
+
+   public:
+    inline ImageHeaderSniffer();
+    inline void feed(unsigned char const *data, uint64_t size);
+    inline void finish();
+    inline int width() const { return d_width; }
+    inline int height() const { return d_height; }
+    inline std::string const &filetype() const { return d_filetype; }
+
+   private:
+    inline uint64_t feedJpeg(unsigned char const *data, uint64_t size);
+    inline void checkHeader();
+  };
+
+  inline ImageHeaderSniffer::ImageHeaderSniffer()
+    :
+    d_state(State::HEADER),
+    d_count(0),
+    d_needed(0),
+    d_skip(0),
+    d_startofframe(false),
+    d_width(-1),
+    d_height(-1)
+  {}
+
+  inline void ImageHeaderSniffer::feed(unsigned char const *data, uint64_t size)
+  {
+    if (d_state == State::HEADER)
+    {
+      uint64_t n = std::min(static_cast<uint64_t>(s_headersize - d_count), size);
+      std::memcpy(d_buf + d_count, data, n);
+      d_count += n;
+      data += n;
+      size -= n;
+      if (d_count < s_headersize)
+        return;
+      checkHeader();
+    }
+    while (size && d_state != State::DONE)
+    {
+      uint64_t used = feedJpeg(data, size);
+      data += used;
+      size -= used;
+    }
+  }
+
+  inline void ImageHeaderSniffer::checkHeader()
+  {
+    unsigned char buf[s_headersize]; // copy, d_buf is reused while parsing JPEG
+    std::memcpy(buf, d_buf, s_headersize);
+    d_state = State::DONE;
+
+    // PNG: the first frame is by definition an IHDR frame, which gives dimensions
+    if (buf[0] == 0x89 && buf[1] == 'P' && buf[2] == 'N' && buf[3] == 'G' && buf[4] == 0x0D && buf[5] == 0x0A && buf[6] == 0x1A && buf[7] == 0x0A &&
+        buf[12] == 'I' && buf[13] == 'H' && buf[14] == 'D' && buf[15] == 'R')
+    {
+      d_width = (buf[16] << 24) + (buf[17] << 16) + (buf[18] << 8) + (buf[19] << 0);
+      d_height = (buf[20] << 24) + (buf[21] << 16) + (buf[22] << 8) + (buf[23] << 0);
+      d_filetype = "image/png";
+      return;
+    }
+
+    // GIF: first three bytes say "GIF", next three give version number. Then dimensions
+    if (buf[0] == 'G' && buf[1] == 'I' && buf[2] == 'F')
+    {
+      d_width = buf[8] + (buf[9] << 8);
+      d_height = buf[6] + (buf[7] << 8);
+      d_filetype = "image/gif";
+      return;
+    }
+
+    // JPEG
+    // For jpeg we read the width and height from JPEG header, more precisely, the frame marked 0xFFC0.
+    // Starting after the 'start-of-image' marker (0xFF 0xD8), every block starts with:
+    // 0xFF(*) | marker type(**) | ushort length | ...
+    // if first byte is not 0xff, something is wrong
+    // if the marker type is not one of the start-of-frame types, the length is used to skip the block
+    // else the block continues with: uchar precision | ushort y | ushort x
+    //
+    // * Note, apparently, markers can start with any number of 0xff's
+    // ** Apparently, frames marked C0-C3 & C9-CB all contain the desired resolution
+    //
+    // Note, though I think it is required the first frame is a JFIF, or Exif frame,
+    // I have images that don't have this. They just start with 0xff0xd8 : 'start-of-image'
+    //
+    // from : (https://web.archive.org/web/20131016210645/)http://www.64lines.com/jpeg-width-height
+    if (buf[0] == 0xFF && buf[1] == 0xD8 && buf[2] == 0xFF)
+    {
+      d_state = State::JPEG_MARKER;
+      unsigned char const *rest = buf + 2; // offset for 0xff 0xd8 which always seem to be the first two bytes
+      uint64_t restsize = s_headersize - 2;
+      while (restsize && d_state != State::DONE)
+      {
+        uint64_t used = feedJpeg(rest, restsize);
+        rest += used;
+        restsize -= used;
+      }
+    }
+  }
+
+  // processes (part of) data, returns the number of bytes used
+  inline uint64_t ImageHeaderSniffer::feedJpeg(unsigned char const *data, uint64_t size)
+  {
+    switch (d_state)
+    {
+      case State::JPEG_MARKER:
+        if (data[0] != 0xFF)
+        {
+          std::cout << "Failed to find start of JPEG header frame" << std::endl;
+          d_state = State::DONE;
+          return size;
+        }
+        d_state = State::JPEG_MARKERTYPE;
+        return 1;
+      case State::JPEG_MARKERTYPE:
+        if (data[0] == 0xFF) // skip any extra frame markers
+          return 1;
+        d_startofframe = (data[0] == 0xC0 || data[0] == 0xC1 || data[0] == 0xC2 || data[0] == 0xC3 ||
+                          data[0] == 0xC9 || data[0] == 0xCA || data[0] == 0xCB);
+        d_state = State::JPEG_LENGTH;
+        d_count = 0;
+        return 1;
+      case State::JPEG_LENGTH:
+        d_buf[d_count++] = data[0];
+        if (d_count == 2)
+        {
+          uint64_t block_length = (d_buf[0] << 8) + d_buf[1];
+          d_count = 0;
+          if (d_startofframe) // FOUND OUR MARKER!
+          {
+            d_state = State::JPEG_FRAME;
+            d_needed = 5;
+          }
+          else if (block_length < 2) [[unlikely]]
+          {
+            std::cout << "Failed to find start of JPEG header frame" << std::endl;
+            d_state = State::DONE;
+          }
+          else // this was a different frame, skip it
+          {
+            d_skip = block_length - 2;
+            d_state = d_skip ? State::JPEG_SKIP : State::JPEG_MARKER;
+          }
+        }
+        return 1;
+      case State::JPEG_SKIP:
+      {
+        uint64_t n = std::min(d_skip, size);
+        d_skip -= n;
+        if (d_skip == 0)
+          d_state = State::JPEG_MARKER;
+        return n;
+      }
+      case State::JPEG_FRAME:
+        d_buf[d_count++] = data[0];
+        if (d_count == d_needed)
+        {
+          d_height = (d_buf[1] << 8) + d_buf[2];
+          d_width = (d_buf[3] << 8) + d_buf[4];
+          d_filetype = "image/jpeg";
+          d_state = State::DONE;
+        }
+        return 1;
+      case State::HEADER:
+      case State::DONE:
+        break;
+    }
+    return size;
+  }
+
+  inline void ImageHeaderSniffer::finish()
+  {
+    if (d_state != State::HEADER && d_state != State::DONE) // ran out of data inside JPEG header
+      std::cout << "Failed to read next block of JPEG header from file" << std::endl;
+    //else if (d_state == State::HEADER)
+    //  std::cout << "File unexpectedly small" << std::endl; // only unexpected when it is _supposed_ to be png/jpg/gif
+    d_state = State::DONE;
+  }
+}
+
+// Gets hash, size, and for images type and dimensions, in a single pass over the file
 SignalBackup::AttachmentMetadata SignalBackup::getAttachmentMetaData(std::string const &file) const
 {
 
@@ -43,7 +252,7 @@ SignalBackup::AttachmentMetadata SignalBackup::getAttachmentMetaData(std::string
   if (!filestream.is_open())
   {
     std::cout << "Failed to open image for reading: " << file << std::endl;
-          return AttachmentMetadata{-1, -1, std::string(), 0, std::string(), std::string()};
+    return AttachmentMetadata{-1, -1, std::string(), 0, std::string(), std::string()};
   }
 
   filestream.seekg(0, std::ios_base::end);
@@ -53,159 +262,50 @@ SignalBackup::AttachmentMetadata SignalBackup::getAttachmentMetaData(std::string
   if (file_size == 0)
     return AttachmentMetadata{-1, -1, std::string(), file_size, std::string(), file};
 
-  // gethash
-  std::string hash;
-  int buffer_size = std::max(file_size, 1024 * 1024ul);
+  int constexpr buffer_size = 64 * 1024;
   std::unique_ptr<unsigned char[]> buffer(new unsigned char[buffer_size]);
   unsigned char rawhash[SHA256_DIGEST_LENGTH];
-  bool fail = true;
   std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> sha256(EVP_MD_CTX_new(), &::EVP_MD_CTX_free);
-  if (sha256.get() && EVP_DigestInit_ex(sha256.get(), EVP_sha256(), nullptr) == 1)
+  bool fail = !sha256.get() || EVP_DigestInit_ex(sha256.get(), EVP_sha256(), nullptr) != 1;
+  ImageHeaderSniffer sniffer;
+  while (filestream)
   {
-    fail = false;
-    while (filestream)
-    {
-      filestream.read(reinterpret_cast<char *>(buffer.get()), buffer_size);
-      if (EVP_DigestUpdate(sha256.get(), buffer.get(), filestream.gcount()) != 1)
-      {
-        fail |= true;
-        break;
-      }
-    }
-    fail |= (EVP_DigestFinal_ex(sha256.get(), rawhash, nullptr) != 1);
+    filestream.read(reinterpret_cast<char *>(buffer.get()), buffer_size);
+    std::streamsize read = filestream.gcount();
+    if (read <= 0)
+      break;
+    if (!fail && EVP_DigestUpdate(sha256.get(), buffer.get(), read) != 1)
+      fail = true;
+    sniffer.feed(buffer.get(), read);
   }
-  hash = fail ? std::string() : Base64::bytesToBase64String(rawhash, SHA256_DIGEST_LENGTH);
+  sniffer.finish();
+  if (!fail)
+    fail = (EVP_DigestFinal_ex(sha256.get(), rawhash, nullptr) != 1);
+  std::string hash = fail ? std::string() : Base64::bytesToBase64String(rawhash, SHA256_DIGEST_LENGTH);
   //std::cout << bepaald::bytesToHexString(rawhash, SHA256_DIGEST_LENGTH) << std::endl;
   //std::cout << "GOT HASH: " << hash << std::endl;
 
-  // rewind and reset
-  filestream.clear();
-  filestream.seekg(0, std::ios_base::beg);
-  int bufsize = 24;
-
-  if (file_size < static_cast<unsigned int>(bufsize))
-  {
-    //std::cout << "File unexpectedly small" << std::endl; // only unexpected when it is _supposed_ to be png/jpg/gif
-    return AttachmentMetadata{-1, -1, std::string(), file_size, hash, file};
-  }
-
-  std::unique_ptr<unsigned char[]> buf(new unsigned char[bufsize]);
-  if (!filestream.read(reinterpret_cast<char *>(buf.get()), bufsize))
-  {
-    std::cout << "Failed to read 24 bytes from file" << std::endl;
-    return AttachmentMetadata{-1, -1, std::string(), file_size, hash, file};
-  }
-
-  // PNG: the first frame is by definition an IHDR frame, which gives dimensions
-  if (buf[0] == 0x89 && buf[1] == 'P' && buf[2] == 'N' && buf[3] == 'G' && buf[4] == 0x0D && buf[5] == 0x0A && buf[6] == 0x1A && buf[7] == 0x0A &&
-      buf[12] == 'I' && buf[13] == 'H' && buf[14] == 'D' && buf[15] == 'R')
-  {
-    //*x = (buf[16] << 24) + (buf[17] << 16) + (buf[18] << 8) + (buf[19] << 0);
-    //*y = (buf[20] << 24) + (buf[21] << 16) + (buf[22] << 8) + (buf[23] << 0);
-    return AttachmentMetadata{(buf[16] << 24) + (buf[17] << 16) + (buf[18] << 8) + (buf[19] << 0),
-      (buf[20] << 24) + (buf[21] << 16) + (buf[22] << 8) + (buf[23] << 0),
-      "image/png", file_size, hash, file};
-  }
+  return AttachmentMetadata{sniffer.width(), sniffer.height(), sniffer.filetype(), file_size, hash, file};
+}
 
-  // GIF: first three bytes say "GIF", next three give version number. Then dimensions
-  if (buf[0] == 'G' && buf[1] == 'I' && buf[2] == 'F')
+// Probes all files concurrently, results are in the same order as files
+std::vector<SignalBackup::AttachmentMetadata> SignalBackup::getAttachmentMetaData(std::vector<std::string> const &files) const
+{
+  std::vector<AttachmentMetadata> results;
+  results.reserve(files.size());
+  if (files.size() <= 1)
   {
-    //*x = buf[6] + (buf[7] << 8);
-    //*y = buf[8] + (buf[9] << 8);
-    return AttachmentMetadata{buf[8] + (buf[9] << 8),
-      buf[6] + (buf[7] << 8),
-      "image/gif", file_size, hash, file};
+    for (std::string const &f : files)
+      results.emplace_back(getAttachmentMetaData(f));
+    return results;
   }
 
-  // JPEG
-  // For jpeg we read the width and height from JPEG header, more precisely, the frame marked 0xFFC0.
-  // At buf[4] + buf[5], we find the block length of the first block (which is never the block
-  // with size information, so can be skipped.
-  // Then, we can just skip to the start of the next block, read 9 bytes and get:
-  // 0xFF(*) | 0xC0(**) | ushort length | uchar precision | ushort x | ushort y
-  // if first byte is not 0xff, something is wrong
-  // if second byte is not 0xc0, this is not our frame and we use 3rd and 4th to skip
-  // else bytes 6-9 are the wanted numbers.
-  //
-  // * Note, apparently, markers can start with any number of 0xff's
-  // ** Apparently, frames marked C0-C3 & C9-CB all contain the desired resolution
-  //
-  // Note, though I think it is required the first frame is a JFIF, or Exif frame,
-  // I have images that don't have this. They just start with 0xff0xd8 : 'start-of-image'
-  //
-  // from : (https://web.archive.org/web/20131016210645/)http://www.64lines.com/jpeg-width-height
-
-  //for (int i = 0; i < bufsize; ++i)
-  //  std::cout << i << " : " << std::hex << reinterpret_cast<int>(buf[i] & 0xff) << std::dec << std::endl;
-
-  if (/*(buf[0] == 0xFF && buf[1] == 0xD8 && buf[2] == 0xFF && buf[3] == 0xE0 &&
-       buf[6] == 'J' && buf[7] == 'F' && buf[8] == 'I' && buf[9] == 'F' &&
-       buf[10] == 0x00) ||
-      (buf[0] == 0xFF && buf[1] == 0xD8 && buf[2] == 0xFF && buf[3] == 0xE1 &&
-       buf[6] == 'E' && buf[7] == 'x' && buf[8] == 'i' && buf[9] == 'f' &&
-       buf[10] == 0x00) ||*/
-      (buf[0] == 0xFF && buf[1] == 0xD8 && buf[2] == 0xFF))
-  {
-
-    int jpeg_bufsize = 9;
-    filestream.seekg(jpeg_bufsize, std::ios_base::beg); // seek to this position, as if we were always reading just jpeg_bufsize bytes
-    int pos = 2; // offset for 0xff 0xd8 which always seem to be the first two bytes
-
-    while (true)
-    {
-      // check frame marker
-      if (buf[pos] != 0xFF)
-      {
-        std::cout << "Failed to find start of JPEG header frame" << std::endl;
-        return AttachmentMetadata{-1, -1, std::string(), file_size, hash, file};
-      }
-      // skip any extra frame markers
-      while (buf[pos + 1] == 0xFF)
-      {
-        //std::cout << "Skipping extra frame marker" << std::endl;
-        ++pos;
-        if (pos >= jpeg_bufsize)
-        {
-          std::cout << "This could be fixed..." << std::endl;
-          return AttachmentMetadata{-1, -1, std::string(), file_size, hash, file};
-        }
-      }
-
-      if (buf[pos + 1] == 0xC0 || buf[pos + 1] == 0xC1 || buf[pos + 1] == 0xC2 || buf[pos + 1] == 0xC3 ||
-          buf[pos + 1] == 0xC9 || buf[pos + 1] == 0xCA || buf[pos + 1] == 0xCB) // FOUND OUR MARKER!
-      {
-        //*y = (buf[pos + 5] << 8) + buf[pos + 6];
-        //*x = (buf[pos + 7] << 8) + buf[pos + 8];
-
-        return AttachmentMetadata{(buf[pos + 7] << 8) + buf[pos + 8],
-          (buf[pos + 5] << 8) + buf[pos + 6],
-          "image/jpeg", file_size, hash, file};
-      }
-      else // this was a different frame, skip it
-      {
-        int block_length = (buf[pos + 2] << 8) + buf[pos + 3];
-        //std::cout << "Skipping frame (" << block_length << ")" << std::endl;
-
-        //std::cout << block_length << " " << jpeg_bufsize << " " << pos << std::endl;
-        //std::cout << block_length + 2 - (jpeg_bufsize - pos) << std::endl;
-
-        filestream.seekg(block_length + 2 - (jpeg_bufsize - pos), std::ios_base::cur); // + 2 skip marker itself
-
-        //std::cout << "Pos is now: " << filestream.tellg() << std::endl;
-
-        if (!filestream.read(reinterpret_cast<char *>(buf.get()), jpeg_bufsize))
-        {
-          std::cout << "Failed to read next 24 bytes from file" << std::endl;
-          return AttachmentMetadata{-1, -1, std::string(), file_size, hash, file};
-        }
-
-        //for (int i = 0; i < bufsize; ++i)
-        //  std::cout << i << " : " << std::hex << reinterpret_cast<int>(buf[i] & 0xff) << std::dec << std::endl;
-
-        pos = 0;
-      }
-    }
-
-  }
-  return AttachmentMetadata{-1, -1, std::string(), file_size, hash, file};
+  ThreadPool pool(std::min(static_cast<unsigned int>(files.size()), ThreadPool::defaultThreads()));
+  std::vector<std::future<AttachmentMetadata>> pending;
+  pending.reserve(files.size());
+  for (std::string const &f : files)
+    pending.emplace_back(pool.submit([this, &f]() { return getAttachmentMetaData(f); }));
+  for (auto &p : pending)
+    results.emplace_back(p.get());
+  return results;
 }
@@ -18,58 +18,49 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
-void SignalBackup::getDTReactions(SqliteDB const &ddb, long long int rowid, long long int numreactions, std::vector<std::vector<std::string>> *reactions) const
+void SignalBackup::getDTReactions(SqliteDB const &ddb, DTMessageJson const &msgjson, std::vector<std::vector<std::string>> *reactions) const
 {
   SqliteDB::QueryResults results_emoji_reactions;
   //if (numreactions)
   //  std::cout << "  " << numreactions << " reactions." << std::endl;
-  for (uint k = 0; k < numreactions; ++k)
+  for (std::string const &reaction : msgjson.children("$.reactions"))
   {
-    if (!ddb.exec("SELECT "
-                  "json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].emoji') AS emoji,"
+    // not present in android database
+    //msgjson.value(reaction + ".remove")
 
-                  // not present in android database
-                  //"json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].remove') AS remove,"
+    // THIS IS THE AUTHOR OF THE MESSAGE THATS REACTED TO
+    //msgjson.value(reaction + ".targetAuthorUuid")
 
-                  // THIS IS THE AUTHOR OF THE MESSAGE THATS REACTED TO
-                  //"json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].targetAuthorUuid') AS target_author_uuid,"
+    //timestamp of message that reaction belongs to, dont know why this exists
+    //msgjson.value(reaction + ".targetTimestamp")
 
-                  //timestamp of message that reaction belongs to, dont know why this exists
-                  //"json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].targetTimestamp') AS target_timestamp,"
+    //msgjson.value(reaction + ".source") // ???
 
-                  "json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].timestamp') AS timestamp,"
-
-                  // THE ID OF THE CONVERSATION OF THE REACTION AUTHOR (conversation somewhat doubles android's recipient table)
-                  // ON OLDER DATABASES THIS IS PHONE NUMBER OF THE ACTUAL AUTHOR
-                  "json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].fromId') AS from_id,"
-
-                  //"json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].source') AS source" // ???
-                  "conversations." + d_dt_c_uuid + " AS uuid,"
-                  "conversations.e164 AS phone"
-                  " FROM messages LEFT JOIN conversations ON"
-                  " (conversations.id IS json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].fromId')"
-                  " OR "
-                  "conversations.e164 IS json_extract(messages.json, '$.reactions[" + bepaald::toString(k) + "].fromId'))"
-                  " WHERE rowid = ?", rowid, &results_emoji_reactions))
+    // THE ID OF THE CONVERSATION OF THE REACTION AUTHOR (conversation somewhat doubles android's recipient table)
+    // ON OLDER DATABASES THIS IS PHONE NUMBER OF THE ACTUAL AUTHOR
+    std::any from_id = msgjson.value(reaction + ".fromId");
+    if (!ddb.exec("SELECT " + d_dt_c_uuid + " AS uuid, e164 AS phone FROM conversations WHERE id IS ? OR e164 IS ?",
+                  {from_id, from_id}, &results_emoji_reactions))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to get reaction data from desktop database. Skipping." << std::endl;
       continue;
     }
-    //std::cout << "  Reaction " << k + 1 << "/" << numreactions << std::endl;
+    //std::cout << "  Reaction " << reaction << std::endl;
     //results_emoji_reactions.print(false);
 
-    reactions->emplace_back(std::vector{results_emoji_reactions.valueAsString(0, "emoji"),
-                                        results_emoji_reactions.valueAsString(0, "timestamp"),
-                                        results_emoji_reactions.valueAsString(0, "uuid"),
-                                        results_emoji_reactions.valueAsString(0, "phone")});
+    reactions->emplace_back(std::vector{msgjson.valueAsString(reaction + ".emoji"),
+                                        msgjson.valueAsString(reaction + ".timestamp"),
+                                        results_emoji_reactions.rows() ? results_emoji_reactions.valueAsString(0, "uuid") : std::string(),
+                                        results_emoji_reactions.rows() ? results_emoji_reactions.valueAsString(0, "phone") : std::string()});
 
 
     // DEBUG
-    if (results_emoji_reactions.valueAsString(0, "uuid").empty())
+    if (reactions->back()[2].empty())
     {
       std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << " : Got empty author uuid, here is some additional info:" << std::endl;
-      ddb.print("SELECT json_extract(json, '$.reactions') FROM messages WHERE rowid = ?", rowid);
+      ddb.print("SELECT json_extract(json, '$.reactions') FROM messages WHERE id = ?", msgjson.value("$.id"));
     }
 
   }
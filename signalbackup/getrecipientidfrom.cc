@@ -30,6 +30,14 @@ long long int SignalBackup::getRecipientIdFromUuid(std::string const &uuid, std:
 
   if (!savedmap || savedmap->find(uuid) == savedmap->end())
   {
+    if (!d_recipientidbyuuid.empty())
+      if (auto it = d_recipientidbyuuid.find(bepaald::toLower(uuid)); it != d_recipientidbyuuid.end())
+      {
+        if (savedmap)
+          (*savedmap)[uuid] = it->second;
+        return it->second;
+      }
+
     std::string printable_uuid(uuid);
     unsigned int offset = (STRING_STARTS_WITH(uuid, "__signal_group__v2__!") ? STRLEN("__signal_group__v2__!") + 4 :
                            (STRING_STARTS_WITH(uuid, "__textsecure_group__!") ? STRLEN("__textsecure_group__!") + 4 : 4));
@@ -67,6 +75,14 @@ long long int SignalBackup::getRecipientIdFromPhone(std::string const &phone, st
 
   if (!savedmap || savedmap->find(phone) == savedmap->end())
   {
+    if (!d_recipientidbyphone.empty())
+      if (auto it = d_recipientidbyphone.find(bepaald::toLower(phone)); it != d_recipientidbyphone.end())
+      {
+        if (savedmap)
+          (*savedmap)[phone] = it->second;
+        return it->second;
+      }
+
     std::string printable_phone(phone);
     unsigned int offset = 3;
     if (offset < phone.size()) [[likely]]
@@ -18,9 +18,11 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
-bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string const &callid, long long int rowid,
-                                           long long int ttid, long long int address, bool insertincompletedataforexport) const
+bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, DTMessageJson const &msgjson, std::string const &callid,
+                                           long long int sent_at, long long int ttid, long long int address,
+                                           bool insertincompletedataforexport) const
 {
   SqliteDB::QueryResults calldetails;
   uint64_t calltype = 0;
@@ -44,6 +46,7 @@ bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string cons
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to get call details from desktop database. Skipping." << std::endl;
       return false;
     }
+    sent_at = calldetails.valueAsInt(0, "sent_at");
 
     if (calldetails.valueAsString(0, "mode") == "Direct")
     {
@@ -103,37 +106,30 @@ bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string cons
 
       calltype = Types::GROUP_CALL_TYPE; // always video?
       ProtoBufParser<protobuffer::optional::STRING, protobuffer::optional::STRING, protobuffer::optional::INT64, protobuffer::repeated::STRING, protobuffer::optional::BOOL> groupcallbody;
-      groupcallbody.addField<3>(calldetails.getValueAs<long long int>(0, "sent_at")); // cheating
+      groupcallbody.addField<3>(sent_at); // cheating
       body = groupcallbody.getDataString();
     }
   }
   else
   {
-    if (!ddb.exec("SELECT "
-                  "COALESCE(sent_at, json_extract(json, '$.sent_at'), json_extract(json, '$.received_at_ms'), received_at, json_extract(json, '$.received_at')) AS sent_at,"
-                  "json_extract(json, '$.callHistoryDetails.callMode') AS mode,"
-                  "json_extract(json, '$.callHistoryDetails.creatorUuid') AS creator_uuid,"
-                  "json_extract(json, '$.callHistoryDetails.eraId') AS era_id,"
-                  "json_extract(json, '$.callHistoryDetails.startedTime') AS started_time,"
-                  "IFNULL(json_extract(json, '$.callHistoryDetails.wasIncoming'), false) AS incoming,"
-                  "IFNULL(json_extract(json, '$.callHistoryDetails.wasVideoCall'), false) AS video,"
-                  "IFNULL(json_extract(json, '$.callHistoryDetails.wasDeclined'), false) AS declined,"
-                  "IFNULL(json_extract(json, '$.callHistoryDetails.acceptedTime'), -1) AS accepted"
-                  " FROM messages WHERE rowid = ?", rowid, &calldetails))
+    // old style, details are in the message json
+    if (!msgjson.contains("$"))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to get call details from desktop database. Skipping." << std::endl;
       return false;
     }
+    std::string const mode = msgjson.valueAsString("$.callHistoryDetails.callMode");
+    bool const incoming = msgjson.valueAsInt("$.callHistoryDetails.wasIncoming", 0);
+    bool const video = msgjson.valueAsInt("$.callHistoryDetails.wasVideoCall", 0);
+    long long int const accepted = msgjson.valueAsInt("$.callHistoryDetails.acceptedTime", -1);
 
-    //calldetails.prettyPrint();
-
-    if (calldetails.valueAsString(0, "mode") == "Direct")
+    if (mode == "Direct")
     {
-      if (calldetails.getValueAs<long long int>(0, "video"))
+      if (video)
       {
-        if (calldetails.getValueAs<long long int>(0, "incoming"))
+        if (incoming)
         {
-          if (calldetails.getValueAs<long long int>(0, "accepted") >= 0)
+          if (accepted >= 0)
             calltype = Types::INCOMING_VIDEO_CALL_TYPE;
           else
             calltype = Types::MISSED_VIDEO_CALL_TYPE;
@@ -143,9 +139,9 @@ bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string cons
       }
       else
       {
-        if (calldetails.getValueAs<long long int>(0, "incoming"))
+        if (incoming)
         {
-          if (calldetails.getValueAs<long long int>(0, "accepted") >= 0)
+          if (accepted >= 0)
             calltype = Types::INCOMING_CALL_TYPE;
           else
             calltype = Types::MISSED_CALL_TYPE;
@@ -154,7 +150,7 @@ bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string cons
           calltype = Types::OUTGOING_CALL_TYPE;
       }
     }
-    else if (calldetails.valueAsString(0, "mode") == "Group")
+    else if (mode == "Group")
     {
       calltype = Types::GROUP_CALL_TYPE; // always video?
 
@@ -207,9 +203,9 @@ bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string cons
       // Field #2: 12 String Length = 36, Hex = 24, UTF8 = "93722273-78e3-41 ..." (total 36 chars)
       // Field #3: 18 Varint Value = 1669314409536, Hex = C0-E8-91-D7-CA-30
       ProtoBufParser<protobuffer::optional::STRING, protobuffer::optional::STRING, protobuffer::optional::INT64, protobuffer::repeated::STRING, protobuffer::optional::BOOL> groupcallbody;
-      groupcallbody.addField<1>(calldetails.valueAsString(0, "era_id"));
-      groupcallbody.addField<2>(calldetails.valueAsString(0, "creator_uuid"));
-      groupcallbody.addField<3>(calldetails.getValueAs<long long int>(0, "started_time"));
+      groupcallbody.addField<1>(msgjson.valueAsString("$.callHistoryDetails.eraId"));
+      groupcallbody.addField<2>(msgjson.valueAsString("$.callHistoryDetails.creatorUuid"));
+      groupcallbody.addField<3>(msgjson.valueAsInt("$.callHistoryDetails.startedTime"));
       body = groupcallbody.getDataString();
     }
   }
@@ -221,8 +217,8 @@ bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string cons
     if (!insertRow(d_database.containsTable("sms") ? "sms" : d_mms_table,
                    {{"thread_id", ttid},
                     {d_database.containsTable("sms") ? d_sms_recipient_id : d_mms_recipient_id, address},
-                    {d_database.containsTable("sms") ? d_sms_date_received : "date_received", calldetails.value(0, "sent_at")},
-                    {"date_sent", calldetails.value(0, "sent_at")},
+                    {d_database.containsTable("sms") ? d_sms_date_received : "date_received", sent_at},
+                    {"date_sent", sent_at},
                     {"type", calltype},
                     {"body", body}}))
     {
@@ -234,7 +230,7 @@ bool SignalBackup::handleDTCallTypeMessage(SqliteDB const &ddb, std::string cons
   {
     // newer tables have a unique constraint on date_sent/thread_id/from_recipient_id, so
     // we try to get the first free date_sent
-    long long int freedate = getFreeDateForMessage(calldetails.getValueAs<long long int>(0, "sent_at"), ttid, Types::isOutgoing(calltype) ? d_selfid : address);
+    long long int freedate = getFreeDateForMessage(sent_at, ttid, Types::isOutgoing(calltype) ? d_selfid : address);
     if (freedate == -1)
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Getting free date for call type message" << std::endl;
@@ -18,23 +18,15 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
 bool SignalBackup::handleDTExpirationChangeMessage(SqliteDB const &ddb,
-                                                   long long int rowid,
+                                                   DTMessageJson const &msgjson,
                                                    long long int ttid,
                                                    long long int sent_at,
                                                    long long int address) const
 {
-  SqliteDB::QueryResults timer_results;
-  if (!ddb.exec("SELECT "
-                "type, "
-                "conversationId, "
-                "IFNULL(json_extract(json,'$.expirationTimerUpdate.fromGroupUpdate'), false) AS fromgroupupdate, "
-                "IFNULL(json_extract(json,'$.expirationTimerUpdate.fromSync'), false) AS fromsync, "
-                "IFNULL(json_extract(json,'$.expirationTimerUpdate.expireTimer'), 0) AS expiretimer, "
-                "json_extract(json,'$.expirationTimerUpdate.source') AS source, "
-                "COALESCE(json_extract(json,'$.expirationTimerUpdate.sourceServiceId'), json_extract(json,'$.expirationTimerUpdate.sourceUuid')) AS sourceuuid "
-                "FROM messages WHERE rowid = ?", rowid, &timer_results))
+  if (msgjson.tree.empty())
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
               << ": Querying database" << std::endl;
@@ -44,7 +36,7 @@ bool SignalBackup::handleDTExpirationChangeMessage(SqliteDB const &ddb,
   // On Android, the message must be either incoming or outgoing, but I can
   // only guess. 50-50 of having correct or incorrect info in the database,
   // let's just skip.
-  if (timer_results.valueAsString(0, "fromsync") != "0")
+  if (msgjson.valueAsInt("$.expirationTimerUpdate.fromSync", 0) != 0)
   {
     std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
               << ": Unsupported message type 'timer-notification (fromSync=true)'. Skipping..." << std::endl;
@@ -53,19 +45,19 @@ bool SignalBackup::handleDTExpirationChangeMessage(SqliteDB const &ddb,
 
   // get details (who sent this, what's the new timer value
 
-  long long int timer = timer_results.getValueAs<long long int>(0, "expiretimer");
-  bool incoming = (timer_results.valueAsString(0, "type") == "incoming");
+  long long int timer = msgjson.valueAsInt("$.expirationTimerUpdate.expireTimer", 0);
+  bool incoming = (msgjson.valueAsString("$.type") == "incoming");
   if (!incoming)
   {
     // source is often uuid/phone of whoever set the timer? (maybe not on old messages
-    std::string source = timer_results.valueAsString(0, "source");
+    std::string source = msgjson.valueAsString("$.expirationTimerUpdate.source");
 
     SqliteDB::QueryResults convresults;
     if (ddb.exec("SELECT id FROM conversations WHERE e164 = ? OR " + d_dt_c_uuid + " = ?", {source, source}, &convresults) &&
         convresults.rows() == 1)
-      if (convresults.valueAsString(0, "id") == timer_results.valueAsString(0, "conversationId"))
+      if (convresults.valueAsString(0, "id") == msgjson.valueAsString("$.conversationId"))
       {
-        //std::cout << convresults(0, "id") << "=" << timer_results(0, "conversationId") << std::endl;
+        //std::cout << convresults(0, "id") << "=" << msgjson.valueAsString("$.conversationId") << std::endl;
         incoming = true;
       }
 
@@ -18,6 +18,7 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
 /*
   It seems the desktop message does not contain most of the info of the phone message. For example the creation message:
@@ -32,7 +33,7 @@
 
 */
 
-void SignalBackup::handleDTGroupChangeMessage(SqliteDB const &ddb, long long int rowid,
+void SignalBackup::handleDTGroupChangeMessage(DTMessageJson const &msgjson,
                                               long long int thread_id, long long int address, long long int date,
                                               std::map<long long int, long long int> *adjusted_timestamps,
                                               std::map<std::string, long long int> *savedmap,
@@ -46,33 +47,25 @@ void SignalBackup::handleDTGroupChangeMessage(SqliteDB const &ddb, long long int
 
   if (istimermessage)
   {
-
-    SqliteDB::QueryResults timer_results;
-    if (!ddb.exec("SELECT "
-                  "type, "
-                  "conversationId, "
-                  "IFNULL(json_extract(json,'$.expirationTimerUpdate.fromGroupUpdate'), false) AS fromgroupupdate, "
-                  "IFNULL(json_extract(json,'$.expirationTimerUpdate.fromSync'), false) AS fromsync, "
-                  "IFNULL(json_extract(json,'$.expirationTimerUpdate.expireTimer'), 0) AS expiretimer, "
-                  "json_extract(json,'$.expirationTimerUpdate.source') AS source, "
-                  "COALESCE(json_extract(json,'$.expirationTimerUpdate.sourceServiceId'), json_extract(json,'$.expirationTimerUpdate.sourceUuid')) AS sourceuuid "
-                  "FROM messages WHERE rowid = ?", rowid, &timer_results))
+    if (msgjson.tree.empty())
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Querying database" << std::endl;
       return;
     }
 
-    bool incoming = timer_results("sourceuuid") != d_selfuuid;
-    long long int timer = timer_results.getValueAs<long long int>(0, "expiretimer");
+    std::string sourceuuid = msgjson.isNull("$.expirationTimerUpdate.sourceServiceId") ?
+      msgjson.valueAsString("$.expirationTimerUpdate.sourceUuid") : msgjson.valueAsString("$.expirationTimerUpdate.sourceServiceId");
+    bool incoming = sourceuuid != d_selfuuid;
+    long long int timer = msgjson.valueAsInt("$.expirationTimerUpdate.expireTimer", 0);
     long long int groupv2type = Types::SECURE_MESSAGE_BIT | Types::PUSH_MESSAGE_BIT | Types::GROUP_V2_BIT |
       Types::GROUP_UPDATE_BIT | (incoming ? Types::BASE_INBOX_TYPE : Types::BASE_SENDING_TYPE);
     // at this point address is the group_recipient. This is good for outgoing messages,
     // but incoming should have individual_recipient
-    if (timer_results("sourceuuid").empty())
+    if (sourceuuid.empty())
       return;
     if (incoming)
-      address = getRecipientIdFromUuid(timer_results("sourceuuid"), savedmap);
+      address = getRecipientIdFromUuid(sourceuuid, savedmap);
 
     if (address == -1)
     {
@@ -142,25 +135,11 @@ void SignalBackup::handleDTGroupChangeMessage(SqliteDB const &ddb, long long int
     return;
   }
 
-  SqliteDB::QueryResults res;
-  if (!ddb.exec("SELECT "
-                "json_extract(json, '$.groupV2Change.from') AS source,"
-                "IFNULL(json_array_length(json, '$.groupV2Change.details'), 0) AS numchanges"
-                " FROM messages WHERE rowid = ?", rowid, &res))
-    return;
-
-  //res.prettyPrint();
-  long long int numchanges = res.getValueAs<long long int>(0, "numchanges");
-
-  for (uint i = 0; i < numchanges; ++i)
+  //std::cout << "source: " << msgjson.valueAsString("$.groupV2Change.from") << std::endl;
+  for ([[maybe_unused]] std::string const &detail : msgjson.children("$.groupV2Change.details"))
   {
-    if (!ddb.exec("SELECT "
-                  "json_extract(json, '$.groupV2Change.details[" + bepaald::toString(i) + "].type') AS type,"
-                  "COALESCE(json_extract(json, '$.groupV2Change.details[" + bepaald::toString(i) + "].aci'), json_extract(json, '$.groupV2Change.details[" + bepaald::toString(i) + "].uuid')) AS uuid"
-                  " FROM messages WHERE rowid = ?", rowid, &res))
-      continue;
-
-    //res.prettyPrint();
+    //std::cout << " type: " << msgjson.valueAsString(detail + ".type")
+    //          << " uuid: " << (msgjson.isNull(detail + ".aci") ? msgjson.valueAsString(detail + ".uuid") : msgjson.valueAsString(detail + ".aci")) << std::endl;
   }
 }
 
@@ -18,46 +18,43 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
-bool SignalBackup::handleDTGroupV1Migration(SqliteDB const &ddb, long long int rowid,
+bool SignalBackup::handleDTGroupV1Migration(SqliteDB const &ddb, DTMessageJson const &msgjson,
                                             long long int thread_id, long long int timestamp, long long int address,
                                             std::map<std::string, long long int> *recipientmap, bool createcontacts,
                                             std::string const &databasedir, bool *warned_createcontacts)
 {
   // get a list of dropped members (I _think_ these are not recipient uuid's but conversationUuid's...)
   std::string dropped_members;
-  SqliteDB::QueryResults results_droppedmembers;
-  if (ddb.exec("SELECT value AS droppedmember FROM messages, json_each(messages.json, '$.groupMigration.droppedMemberIds') WHERE messages.rowid = ?", rowid, &results_droppedmembers))
+  for (std::string const &dm : msgjson.children("$.groupMigration.droppedMemberIds"))
   {
-    for (uint dm = 0; dm < results_droppedmembers.rows(); ++dm)
+    std::string convuuid = msgjson.valueAsString(dm);
+    SqliteDB::QueryResults dm_id;
+    if (!ddb.exec("SELECT COALESCE(" + d_dt_c_uuid + ",e164) AS rid FROM conversations WHERE id IS ?", convuuid, &dm_id) ||
+        dm_id.rows() != 1)
+      continue;
+    long long int recid = getRecipientIdFromUuid(dm_id.valueAsString(0, "rid"), recipientmap, createcontacts);
+    if (recid < 0)
+      recid = getRecipientIdFromPhone(dm_id.valueAsString(0, "rid"), recipientmap, createcontacts);
+    if (recid < 0)
     {
-      std::string convuuid = results_droppedmembers.valueAsString(dm, "droppedmember");
-      SqliteDB::QueryResults dm_id;
-      if (!ddb.exec("SELECT COALESCE(" + d_dt_c_uuid + ",e164) AS rid FROM conversations WHERE id IS ?", convuuid, &dm_id) ||
-          dm_id.rows() != 1)
-        continue;
-      long long int recid = getRecipientIdFromUuid(dm_id.valueAsString(0, "rid"), recipientmap, createcontacts);
-      if (recid < 0)
-        recid = getRecipientIdFromPhone(dm_id.valueAsString(0, "rid"), recipientmap, createcontacts);
-      if (recid < 0)
-      {
-        // let's just check the uuid's aren't recipient uuid's to make sure
-        // this can go when we know it's working
-        SqliteDB::QueryResults test_results;
-        if (ddb.exec("SELECT " + d_dt_c_uuid + " FROM conversations WHERE " + d_dt_c_uuid + " IS ?", dm_id.valueAsString(0, "rid"), &test_results))
-          if (test_results.rows())
-            std::cout << " *** NOTE FOR DEV: id was not found as conversationId but does appear as recipientUuid (droppedMembers) ***" << std::endl;
+      // let's just check the uuid's aren't recipient uuid's to make sure
+      // this can go when we know it's working
+      SqliteDB::QueryResults test_results;
+      if (ddb.exec("SELECT " + d_dt_c_uuid + " FROM conversations WHERE " + d_dt_c_uuid + " IS ?", dm_id.valueAsString(0, "rid"), &test_results))
+        if (test_results.rows())
+          std::cout << " *** NOTE FOR DEV: id was not found as conversationId but does appear as recipientUuid (droppedMembers) ***" << std::endl;
 
-        if (createcontacts)
-          recid = dtCreateRecipient(ddb, dm_id.valueAsString(0, "rid"), dm_id.valueAsString(0, "rid"), std::string(),
-                                    databasedir, recipientmap, warned_createcontacts);
-        if (recid < 0)
-          continue;
-      }
+      if (createcontacts)
+        recid = dtCreateRecipient(ddb, dm_id.valueAsString(0, "rid"), dm_id.valueAsString(0, "rid"), std::string(),
+                                  databasedir, recipientmap, warned_createcontacts);
+      if (recid < 0)
+        continue;
+    }
 
 
-      dropped_members += (dropped_members.empty() ? bepaald::toString(recid) : ("," + bepaald::toString(recid)));
-    }
+    dropped_members += (dropped_members.empty() ? bepaald::toString(recid) : ("," + bepaald::toString(recid)));
   }
 
   // get a list of invited members
@@ -69,46 +66,39 @@ bool SignalBackup::handleDTGroupV1Migration(SqliteDB const &ddb, long long int r
   //
   // I'm assuming both are conversationUuid, but uuid might actually be recipients' uuid directly?
   //
-  // SELECT json_extract(value, '$.conversationId'), json_extract(value, '$.uuid') FROM messages, json_each(messages.json, '$.groupMigration.invitedMembers') AS TREE WHERE messages.rowid = ?;
   std::string invited_members;
-  SqliteDB::QueryResults results_invitedmembers;
-  //if (ddb.exec("SELECT json_extract(value, '$.conversationId') AS conversationId, json_extract(value, '$.uuid') AS uuid"
-  //             " FROM messages, json_each(messages.json, '$.groupMigration.invitedMembers') AS TREE WHERE messages.rowid = ?", rowid, &results_invitedmembers))
-  if (ddb.exec("SELECT COALESCE(json_extract(value, '$.conversationId'), COALESCE(json_extract(value, '$.aci'), json_extract(value, '$.uuid'))) AS convuuid, "
-               "json_extract(value, '$.conversationId') IS NULL AS is_uuid " // just to remember if this was gotten from "conversationId' or 'uuid' for testing
-               "FROM messages, json_each(messages.json, '$.groupMigration.invitedMembers') AS TREE WHERE messages.rowid = ?", rowid, &results_invitedmembers))
+  for (std::string const &im : msgjson.children("$.groupMigration.invitedMembers"))
   {
-    for (uint im = 0; im < results_invitedmembers.rows(); ++im)
+    bool is_uuid = msgjson.isNull(im + ".conversationId"); // just to remember if this was gotten from "conversationId' or 'uuid' for testing
+    std::string convuuid = !is_uuid ? msgjson.valueAsString(im + ".conversationId") :
+      (!msgjson.isNull(im + ".aci") ? msgjson.valueAsString(im + ".aci") : msgjson.valueAsString(im + ".uuid"));
+    if (!convuuid.empty())
     {
-      std::string convuuid = results_invitedmembers.valueAsString(im, "convuuid");
-      if (!convuuid.empty())
+      SqliteDB::QueryResults im_id;
+      if (!ddb.exec("SELECT COALESCE(" + d_dt_c_uuid + ", e164) AS rid FROM conversations WHERE id IS ?", convuuid, &im_id) ||
+          im_id.rows() != 1)
+        continue;
+      long long int recid = getRecipientIdFromUuid(im_id.valueAsString(0, "rid"), recipientmap, createcontacts);
+      if (recid < 0)
+        recid = getRecipientIdFromPhone(im_id.valueAsString(0, "rid"), recipientmap, createcontacts);
+      if (recid < 0)
       {
-        SqliteDB::QueryResults im_id;
-        if (!ddb.exec("SELECT COALESCE(" + d_dt_c_uuid + ", e164) AS rid FROM conversations WHERE id IS ?", convuuid, &im_id) ||
-            im_id.rows() != 1)
-          continue;
-        long long int recid = getRecipientIdFromUuid(im_id.valueAsString(0, "rid"), recipientmap, createcontacts);
-        if (recid < 0)
-          recid = getRecipientIdFromPhone(im_id.valueAsString(0, "rid"), recipientmap, createcontacts);
-        if (recid < 0)
-        {
-          // let's just check the uuid's aren't recipient uuid's to make sure
-          // this can go when we know it's working (and the SELECT can be shortened!)
-          SqliteDB::QueryResults test_results;
-          if (ddb.exec("SELECT " + d_dt_c_uuid + " FROM conversations WHERE " + d_dt_c_uuid + " IS ?", im_id.valueAsString(0, "rid"), &test_results))
-            if (test_results.rows())
-              std::cout << " *** NOTE FOR DEV: id was not found as conversationId but does appear as recipientUuid (invitedMembers, uuid: "
-                        << im_id.valueAsString(0, "is_uuid") << ") ***" << std::endl;
-
-          if (createcontacts)
-            recid = dtCreateRecipient(ddb, im_id.valueAsString(0, "rid"), im_id.valueAsString(0, "rid"), std::string(),
-                                      databasedir, recipientmap, warned_createcontacts);
-          if (recid < 0)
-            continue;
-        }
+        // let's just check the uuid's aren't recipient uuid's to make sure
+        // this can go when we know it's working (and the SELECT can be shortened!)
+        SqliteDB::QueryResults test_results;
+        if (ddb.exec("SELECT " + d_dt_c_uuid + " FROM conversations WHERE " + d_dt_c_uuid + " IS ?", im_id.valueAsString(0, "rid"), &test_results))
+          if (test_results.rows())
+            std::cout << " *** NOTE FOR DEV: id was not found as conversationId but does appear as recipientUuid (invitedMembers, uuid: "
+                      << is_uuid << ") ***" << std::endl;
 
-        invited_members += (invited_members.empty() ? bepaald::toString(recid) : ("," + bepaald::toString(recid)));
+        if (createcontacts)
+          recid = dtCreateRecipient(ddb, im_id.valueAsString(0, "rid"), im_id.valueAsString(0, "rid"), std::string(),
+                                    databasedir, recipientmap, warned_createcontacts);
+        if (recid < 0)
+          continue;
       }
+
+      invited_members += (invited_members.empty() ? bepaald::toString(recid) : ("," + bepaald::toString(recid)));
     }
   }
 
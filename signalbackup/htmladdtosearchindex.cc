@@ -0,0 +1,117 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+#include "htmlsearchindex.h"
+
+#include <unordered_map>
+
+bool SignalBackup::HTMLaddToSearchIndex(std::string const &directory, long long int thread_id, long long int thread_recipient_id,
+                                        SqliteDB::QueryResults const &messages, std::vector<unsigned int> const &pageends,
+                                        std::vector<std::string> const &pagepaths, HTMLSearchIndex *searchindex) const
+{
+  // maps message _id to the page it is on
+  std::unordered_map<long long int, unsigned int> messagepages;
+  messagepages.reserve(messages.rows());
+  for (uint p = 0, i = 0; p < pageends.size(); ++p)
+    for (; i < pageends[p]; ++i)
+      messagepages[messages.getValueAs<long long int>(i, "_id")] = p;
+
+  // get all entries for this thread at once (and have sqlite do the json formatting, the body
+  // in the messages results is already html-escaped at this point)
+  SqliteDB::QueryResults results;
+  if (!d_database.exec("SELECT "
+                       "_id, body, " + d_mms_type + ", date_received, " + d_mms_recipient_id + " AS sender, "
+                       "json_array(_id, body, " + d_mms_recipient_id + ", ?1, (" + d_mms_type + " & 0x1F) IN (2,11,21,22,23,24,25,26), date_received) AS line, "
+                       "IFNULL((SELECT part._id FROM part WHERE part.mid = " + d_mms_table + "._id AND part.ct = 'text/x-signal-plain' LIMIT 1), -1) AS rowid, "
+                       "IFNULL((SELECT part.unique_id FROM part WHERE part.mid = " + d_mms_table + "._id AND part.ct = 'text/x-signal-plain' LIMIT 1), -1) AS uniqueid "
+                       "FROM " + d_mms_table + " WHERE thread_id = ?2 ORDER BY date_received ASC",
+                       {thread_recipient_id, thread_id}, &results))
+  {
+    std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
+              << ": search_idx query failed for thread " << thread_id << std::endl;
+    return true; // not fatal, the thread is just not searchable
+  }
+
+  for (uint i = 0; i < results.rows(); ++i)
+  {
+    auto page = messagepages.find(results.getValueAs<long long int>(i, "_id"));
+    if (page == messagepages.end() ||
+        Types::isStatusMessage(results.getValueAs<long long int>(i, d_mms_type)) ||
+        results.valueAsString(i, "body").empty())
+      continue;
+
+    std::string line = results.valueAsString(i, "line");
+    std::string body = results.valueAsString(i, "body");
+    if (line.size() < 2) [[unlikely]]
+      continue;
+
+    long long int rowid = results.valueAsInt(i, "rowid");
+    long long int uniqueid = results.valueAsInt(i, "uniqueid");
+    auto attachment = d_attachments.end();
+    if (rowid != -1 && uniqueid != -1 &&
+        (attachment = d_attachments.find({rowid, uniqueid})) != d_attachments.end()) [[unlikely]]
+    {
+      AttachmentFrame *a = attachment->second.get();
+      std::string longbody = std::string(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize());
+      a->clearData();
+
+      std::string longline = d_database.getSingleResultAs<std::string>("SELECT json_set(?, '$[1]', ?)", {line, longbody}, std::string());
+      if (!longline.empty()) [[likely]]
+      {
+        line = std::move(longline);
+        body = std::move(longbody);
+      }
+    }
+
+    if (searchindex->currentshardwritten)
+    {
+      searchindex->shards.emplace_back();
+      searchindex->currentshardwritten = false;
+    }
+    HTMLSearchIndex::Shard &shard = searchindex->shards.back();
+
+    // replace closing ']' with page index
+    std::string const &pagepath = pagepaths[page->second];
+    auto [pageidx, inserted] = shard.pageindices.try_emplace(pagepath, shard.pages.size());
+    if (inserted)
+      shard.pages.push_back(pagepath);
+    line.back() = ',';
+    line += bepaald::toString(pageidx->second) + "]";
+
+    if (!shard.entries.empty()) [[likely]]
+      shard.entries += ",\n";
+    shard.entries += line;
+
+    long long int date = results.getValueAs<long long int>(i, "date_received");
+    if (shard.mindate == -1 || date < shard.mindate)
+      shard.mindate = date;
+    if (date > shard.maxdate)
+      shard.maxdate = date;
+    shard.thread_recipients.insert(thread_recipient_id);
+    shard.senders.insert(results.getValueAs<long long int>(i, "sender"));
+    HTMLSearchIndex::addTokens(body, &shard.tokens);
+    ++shard.messagecount;
+
+    if (shard.entries.size() >= HTMLSearchIndex::s_shardsize)
+      if (!HTMLwriteSearchIndexShard(directory, searchindex))
+        return false;
+  }
+  return true;
+}
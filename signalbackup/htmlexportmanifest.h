@@ -0,0 +1,64 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.h"
+
+struct HTMLExportManifest
+{
+  static constexpr char const *s_filename = ".signalbackup-tools-manifest";
+  static int constexpr s_version = 1;
+
+  struct Page
+  {
+    long long int first_msg_id;
+    long long int last_msg_id;
+    unsigned int messagecount;
+    uint64_t hash;              // hash over the message data rendered on this page
+    uint64_t footeroffset;      // offset in the page's html file where the page navigation starts
+  };
+
+  struct Thread
+  {
+    std::string threaddir;
+    std::string basefilename;
+    uint64_t headerhash;        // hash over recipient/group data used in the page header
+    long long int last_msg_id;
+    long long int last_msg_date;
+    std::vector<Page> pages;
+  };
+
+  uint64_t optionshash = 0;     // hash over the export options that change the output of every page
+  std::map<long long int, Thread> threads; // maps thread._id to its exported pages
+
+  // FNV-1a, this is not meant to be cryptographically secure, it only needs
+  // to detect changes in data between two exports
+  static inline void hashAdd(uint64_t *hash, std::string const &data)
+  {
+    for (unsigned char c : data)
+      *hash = (*hash ^ c) * 0x100000001b3ull;
+    *hash = (*hash ^ 0xff) * 0x100000001b3ull; // field separator
+  }
+
+  static inline void hashAdd(uint64_t *hash, long long int value)
+  {
+    hashAdd(hash, bepaald::toString(value));
+  }
+
+  static uint64_t constexpr s_hashinit = 0xcbf29ce484222325ull;
+};
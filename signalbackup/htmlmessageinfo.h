@@ -42,6 +42,7 @@ struct HTMLMessageInfo
   SqliteDB::QueryResults *attachment_results;
   SqliteDB::QueryResults *reaction_results;
   SqliteDB::QueryResults *edit_revisions;
+  MediaStore *mediastore;
 
   std::string body;
   std::string quote_body;
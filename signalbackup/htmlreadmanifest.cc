@@ -0,0 +1,94 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+#include "htmlexportmanifest.h"
+
+bool SignalBackup::HTMLreadManifest(std::string const &directory, HTMLExportManifest *manifest) const
+{
+  std::ifstream file(directory + "/" + HTMLExportManifest::s_filename, std::ios_base::in | std::ios_base::binary);
+  if (!file.is_open())
+    return false;
+
+  std::string line;
+  if (!std::getline(file, line) || line != "signalbackup-tools html export manifest " + bepaald::toString(HTMLExportManifest::s_version))
+  {
+    std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
+              << ": Ignoring existing manifest of unknown version" << std::endl;
+    return false;
+  }
+
+  HTMLExportManifest::Thread *current = nullptr;
+  unsigned int pagesexpected = 0;
+  while (std::getline(file, line))
+  {
+    std::string::size_type pos = line.find(' ');
+    if (pos == std::string::npos)
+      break;
+    std::string key = line.substr(0, pos);
+    std::istringstream values(line.substr(pos + 1));
+
+    if (key == "options")
+      values >> manifest->optionshash;
+    else if (key == "thread")
+    {
+      if (current && current->pages.size() != pagesexpected) [[unlikely]]
+        current->pages.clear();
+      long long int thread_id = -1;
+      HTMLExportManifest::Thread thread;
+      values >> thread_id >> thread.headerhash >> thread.last_msg_id >> thread.last_msg_date >> pagesexpected;
+      current = &(manifest->threads[thread_id] = std::move(thread));
+    }
+    else if (key == "dir" && current)
+      current->threaddir = line.substr(pos + 1);
+    else if (key == "file" && current)
+      current->basefilename = line.substr(pos + 1);
+    else if (key == "page" && current)
+    {
+      HTMLExportManifest::Page page;
+      values >> page.first_msg_id >> page.last_msg_id >> page.messagecount >> page.hash >> page.footeroffset;
+      current->pages.emplace_back(std::move(page));
+    }
+    else
+      break;
+
+    if (values.fail())
+      break;
+  }
+
+  if (!file.eof())
+  {
+    std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
+              << ": Failed to parse existing manifest, ignoring" << std::endl;
+    manifest->threads.clear();
+    return false;
+  }
+
+  // drop incomplete entries, they will just be regenerated
+  if (current && current->pages.size() != pagesexpected) [[unlikely]]
+    current->pages.clear();
+  for (auto it = manifest->threads.begin(); it != manifest->threads.end();)
+    if (it->second.pages.empty() || it->second.threaddir.empty() || it->second.basefilename.empty())
+      it = manifest->threads.erase(it);
+    else
+      ++it;
+
+  return true;
+}
@@ -0,0 +1,155 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.h"
+
+// The search index is split in shards of roughly s_shardsize bytes
+// (searchidx/shard_N.js), which the searchpage only loads when they can
+// contain results. For every shard, the date range, the threads and the
+// senders are listed in searchidx.js. Additionally, for each token (three
+// consecutive letters/digits, uppercased), searchidx/tokens_X.js (X is the
+// first character of the token) lists the shards the token occurs in, so a
+// (non-regex) search only needs the shards containing all its tokens.
+struct HTMLSearchIndex
+{
+  static unsigned int constexpr s_shardsize = 256 * 1024;
+  static int constexpr s_alphabetsize = 36; // 0-9A-Z
+  static int constexpr s_numtokens = s_alphabetsize * s_alphabetsize * s_alphabetsize;
+
+  struct Shard
+  {
+    std::set<long long int> thread_recipients;
+    std::set<long long int> senders;
+    long long int mindate = -1;
+    long long int maxdate = -1;
+    unsigned int messagecount = 0;
+    std::vector<uint64_t> tokens = std::vector<uint64_t>(s_numtokens / 64 + 1, 0); // bitmap of tokens occurring in this shard
+
+    // only set while the shard has not been written yet:
+    std::string entries;
+    std::vector<std::string> pages;
+    std::map<std::string, unsigned int> pageindices;
+  };
+
+  std::vector<Shard> shards;
+  bool currentshardwritten = true; // if false, shards.back() is still being filled
+
+  static inline int tokenChar(unsigned char c)
+  {
+    if (c >= '0' && c <= '9')
+      return c - '0';
+    if (c >= 'A' && c <= 'Z')
+      return c - 'A' + 10;
+    if (c >= 'a' && c <= 'z')
+      return c - 'a' + 10;
+    return -1;
+  }
+
+  static inline std::string tokenString(int token)
+  {
+    std::string res(3, ' ');
+    for (int i = 2; i >= 0; --i, token /= s_alphabetsize)
+      res[i] = (token % s_alphabetsize) < 10 ? '0' + (token % s_alphabetsize) : 'A' + (token % s_alphabetsize) - 10;
+    return res;
+  }
+
+  // adds all tokens in text to the bitmap. This must match the tokens the
+  // searchpage gets from `searchterm.toUpperCase()`, so the few non-ASCII
+  // characters that javascript uppercases to (partially) ASCII are mapped
+  // here as well. Any other character ends the current token.
+  static inline void addTokens(std::string const &text, std::vector<uint64_t> *tokens)
+  {
+    int prev2 = -1;
+    int prev1 = -1;
+    auto add = [&](int c)
+    {
+      if (c < 0)
+      {
+        prev2 = prev1 = -1;
+        return;
+      }
+      if (prev2 >= 0)
+      {
+        int token = (prev2 * s_alphabetsize + prev1) * s_alphabetsize + c;
+        (*tokens)[token / 64] |= (1ull << (token % 64));
+      }
+      prev2 = prev1;
+      prev1 = c;
+    };
+
+    for (unsigned int i = 0; i < text.size(); ++i)
+    {
+      unsigned char c = text[i];
+      if (c < 0x80) [[likely]]
+      {
+        add(tokenChar(c));
+        continue;
+      }
+
+      // decode utf-8
+      unsigned int cp = 0;
+      int extra = 0;
+      if ((c & 0xE0) == 0xC0)
+      {
+        cp = c & 0x1F;
+        extra = 1;
+      }
+      else if ((c & 0xF0) == 0xE0)
+      {
+        cp = c & 0x0F;
+        extra = 2;
+      }
+      else if ((c & 0xF8) == 0xF0)
+      {
+        cp = c & 0x07;
+        extra = 3;
+      }
+      for (; extra > 0 && i + 1 < text.size() && (static_cast<unsigned char>(text[i + 1]) & 0xC0) == 0x80; --extra)
+        cp = (cp << 6) | (static_cast<unsigned char>(text[++i]) & 0x3F);
+
+      char const *upper = nullptr; // '?' marks a non-ASCII character in the uppercase mapping
+      switch (cp)
+      {
+        case 0x00DF: upper = "SS"; break;  // ß
+        case 0x0131: upper = "I"; break;   // ı
+        case 0x017F: upper = "S"; break;   // ſ
+        case 0x0149: upper = "?N"; break;  // ŉ
+        case 0x01F0: upper = "J?"; break;  // ǰ
+        case 0x1E96: upper = "H?"; break;  // ẖ
+        case 0x1E97: upper = "T?"; break;  // ẗ
+        case 0x1E98: upper = "W?"; break;  // ẘ
+        case 0x1E99: upper = "Y?"; break;  // ẙ
+        case 0x1E9A: upper = "A?"; break;  // ẚ
+        case 0xFB00: upper = "FF"; break;  // ﬀ
+        case 0xFB01: upper = "FI"; break;  // ﬁ
+        case 0xFB02: upper = "FL"; break;  // ﬂ
+        case 0xFB03: upper = "FFI"; break; // ﬃ
+        case 0xFB04: upper = "FFL"; break; // ﬄ
+        case 0xFB05:                       // ﬅ
+        case 0xFB06: upper = "ST"; break;  // ﬆ
+        default: break;
+      }
+      if (!upper)
+        add(-1);
+      else
+        for (; *upper; ++upper)
+          add(tokenChar(*upper));
+    }
+  }
+};
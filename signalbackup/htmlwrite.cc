@@ -40,37 +40,44 @@
 #include "signalbackup.ih"
 
 bool SignalBackup::HTMLwriteStart(std::ofstream &file, long long int thread_recipient_id,
-                                  std::string const &directory, std::string const &threaddir, bool isgroup,
+                                  std::string const &directory, bool isgroup,
                                   bool isnotetoself, std::set<long long int> const &recipient_ids,
                                   std::map<long long int, RecipientInfo> *recipient_info,
                                   std::map<long long int, std::string> *written_avatars,
+                                  std::map<long long int, std::pair<GroupInfo, std::vector<long long int>>> *groupinfo_cache,
                                   bool overwrite, bool append, bool light, bool themeswitch,
                                   bool searchpage) const
 {
-
-  std::vector<long long int> groupmembers;
+  // group info and its (sorted) members are only determined once per export
+  std::pair<GroupInfo, std::vector<long long int>> nogroup;
+  std::pair<GroupInfo, std::vector<long long int>> *groupdata = &nogroup;
   if (isgroup)
   {
-    SqliteDB::QueryResults results;
-    d_database.exec("SELECT group_id from recipient WHERE _id IS ?", thread_recipient_id, &results);
-    if (results.rows() == 1)
-      getGroupMembersOld(&groupmembers, results.valueAsString(0, "group_id"));
+    auto [cached, inserted] = groupinfo_cache->try_emplace(thread_recipient_id);
+    groupdata = &cached->second;
+    if (inserted)
+    {
+      SqliteDB::QueryResults results;
+      d_database.exec("SELECT group_id from recipient WHERE _id IS ?", thread_recipient_id, &results);
+      if (results.rows() == 1)
+        getGroupMembersOld(&groupdata->second, results.valueAsString(0, "group_id"));
+
+      getGroupInfo(thread_recipient_id, &groupdata->first);
+
+      // sort group members by admin and name
+      GroupInfo const &gi = groupdata->first;
+      std::sort(groupdata->second.begin(), groupdata->second.end(),
+                [this, &gi, &recipient_info](auto left, auto right) {
+                  return (bepaald::contains(gi.admin_ids, left) && !bepaald::contains(gi.admin_ids, right)) ||
+                    ((bepaald::contains(gi.admin_ids, left) == bepaald::contains(gi.admin_ids, right)) &&
+                     (getRecipientInfoFromMap(recipient_info, left).display_name < getRecipientInfoFromMap(recipient_info, right).display_name));});
+    }
   }
+  GroupInfo const &groupinfo = groupdata->first;
+  std::vector<long long int> const &groupmembers = groupdata->second;
 
-  GroupInfo groupinfo;
-  if (isgroup)
-    getGroupInfo(thread_recipient_id, &groupinfo);
-
-  // sort group members by admin and name
-  std::sort(groupmembers.begin(), groupmembers.end(),
-            [this, &groupinfo, &recipient_info](auto left, auto right) {
-              return (bepaald::contains(groupinfo.admin_ids, left) && !bepaald::contains(groupinfo.admin_ids, right)) ||
-                ((bepaald::contains(groupinfo.admin_ids, left) == bepaald::contains(groupinfo.admin_ids, right)) &&
-                 (getRecipientInfoFromMap(recipient_info, left).display_name < getRecipientInfoFromMap(recipient_info, right).display_name));});
-
-  std::string thread_avatar = bepaald::contains(written_avatars, thread_recipient_id) ?
-    (*written_avatars)[thread_recipient_id] :
-    ((*written_avatars)[thread_recipient_id] = HTMLwriteAvatar(thread_recipient_id, directory, threaddir, overwrite, append));
+  // avatars are in the shared media directory, one level up from this page
+  std::string thread_avatar = HTMLwriteAvatar(thread_recipient_id, directory, written_avatars, overwrite, append);
 
   std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
   //file << "<!-- Generated on " << std::put_time(std::localtime(&now), "%F %T") // %F and %T do not work on minGW
@@ -280,14 +287,12 @@ bool SignalBackup::HTMLwriteStart(std::ofstream &file, long long int thread_reci
 
   for (long long int id : recipient_ids)
   {
-    std::string recipient_avatar = bepaald::contains(written_avatars, id) ?
-      (*written_avatars)[id] :
-      ((*written_avatars)[id] = HTMLwriteAvatar(id, directory, threaddir, overwrite, append));
+    std::string recipient_avatar = HTMLwriteAvatar(id, directory, written_avatars, overwrite, append);
     if (!recipient_avatar.empty())
     {
       file << R"(
       .avatar-)" << id << R"( {
-        background-image: url(")" << recipient_avatar << R"(");
+        background-image: url("../)" << recipient_avatar << R"(");
         background-position: center;
         background-repeat: no-repeat;
         background-size: cover;
@@ -1431,7 +1436,7 @@ file << R"(
           <input type="checkbox" id="zoomCheck-avatar">
           <label for="zoomCheck-avatar">
             <img class="avatar avatar-)" << thread_recipient_id
-             << R"( header-avatar msg-sender-)" << thread_recipient_id << R"(" src="media/Avatar_)" << thread_recipient_id << R"(.bin" alt=")" + getRecipientInfoFromMap(recipient_info, thread_recipient_id).initial + R"(">
+             << R"( header-avatar msg-sender-)" << thread_recipient_id << R"(" src="../)" << thread_avatar << R"(" alt=")" + getRecipientInfoFromMap(recipient_info, thread_recipient_id).initial + R"(">
           </label>)";
   }
   file << R"(
@@ -1549,7 +1554,7 @@ file << R"(
 
 void SignalBackup::HTMLwriteAttachmentDiv(std::ofstream &htmloutput, SqliteDB::QueryResults const &attachment_results, int indent,
                                           std::string const &directory, std::string const &threaddir,
-                                          bool is_image_preview, bool overwrite, bool append) const
+                                          bool is_image_preview, bool overwrite, bool append, MediaStore *mediastore) const
 {
   for (uint a = 0; a < attachment_results.rows(); ++a)
   {
@@ -1569,7 +1574,7 @@ void SignalBackup::HTMLwriteAttachmentDiv(std::ofstream &htmloutput, SqliteDB::Q
     }
 
     // write the attachment data
-    if (!HTMLwriteAttachment(directory, threaddir, rowid, uniqueid, overwrite, append))
+    if (!HTMLwriteAttachment(directory, threaddir, rowid, uniqueid, overwrite, append, mediastore))
       continue;
 
     std::string content_type = attachment_results.valueAsString(a, "ct");
@@ -1635,6 +1640,8 @@ void SignalBackup::HTMLwriteMessage(std::ofstream &htmloutput, HTMLMessageInfo c
                                     std::map<long long int, RecipientInfo> *recipient_info,
                                     bool searchpage) const
 {
+  Trace::Span span("SignalBackup::HTMLwriteMessage");
+
   int extraindent = 0;
   // insert message
 
@@ -1696,7 +1703,7 @@ void SignalBackup::HTMLwriteMessage(std::ofstream &htmloutput, HTMLMessageInfo c
     {
       htmloutput << std::string(extraindent, ' ') << "              <div class=\"msg-quote-attach\">" << std::endl;
       HTMLwriteAttachmentDiv(htmloutput, *msg_info.quote_attachment_results, 16 + extraindent,
-                             msg_info.directory, msg_info.threaddir, false, msg_info.overwrite, msg_info.append);
+                             msg_info.directory, msg_info.threaddir, false, msg_info.overwrite, msg_info.append, msg_info.mediastore);
       htmloutput << "                </div>" << std::endl;
     }
 
@@ -1707,7 +1714,7 @@ void SignalBackup::HTMLwriteMessage(std::ofstream &htmloutput, HTMLMessageInfo c
   HTMLwriteAttachmentDiv(htmloutput, *msg_info.attachment_results, 12 + extraindent,
                          msg_info.directory, msg_info.threaddir,
                          (!msg_info.link_preview_title.empty() || !msg_info.link_preview_description.empty()),
-                         msg_info.overwrite, msg_info.append);
+                         msg_info.overwrite, msg_info.append, msg_info.mediastore);
 
   // insert link_preview data?
   if (!msg_info.link_preview_title.empty() || !msg_info.link_preview_description.empty())
@@ -18,12 +18,13 @@
 */
 
 #include "signalbackup.ih"
+#include "mediastore.h"
 
 #include <cerrno>
 
 bool SignalBackup::HTMLwriteAttachment(std::string const &directory, std::string const &threaddir,
                                        long long int rowid, long long int uniqueid,  bool overwrite,
-                                       bool append) const
+                                       bool append, MediaStore *mediastore) const
 {
   if (!bepaald::contains(d_attachments, std::pair{rowid, uniqueid}))
     return false;
@@ -63,6 +64,9 @@ bool SignalBackup::HTMLwriteAttachment(std::string const &directory, std::string
 
   // write actual attachment:
   AttachmentFrame *a = d_attachments.at({rowid, uniqueid}).get();
+  if (mediastore)
+    return writeAttachmentDeduplicated(a, attachment_filename, mediastore);
+
   std::ofstream attachmentstream(attachment_filename, std::ios_base::binary);
   if (!attachmentstream.is_open())
   {
@@ -20,38 +20,43 @@
 #include "signalbackup.ih"
 
 std::string SignalBackup::HTMLwriteAvatar(long long int recipient_id, std::string const &directory,
-                                          std::string const &threaddir, bool overwrite, bool append) const
+                                          std::map<long long int, std::string> *written_avatars,
+                                          bool overwrite, bool append) const
 {
-  std::string avatar;
+  // every avatar is written only once per export, to the media directory shared by all threads.
+  // The returned path is relative to `directory'.
+  if (auto written = written_avatars->find(recipient_id); written != written_avatars->end())
+    return written->second;
+  std::string &avatar = (*written_avatars)[recipient_id];
+
   auto pos = d_avatars.end();
   if ((pos =
        std::find_if(d_avatars.begin(), d_avatars.end(),
                     [recipient_id](auto const &p) { return p.first == bepaald::toString(recipient_id); })) != d_avatars.end())
   {
-    avatar = "media/Avatar_" + pos->first + ".bin";
-
-    // directory + threaddir is guaranteed to exist at this point, check/create 'media'
-    if (!bepaald::fileOrDirExists(directory + "/" + threaddir + "/media"))
+    // directory is guaranteed to exist at this point, check/create 'media'
+    if (!bepaald::fileOrDirExists(directory + "/media"))
     {
-      if (!bepaald::createDir(directory + "/" + threaddir + "/media"))
+      if (!bepaald::createDir(directory + "/media"))
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
-                  << ": failed to create directory `" << directory << "/" << threaddir << "/media" << std::endl;
+                  << ": failed to create directory `" << directory << "/media" << std::endl;
         return std::string();
       }
     }
-    else if (!bepaald::isDir(directory + "/" + threaddir + "/media"))
+    else if (!bepaald::isDir(directory + "/media"))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
-                << ": failed to create directory `" << directory << "/" << threaddir << "/media" << std::endl;
+                << ": failed to create directory `" << directory << "/media" << std::endl;
       return std::string();
     }
 
     // check actual avatar file
-    if (bepaald::fileOrDirExists(directory + "/" + threaddir + "/" + avatar))
+    std::string avatarfile = "media/Avatar_" + pos->first + ".bin";
+    if (bepaald::fileOrDirExists(directory + "/" + avatarfile))
     {
       if (append) // file already exists, but we were asked to just use the existing file, so we're done
-        return avatar;
+        return (avatar = avatarfile);
       if (!overwrite) // file already exists, but we were no asked to overwrite -> error!
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
@@ -62,17 +67,18 @@ std::string SignalBackup::HTMLwriteAvatar(long long int recipient_id, std::strin
 
     // directory exists, now write avatar
     AvatarFrame *a = pos->second.get();
-    std::ofstream avatarstream(directory + "/" + threaddir + "/" + avatar, std::ios_base::binary);
+    std::ofstream avatarstream(directory + "/" + avatarfile, std::ios_base::binary);
     if (!avatarstream.is_open())
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to open file for writing: '"
-                << directory << "/" << threaddir << "/" << avatar << "'" << std::endl;
+                << directory << "/" << avatarfile << "'" << std::endl;
       return std::string();
     }
     else
       if (!avatarstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
         return std::string();
+    avatar = avatarfile;
   }
   return avatar;
 }
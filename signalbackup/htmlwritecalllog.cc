@@ -20,7 +20,8 @@
 #include "signalbackup.ih"
 
 void SignalBackup::HTMLwriteCallLog(std::vector<long long int> const &threads, std::string const &directory,
-                                    std::map<long long int, RecipientInfo> *recipientinfo [[maybe_unused]], long long int notetoself_tid [[maybe_unused]],
+                                    std::map<long long int, RecipientInfo> *recipientinfo [[maybe_unused]],
+                                    std::map<long long int, std::string> *written_avatars, long long int notetoself_tid [[maybe_unused]],
                                     bool overwrite, bool append, bool light, bool themeswitching) const
 {
   std::cout << "Writing calllog.html..." << std::endl;
@@ -282,18 +283,13 @@ void SignalBackup::HTMLwriteCallLog(std::vector<long long int> const &threads, s
     long long int peer = results.valueAsInt(i, "peer");
     if (peer > -1 && !bepaald::contains(peers, peer))
     {
-      if (getRecipientInfoFromMap(recipientinfo, peer).hasavatar)
+      std::string avatar_path;
+      if (getRecipientInfoFromMap(recipientinfo, peer).hasavatar &&
+          !(avatar_path = HTMLwriteAvatar(peer, directory, written_avatars, overwrite, append)).empty())
       {
-        long long int threadid = d_database.getSingleResultAs<long long int>("SELECT thread_id FROM " + d_mms_table + " WHERE _id = ?", results(i, "message_id"), -1);
-        if (threadid == -1)
-          continue;
-
-        std::string avatar_path = (sanitizeFilename(getRecipientInfoFromMap(recipientinfo, peer).display_name + " (_id" + bepaald::toString(threadid) + ")"));
-        bepaald::replaceAll(&avatar_path, '\"', R"(\")");
-
         outputfile
           << "      .avatar-" << peer << " {" << std::endl
-          << "        background-image: url(\"" << avatar_path << "/media/Avatar_" << peer << ".bin\");" << std::endl
+          << "        background-image: url(\"" << avatar_path << "\");" << std::endl
           << "        background-position: center;" << std::endl
           << "        background-repeat: no-repeat;" << std::endl
           << "        background-size: cover;" << std::endl
@@ -20,7 +20,8 @@
 #include "signalbackup.ih"
 
 void SignalBackup::HTMLwriteIndex(std::vector<long long int> const &threads, std::string const &directory,
-                                  std::map<long long int, RecipientInfo> *recipient_info, long long int note_to_self_tid,
+                                  std::map<long long int, RecipientInfo> *recipient_info,
+                                  std::map<long long int, std::string> *written_avatars, long long int note_to_self_tid,
                                   bool calllog, bool searchpage, bool overwrite, bool append, bool light,
                                   bool themeswitching) const
 {
@@ -222,16 +223,13 @@ void SignalBackup::HTMLwriteIndex(std::vector<long long int> const &threads, std
       continue;
     }
 
-    if (getRecipientInfoFromMap(recipient_info, rec_id).hasavatar)
+    std::string avatar_path;
+    if (getRecipientInfoFromMap(recipient_info, rec_id).hasavatar &&
+        !(avatar_path = HTMLwriteAvatar(rec_id, directory, written_avatars, overwrite, append)).empty())
     {
-      std::string avatar_path = (results.getValueAs<long long int>(i, "_id") == note_to_self_tid ?
-                                 "Note to self (_id" + results(i, "_id") + ")" :
-                                 sanitizeFilename(getRecipientInfoFromMap(recipient_info, rec_id).display_name + " (_id" + results(i, "_id") + ")"));
-      bepaald::replaceAll(&avatar_path, '\"', R"(\")");
-
       outputfile
         << "      .avatar-" << rec_id << " {" << std::endl
-        << "        background-image: url(\"" << avatar_path << "/media/Avatar_" << rec_id << ".bin\");" << std::endl
+        << "        background-image: url(\"" << avatar_path << "\");" << std::endl
         << "        background-position: center;" << std::endl
         << "        background-repeat: no-repeat;" << std::endl
         << "        background-size: cover;" << std::endl
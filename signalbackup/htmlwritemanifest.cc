@@ -0,0 +1,66 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+#include "htmlexportmanifest.h"
+
+bool SignalBackup::HTMLwriteManifest(std::string const &directory, HTMLExportManifest const &manifest) const
+{
+  // write to temporary file first, so an interrupted export never leaves a manifest that
+  // claims pages were written which are not there
+  std::string const filename(directory + "/" + HTMLExportManifest::s_filename);
+  std::ofstream file(filename + ".tmp", std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!file.is_open())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+              << ": Failed to open '" << filename << ".tmp' for writing" << std::endl;
+    return false;
+  }
+
+  file << "signalbackup-tools html export manifest " << HTMLExportManifest::s_version << '\n';
+  file << "options " << manifest.optionshash << '\n';
+  for (auto const &[thread_id, thread] : manifest.threads)
+  {
+    file << "thread " << thread_id << " " << thread.headerhash << " " << thread.last_msg_id << " "
+         << thread.last_msg_date << " " << thread.pages.size() << '\n';
+    file << "dir " << thread.threaddir << '\n';
+    file << "file " << thread.basefilename << '\n';
+    for (auto const &page : thread.pages)
+      file << "page " << page.first_msg_id << " " << page.last_msg_id << " " << page.messagecount << " "
+           << page.hash << " " << page.footeroffset << '\n';
+  }
+  file.close();
+  if (!file)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+              << ": Failed to write manifest" << std::endl;
+    return false;
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(filename + ".tmp", filename, ec);
+  if (ec)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+              << ": Failed to write manifest (" << ec.message() << ")" << std::endl;
+    return false;
+  }
+  return true;
+}
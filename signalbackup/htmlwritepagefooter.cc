@@ -0,0 +1,128 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+void SignalBackup::HTMLwritePageFooter(std::ofstream &htmloutput, std::string raw_base_filename, int pagenumber,
+                                       int totalpages, long long int thread_recipient_id, bool searchpage,
+                                       bool themeswitching) const
+{
+  HTMLescapeUrl(&raw_base_filename);
+
+  if (totalpages > 1)
+  {
+    htmloutput << "      <div class=\"conversation-link conversation-link-left\">" << std::endl;
+    htmloutput << "        <div title=\"First page\">" << std::endl;
+    htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + ".html") << "\">" << std::endl;
+    htmloutput << "            <div class=\"menu-icon nav-max" << (pagenumber > 0 ? "" : " nav-disabled") << "\"></div>" << std::endl;
+    htmloutput << "          </a>" << std::endl;
+    htmloutput << "        </div>" << std::endl;
+    htmloutput << "        <div title=\"Previous page\">" << std::endl;
+    htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + (pagenumber - 1 > 0 ? ("_" + bepaald::toString(pagenumber - 1)) : "") + ".html") << "\">" << std::endl;
+    htmloutput << "            <div class=\"menu-icon nav-one" << (pagenumber > 0 ? "" : " nav-disabled") << "\"></div>" << std::endl;
+    htmloutput << "          </a>" << std::endl;
+    htmloutput << "        </div>" << std::endl;
+    htmloutput << "      </div>" << std::endl;
+    htmloutput << "      <div class=\"conversation-link conversation-link-right\">" << std::endl;
+    htmloutput << "        <div title=\"Next page\">" << std::endl;
+    htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + "_" + (pagenumber + 1 <= totalpages - 1 ?  bepaald::toString(pagenumber + 1) : bepaald::toString(totalpages - 1)) + ".html") << "\">" << std::endl;
+    htmloutput << "            <div class=\"menu-icon nav-one nav-fwd" << (pagenumber < totalpages - 1 ? "" : " nav-disabled") << "\"></div>" << std::endl;
+    htmloutput << "          </a>" << std::endl;
+    htmloutput << "        </div>" << std::endl;
+    htmloutput << "        <div title=\"Last page\">" << std::endl;
+    htmloutput << "          <a href=\"" << sanitizeFilename(raw_base_filename + "_" + bepaald::toString(totalpages - 1) + ".html") << "\">" << std::endl;
+    htmloutput << "            <div class=\"menu-icon nav-max nav-fwd" << (pagenumber < totalpages - 1 ? "" : " nav-disabled") << "\"></div>" << std::endl;
+    htmloutput << "          </a>" << std::endl;
+    htmloutput << "        </div>" << std::endl;
+    htmloutput << "      </div>" << std::endl;
+    htmloutput << std::endl;
+  }
+  htmloutput << "     </div>" << std::endl; // closes controls-wrapper
+  htmloutput << std::endl;
+  htmloutput << "       <div id=\"bottom\">" << std::endl;
+  htmloutput << "         <a href=\"#pagebottom\" title=\"Jump to bottom\">" << std::endl;
+  htmloutput << "           <div class=\"menu-item-bottom\">" << std::endl;
+  htmloutput << "             <span class=\"menu-icon nav-one nav-bottom\">" << std::endl;
+  htmloutput << "             </span>" << std::endl;
+  htmloutput << "           </div>" << std::endl;
+  htmloutput << "         </a>" << std::endl;
+  htmloutput << "      </div>" << std::endl;
+  htmloutput << "      <div id=\"menu\">" << std::endl;
+  htmloutput << "        <a href=\"../index.html\">" << std::endl;
+  htmloutput << "          <div class=\"menu-item\">" << std::endl;
+  htmloutput << "            <div class=\"menu-icon nav-up\">" << std::endl;
+  htmloutput << "            </div>" << std::endl;
+  htmloutput << "            <div>" << std::endl;
+  htmloutput << "              index" << std::endl;
+  htmloutput << "            </div>" << std::endl;
+  htmloutput << "          </div>" << std::endl;
+  htmloutput << "        </a>" << std::endl;
+  htmloutput << "      </div>" << std::endl;
+  htmloutput << std::endl;
+  if (themeswitching || searchpage)
+  {
+    htmloutput << "      <div id=\"theme\">" << std::endl;
+    if (searchpage)
+    {
+      htmloutput << "        <div class=\"menu-item\">" << std::endl;
+      htmloutput << "          <a href=\"../searchpage.html?recipient=" << thread_recipient_id << "\" title=\"Search\">" << std::endl;
+      htmloutput << "            <span class=\"menu-icon searchbutton\">" << std::endl;
+      htmloutput << "            </span>" << std::endl;
+      htmloutput << "          </a>" << std::endl;
+      htmloutput << "        </div>" << std::endl;
+    }
+    if (themeswitching)
+    {
+      htmloutput << "        <div class=\"menu-item\">" << std::endl;
+      htmloutput << "          <label for=\"theme-switch\">" << std::endl;
+      htmloutput << "            <span class=\"menu-icon themebutton\">" << std::endl;
+      htmloutput << "            </span>" << std::endl;
+      htmloutput << "          </label>" << std::endl;
+      htmloutput << "        </div>" << std::endl;
+    }
+    htmloutput << "      </div>" << std::endl;
+    htmloutput << std::endl;
+  }
+  htmloutput << "  </div>" << std::endl; // closes div id=page (I think)
+  if (themeswitching)
+  {
+    htmloutput << R"(  <script>
+    const themeSwitch = document.querySelector('#theme-switch');
+    themeSwitch.addEventListener('change', function(e)
+    {
+      if (e.currentTarget.checked === true)
+      {
+        //alert('Setting theme light');
+        setCookie('theme', 'light');
+        document.documentElement.dataset.theme = 'light';
+      }
+      else
+      {
+        //alert('Setting theme dark');
+        setCookie('theme', 'dark');
+        document.documentElement.dataset.theme = 'dark';
+      }
+    });
+  </script>
+
+)";
+  }
+  htmloutput << "  </body>" << std::endl;
+  htmloutput << "</html>" << std::endl;
+}
@@ -0,0 +1,118 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+#include "htmlsearchindex.h"
+
+bool SignalBackup::HTMLwriteSearchIndex(std::string const &directory, HTMLSearchIndex *searchindex,
+                                        std::map<long long int, RecipientInfo> *recipient_info) const
+{
+  if (!HTMLwriteSearchIndexShard(directory, searchindex))
+    return false;
+
+  std::ofstream searchidx(directory + "/" + "searchidx.js", std::ios_base::binary);
+  if (!searchidx.is_open())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+              << ": Failed to open 'searchidx.js' for writing" << std::endl;
+    return false;
+  }
+
+  // write recipient info:
+  searchidx << "recipient_idx = [" << std::endl;
+  for (auto r = recipient_info->begin(); r != recipient_info->end(); ++r)
+  {
+    std::string line = d_database.getSingleResultAs<std::string>("SELECT json_object('_id', ?, 'display_name', ?)", {r->first, r->second.display_name}, std::string());
+    if (line.empty()) [[unlikely]]
+      continue;
+
+    searchidx << "  " << line << (std::next(r) != recipient_info->end() ? "," : "") << std::endl;
+  }
+  searchidx << "];" << std::endl;
+
+  // write shard info (t: thread recipients, s: senders, d0/d1: date range, n: number of messages)
+  auto writeset = [&](std::set<long long int> const &set)
+  {
+    searchidx << "[";
+    for (auto it = set.begin(); it != set.end(); ++it)
+      searchidx << (it != set.begin() ? "," : "") << *it;
+    searchidx << "]";
+  };
+  searchidx << "shard_idx = [" << std::endl;
+  for (uint i = 0; i < searchindex->shards.size(); ++i)
+  {
+    HTMLSearchIndex::Shard const &shard = searchindex->shards[i];
+    searchidx << "  {\"t\":";
+    writeset(shard.thread_recipients);
+    searchidx << ",\"s\":";
+    writeset(shard.senders);
+    searchidx << ",\"d0\":" << shard.mindate << ",\"d1\":" << shard.maxdate << ",\"n\":" << shard.messagecount << "}"
+              << (i < searchindex->shards.size() - 1 ? "," : "") << std::endl;
+  }
+  searchidx << "];" << std::endl;
+  if (!searchidx.good())
+    return false;
+
+  // write token maps, one file per first character of the token. Each token maps to
+  // a bitmap of the shards it occurs in, written as hex string with the lowest shard
+  // in the lowest bit of the first character ('*' if the token is in every shard).
+  int constexpr tokensperfile = HTMLSearchIndex::s_alphabetsize * HTMLSearchIndex::s_alphabetsize;
+  for (int f = 0; f < HTMLSearchIndex::s_alphabetsize; ++f)
+  {
+    std::string firstchar = HTMLSearchIndex::tokenString(f * tokensperfile).substr(0, 1);
+    std::string filename = "searchidx/tokens_" + firstchar + ".js";
+    std::ofstream tokenfile(directory + "/" + filename, std::ios_base::binary);
+    if (!tokenfile.is_open())
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to open '" << directory << "/" << filename << "' for writing" << std::endl;
+      return false;
+    }
+
+    tokenfile << "searchidx_addtokens(\"" << firstchar << "\", {";
+    bool first = true;
+    for (int token = f * tokensperfile; token < (f + 1) * tokensperfile; ++token)
+    {
+      std::string bitmap((searchindex->shards.size() + 3) / 4, 0);
+      unsigned int count = 0;
+      for (uint s = 0; s < searchindex->shards.size(); ++s)
+        if (searchindex->shards[s].tokens[token / 64] & (1ull << (token % 64)))
+        {
+          bitmap[s / 4] |= (1 << (s % 4));
+          ++count;
+        }
+      if (count == 0)
+        continue;
+
+      if (count == searchindex->shards.size())
+        bitmap = "*";
+      else
+      {
+        while (!bitmap.empty() && bitmap.back() == 0)
+          bitmap.pop_back();
+        for (char &c : bitmap)
+          c = "0123456789abcdef"[static_cast<int>(c)];
+      }
+      tokenfile << (first ? "\n" : ",\n") << "\"" << HTMLSearchIndex::tokenString(token) << "\":\"" << bitmap << "\"";
+      first = false;
+    }
+    tokenfile << "\n});\n";
+  }
+  return true;
+}
@@ -0,0 +1,51 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+#include "htmlsearchindex.h"
+
+bool SignalBackup::HTMLwriteSearchIndexShard(std::string const &directory, HTMLSearchIndex *searchindex) const
+{
+  if (searchindex->currentshardwritten || searchindex->shards.empty()) [[unlikely]]
+    return true;
+
+  unsigned int shardnumber = searchindex->shards.size() - 1;
+  HTMLSearchIndex::Shard &shard = searchindex->shards.back();
+  std::string filename = "searchidx/shard_" + bepaald::toString(shardnumber) + ".js";
+
+  std::ofstream shardfile(directory + "/" + filename, std::ios_base::binary);
+  if (!shardfile.is_open())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+              << ": Failed to open '" << directory << "/" << filename << "' for writing" << std::endl;
+    return false;
+  }
+
+  shardfile << "searchidx_addshard(" << shardnumber << ", [";
+  for (uint i = 0; i < shard.pages.size(); ++i)
+    shardfile << (i ? ", " : "") << d_database.getSingleResultAs<std::string>("SELECT json_quote(?)", shard.pages[i], "\"\"");
+  shardfile << "], [\n" << shard.entries << "\n]);\n";
+
+  // the entries are no longer needed, only the shards metadata
+  shard.entries = std::string();
+  shard.pages = std::vector<std::string>();
+  shard.pageindices.clear();
+  searchindex->currentshardwritten = true;
+  return shardfile.good();
+}
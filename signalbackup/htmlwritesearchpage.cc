@@ -640,13 +640,119 @@ body {
     var firstbutton = document.getElementById("searchfirst");
     var lastbutton = document.getElementById("searchlast");
 
-    function getSearchFieldAndSearch()
+    /* the messages are split over shards (searchidx/shard_N.js), which are only
+       loaded when needed. shard_idx (in searchidx.js) holds the date range,
+       threads and senders of every shard, searchidx/tokens_X.js lists which
+       shards contain the tokens (3 letters/digits) starting with X */
+    var loaded_shards = {};
+    var loaded_tokens = {};
+
+    function searchidx_addshard(n, pages, entries)
+    {
+      loaded_shards[n] = {pages: pages, entries: entries};
+    }
+
+    function searchidx_addtokens(c, tokens)
+    {
+      loaded_tokens[c] = tokens;
+    }
+
+    function loadScript(src)
+    {
+      return new Promise((resolve) => {
+        var script = document.createElement('script');
+        script.src = src;
+        script.onload = resolve;
+        script.onerror = resolve; // a missing token file just means no pruning
+        document.head.append(script);
+      });
+    }
+
+    function getFilters(regex)
+    {
+      var filters = {usedate: document.getElementById('enable_date').checked, mindate: 0, maxdate: 0,
+                     userecipient: document.getElementById('enable_recipient').checked, recipient: -1,
+                     matchsender: (regex || onlythread === false)};
+      if (filters.usedate)
+      {
+        var d = new Date(document.getElementById("mindate").value);
+        filters.mindate = Date.UTC(d.getFullYear(), d.getMonth(), d.getDate());
+        var d = new Date(document.getElementById("maxdate").value);
+        filters.maxdate = Date.UTC(d.getFullYear(), d.getMonth(), d.getDate());
+      }
+      if (filters.userecipient)
+        filters.recipient = document.getElementById("recipientselector").value;
+      return filters;
+    }
+
+    function getTokens(term)
+    {
+      var tokens = new Set();
+      var run = '';
+      for (const c of term.toUpperCase() + ' ')
+      {
+        if ((c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z'))
+        {
+          run += c;
+          continue;
+        }
+        for (let i = 0; i + 3 <= run.length; ++i)
+          tokens.add(run.substring(i, i + 3));
+        run = '';
+      }
+      return [...tokens];
+    }
+
+    function shardHasToken(n, token)
+    {
+      var tokenmap = loaded_tokens[token[0]];
+      if (tokenmap === undefined) // failed to load, can't exclude anything
+        return true;
+      var bitmap = tokenmap[token];
+      if (bitmap === undefined)
+        return false;
+      if (bitmap === '*')
+        return true;
+      return (n >> 2) < bitmap.length && ((parseInt(bitmap[n >> 2], 16) >> (n & 3)) & 1) == 1;
+    }
+
+    async function getShards(term, regex, filters)
+    {
+      var shards = [];
+      for (let n = 0; n < shard_idx.length; ++n)
+      {
+        var s = shard_idx[n];
+        if (filters.usedate && (s.d1 < filters.mindate || s.d0 > filters.maxdate))
+          continue;
+        if (filters.userecipient && !s.t.some(r => r == filters.recipient) &&
+            !(filters.matchsender && s.s.some(r => r == filters.recipient)))
+          continue;
+        shards.push(n);
+      }
+
+      if (!regex)
+      {
+        var tokens = getTokens(term);
+        var tokenfiles = [...new Set(tokens.map(t => t[0]))].filter(c => !(c in loaded_tokens));
+        await Promise.all(tokenfiles.map(c => loadScript('searchidx/tokens_' + c + '.js')));
+        shards = shards.filter(n => tokens.every(t => shardHasToken(n, t)));
+      }
+
+      await Promise.all(shards.filter(n => !(n in loaded_shards)).map(n => loadScript('searchidx/shard_' + n + '.js')));
+      return shards.filter(n => n in loaded_shards);
+    }
+
+    async function getSearchFieldAndSearch()
     {
       searchstr = document.getElementById('search_field').value;
       if (!searchstr || searchstr.length === 0)
         return;
+      var regex = document.getElementById('enable_regex').checked;
+      document.getElementById("summary").innerHTML = "(searching...)";
       //start = performance.now();
-      global_results = search(message_idx, searchstr, document.getElementById('enable_regex').checked);
+      var filters = getFilters(regex);
+      var shards = await getShards(searchstr, regex, filters);
+      global_results = search(shards, searchstr, regex, filters);
       //end = performance.now();
       //console.log(`Execution time: ${end - start} ms`);
       global_searchstring = searchstr;
@@ -654,34 +760,34 @@ body {
       showResults();
     }
 
-    function search(obj, term, regex)
+    function search(shards, term, regex, filters)
     {
-      var mindate = 0;
-      var maxdate = 0;
-      if (document.getElementById('enable_date').checked)
+      var matches;
+      if (regex == true)
       {
-        var d = new Date(document.getElementById("mindate").value);
-        mindate = Date.UTC(d.getFullYear(), d.getMonth(), d.getDate());
-        var d = new Date(document.getElementById("maxdate").value);
-        maxdate = Date.UTC(d.getFullYear(), d.getMonth(), d.getDate());
+        const rgx = RegExp(term, "i");
+        matches = b => rgx.test(b);
       }
-
-      var recipient = -1;
-      if (document.getElementById('enable_recipient').checked)
+      else
       {
-        recipient = document.getElementById("recipientselector").value;
+        const upperterm = term.toUpperCase();
+        matches = b => b.toUpperCase().includes(upperterm);
       }
 
-      if (regex == true)
+      // entry: [id, body, from, thread recipient, outgoing, date, page]
+      var results = [];
+      for (const n of shards)
       {
-        const regex = RegExp(term, "i");
-        return obj.filter(element => regex.test(element.b) &&
-                                     (document.getElementById('enable_date').checked === false || (element.d >= mindate && element.d <= maxdate)) &&
-                                     (document.getElementById('enable_recipient').checked === false || (element.f == recipient || element.tr == recipient))).sort((r1, r2) => r1.date - r2.date);
+        var shard = loaded_shards[n];
+        for (const e of shard.entries)
+        {
+          if (matches(e[1]) &&
+              (filters.usedate === false || (e[5] >= filters.mindate && e[5] <= filters.maxdate)) &&
+              (filters.userecipient === false || ((filters.matchsender && e[2] == filters.recipient) || e[3] == filters.recipient)))
+            results.push({id: e[0], b: e[1], f: e[2], tr: e[3], o: e[4], d: e[5], p: shard.pages[e[6]]});
+        }
       }
-      return obj.filter(element => element.b.toUpperCase().includes(term.toUpperCase()) &&
-                                   (document.getElementById('enable_date').checked === false || (element.d >= mindate && element.d <= maxdate)) &&
-                                   (document.getElementById('enable_recipient').checked === false || ((onlythread === false && element.f == recipient) || element.tr == recipient))).sort((r1, r2) => r1.date - r2.date);
+      return results.sort((r1, r2) => r1.d - r2.d);
     }
 
     function stringinsert(str, index, value)
@@ -18,10 +18,13 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
 #include "../sqlcipherdecryptor/sqlcipherdecryptor.h"
 #include "../msgtypes/msgtypes.h"
 
+#include <chrono>
+
 /*
   TODO
   DONE? - limit timeframe
@@ -202,6 +205,7 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
                                      bool createmissingcontacts,
                                      bool autodates, bool ignorewal, std::string const &selfphone)
 {
+  PhaseStats::Scope phase("import desktop");
 
   d_selfid = selfphone.empty() ? scanSelf() : d_database.getSingleResultAs<long long int>("SELECT _id FROM recipient WHERE " + d_recipient_e164 + " = ?", selfphone, -1);
   if (d_selfid == -1)
@@ -234,24 +238,15 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     return false;
   }
 
-  SqlCipherDecryptor sqlcipherdecryptor(configdir, databasedir, sqlcipherversion);
+  // the database pages are decrypted on demand, as they are read by sqlite
+  SqlCipherDecryptor sqlcipherdecryptor(configdir, databasedir, sqlcipherversion, true /*lazy*/);
   if (!sqlcipherdecryptor.ok())
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to open database" << std::endl;
     return false;
   }
 
-  auto [data, size] = sqlcipherdecryptor.data(); // unsigned char *, uint64_t
-
-  // disable WAL (Write-Ahead Logging) on database, reading from memory otherwise will not work
-  // see https://www.sqlite.org/fileformat.html
-  if (data[0x12] == 2)
-    data[0x12] = 1;
-  if (data[0x13] == 2)
-    data[0x13] = 1;
-
-  std::pair<unsigned char *, uint64_t> desktopdata = {data, size};
-  SqliteDB ddb(&desktopdata);
+  SqliteDB ddb(&sqlcipherdecryptor);
   if (!ddb.ok())
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : Failed to open database" << std::endl;
@@ -333,6 +328,30 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
   // this map will map desktop-recipient-uuid's to android recipient._id's
   std::map<std::string, long long int> recipientmap;
 
+  // the messages are inserted in one big transaction (committed every so
+  // often), reusing the prepared statements, and recipients are resolved from
+  // an index of the recipient table built here, instead of a query per uuid.
+  // The guard ends this however the loop below is left.
+  long long int constexpr COMMIT_EVERY = 10000; // messages
+  struct ImportBatch
+  {
+    SignalBackup *sb;
+    inline void end()
+    {
+      sb->d_database.endBatch();
+      sb->d_recipientidbyuuid.clear();
+      sb->d_recipientidbyphone.clear();
+    }
+    inline ~ImportBatch()
+    {
+      end();
+    }
+  } importbatch{this};
+  buildRecipientIdIndex();
+  d_database.beginBatch();
+  long long int messages_processed = 0;
+  auto import_start = std::chrono::steady_clock::now();
+
   // for each conversation
   for (uint i = 0; i < results_all_conversations.rows(); ++i)
   {
@@ -543,8 +562,35 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     //results_all_messages_from_conversation.prettyPrint();
 
     std::cout << " - Importing " << results_all_messages_from_conversation.rows() << " messages into thread._id " << ttid << std::endl;
+
+    // hash and probe all attachment files of this conversation up front, in parallel
+    std::map<std::string, AttachmentMetadata> probed_attachments;
+    {
+      SqliteDB::QueryResults results_attachment_paths;
+      if (ddb.exec("WITH conversation_messages AS (SELECT json FROM messages WHERE conversationId = ?" + datewhereclause + ") "
+                   "SELECT DISTINCT path FROM ("
+                   "SELECT json_extract(attachment.value, '$.path') AS path FROM conversation_messages, json_each(conversation_messages.json, '$.attachments') AS attachment "
+                   "UNION ALL "
+                   "SELECT json_extract(json, '$.preview[0].image.path') FROM conversation_messages "
+                   "UNION ALL "
+                   "SELECT json_extract(json, '$.sticker.data.path') FROM conversation_messages"
+                   ") WHERE path IS NOT NULL AND path != ''",
+                   results_all_conversations.value(i, "id"), &results_attachment_paths))
+      {
+        std::vector<std::string> attachment_paths;
+        attachment_paths.reserve(results_attachment_paths.rows());
+        for (uint j = 0; j < results_attachment_paths.rows(); ++j)
+          attachment_paths.emplace_back(databasedir + "/attachments.noindex/" + results_attachment_paths.valueAsString(j, "path"));
+        std::vector<AttachmentMetadata> metadata = getAttachmentMetaData(attachment_paths);
+        for (uint j = 0; j < attachment_paths.size(); ++j)
+          probed_attachments.emplace(std::move(attachment_paths[j]), std::move(metadata[j]));
+      }
+    }
     for (uint j = 0; j < results_all_messages_from_conversation.rows(); ++j)
     {
+      if (++messages_processed % COMMIT_EVERY == 0)
+        d_database.commitBatch();
+
       std::string type = results_all_messages_from_conversation.valueAsString(j, "type");
       if (d_verbose) [[unlikely]] std::cout << "Message " << j + 1 << "/" << results_all_messages_from_conversation.rows() << ":" << (!type.empty() ? " '" + type + "'" : "") << std::endl;
 
@@ -561,6 +607,21 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
       long long int hasranges = results_all_messages_from_conversation.getValueAs<long long int>(j, "hasranges");
       bool issticker = results_all_messages_from_conversation.getValueAs<long long int>(j, "issticker");
 
+      // the message json is only parsed (once) when a field is needed that is not in the query above,
+      // all further lookups for this message read from the parsed tree
+      DTMessageJson msgjson;
+      bool msgjson_parsed = false;
+      auto getmsgjson = [&]() -> DTMessageJson const &
+      {
+        if (!msgjson_parsed)
+        {
+          msgjson_parsed = true;
+          if (!msgjson.load(ddb, rowid)) [[unlikely]]
+            std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to parse message json (rowid: " << rowid << ")" << std::endl;
+        }
+        return msgjson;
+      };
+
       // get address (needed in both mms and sms databases)
       // for 1-on-1 messages, address is conversation partner (with uuid 'person_or_group_id')
       // for group messages, incoming: address is person originating the message (sourceUuid)
@@ -584,9 +645,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         if (type == "profile-change")
         {
           if (!ddb.exec("SELECT " + d_dt_c_uuid + " AS uuid, e164 FROM conversations WHERE "
-                        "id IS (SELECT json_extract(json, '$.changedId') FROM messages WHERE rowid IS ?) OR "
-                        "e164 IS (SELECT json_extract(json, '$.changedId') FROM messages WHERE rowid IS ?)", // maybe id can be a phone number?
-                        {rowid, rowid}, &statusmsguuid))
+                        "id IS ? OR e164 IS ?", // maybe id can be a phone number?
+                        {getmsgjson().value("$.changedId"), getmsgjson().value("$.changedId")}, &statusmsguuid))
           {
             std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << " failed to get uuid for incoming group profile-change." << std::endl;
             // print some extra info
@@ -596,9 +656,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         else if (type == "keychange")
         {
           if (!ddb.exec("SELECT " + d_dt_c_uuid + " AS uuid, e164 FROM conversations WHERE "
-                        + d_dt_c_uuid + " IS (SELECT json_extract(json, '$.key_changed') FROM messages WHERE rowid IS ?) OR "
-                        "e164 IS (SELECT json_extract(json, '$.key_changed') FROM messages WHERE rowid IS ?)",     // 'key_changed' can be a phone number (confirmed)
-                        {rowid, rowid}, &statusmsguuid))
+                        + d_dt_c_uuid + " IS ? OR e164 IS ?",     // 'key_changed' can be a phone number (confirmed)
+                        {getmsgjson().value("$.key_changed"), getmsgjson().value("$.key_changed")}, &statusmsguuid))
           {
             std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << " failed to get uuid for incoming group keychange." << std::endl;
             // print some extra info
@@ -608,9 +667,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         else if (type == "verified-change")
         {
           if (!ddb.exec("SELECT " + d_dt_c_uuid + " AS uuid, e164 FROM conversations WHERE "
-                        "id IS (SELECT json_extract(json, '$.verifiedChanged') FROM messages WHERE rowid IS ?) OR "
-                        "e164 IS (SELECT json_extract(json, '$.verifiedChanged') FROM messages WHERE rowid IS ?)",// maybe id can be a phone number?
-                        {rowid, rowid}, &statusmsguuid))
+                        "id IS ? OR e164 IS ?",// maybe id can be a phone number?
+                        {getmsgjson().value("$.verifiedChanged"), getmsgjson().value("$.verifiedChanged")}, &statusmsguuid))
           {
             std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << " failed to get uuid for incoming group verified-change." << std::endl;
             // print some extra info
@@ -663,14 +721,15 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
       if (type == "call-history")
       {
         if (d_verbose) [[unlikely]] std::cout << "Dealing with " << type << " message... " << std::flush;
-        handleDTCallTypeMessage(ddb, results_all_messages_from_conversation(j, "callId"), rowid, ttid, address, createmissingcontacts);
+        handleDTCallTypeMessage(ddb, getmsgjson(), results_all_messages_from_conversation(j, "callId"),
+                                results_all_messages_from_conversation.getValueAs<long long int>(j, "sent_at"), ttid, address, createmissingcontacts);
         if (d_verbose) [[unlikely]] std::cout << "done" << std::endl;
         continue;
       }
       else if (type == "group-v2-change")
       {
         //if (d_verbose) [[unlikely]] std::cout << "Dealing with " << type << " message... " << std::flush;
-        handleDTGroupChangeMessage(ddb, rowid, ttid, address, results_all_messages_from_conversation.valueAsInt(j, "sent_at"), &adjusted_timestamps, &recipientmap, false);
+        handleDTGroupChangeMessage(getmsgjson(), ttid, address, results_all_messages_from_conversation.valueAsInt(j, "sent_at"), &adjusted_timestamps, &recipientmap, false);
 
         warnOnce("Unsupported message type 'group-v2-change'. Skipping..."
                  " (this warning will be shown only once)");
@@ -688,7 +747,7 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         // std::cout << "Skipping message." << std::endl;
         // continue;
 
-        if (!handleDTGroupV1Migration(ddb, rowid, ttid,
+        if (!handleDTGroupV1Migration(ddb, getmsgjson(), ttid,
                                       results_all_messages_from_conversation.getValueAs<long long int>(j, "sent_at"),
                                       recipientid_for_thread, &recipientmap, createmissingcontacts, databasedir,
                                       &warned_createcontacts))
@@ -703,17 +762,17 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         if (isgroupconversation) // in groups these are groupv2updates (not handled (yet))
         {
           if (createmissingcontacts)
-            handleDTGroupChangeMessage(ddb, rowid, ttid, address, results_all_messages_from_conversation.valueAsInt(j, "sent_at"), &adjusted_timestamps, &recipientmap, true);
+            handleDTGroupChangeMessage(getmsgjson(), ttid, address, results_all_messages_from_conversation.valueAsInt(j, "sent_at"), &adjusted_timestamps, &recipientmap, true);
           else
           {
             warnOnce("Unsupported message type 'timer-notification (in group)'. Skipping... "
                      "(this warning will be shown only once)");
-            //handleDTGroupChangeMessage(ddb, rowid, ttid, address, true);
+            //handleDTGroupChangeMessage(getmsgjson(), ttid, address, true);
           }
           continue;
         }
 
-        if (!handleDTExpirationChangeMessage(ddb, rowid, ttid,
+        if (!handleDTExpirationChangeMessage(ddb, getmsgjson(), ttid,
                                              results_all_messages_from_conversation.getValueAs<long long int>(j, "sent_at"),
                                              address))
           return false;
@@ -913,11 +972,7 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
       else if (type == "verified-change")
       {
         if (d_verbose) [[unlikely]] std::cout << "Dealing with " << type << " message... " << std::flush;
-        SqliteDB::QueryResults identityverification_results;
-        if (!ddb.exec("SELECT "
-                      "json_extract(json, '$.local') AS 'local', "
-                      "json_extract(json, '$.verified') AS 'verified' "
-                      "FROM messages WHERE rowid = ?", rowid, &identityverification_results))
+        if (getmsgjson().tree.empty())
         {
            std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": failed to query verified-change data. Skipping message" << std::endl;
            continue;
@@ -926,8 +981,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         // if local == false, it would be an incoming message on Android and
         // marked as 'You marked your safety number with CONTACT verified from another device'
         // instead of just 'You marked your safety number with CONTACT verified'
-        [[maybe_unused]] bool local = identityverification_results.getValueAs<long long int>(0, "local") == 0 ? false : true;
-        bool verified = identityverification_results.getValueAs<long long int>(0, "verified") == 0 ? false : true;
+        [[maybe_unused]] bool local = getmsgjson().valueAsInt("$.local", 0) == 0 ? false : true;
+        bool verified = getmsgjson().valueAsInt("$.verified", 0) == 0 ? false : true;
 
         // not sure if I should do anythng with local... the desktop may have been 'another device', but
         // who's to say what this android backup we're importing into is...
@@ -1000,21 +1055,15 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
       else if (type == "profile-change")
       {
         if (d_verbose) [[unlikely]] std::cout << "Dealing with " << type << " message... " << std::flush;
-        SqliteDB::QueryResults profilechange_data;
-        if (!ddb.exec("SELECT "
-                      "json_extract(json, '$.profileChange.type') AS type, "
-                      "IFNULL(json_extract(json, '$.profileChange.oldName'), '') AS old_name, "
-                      "IFNULL(json_extract(json, '$.profileChange.newName'), '') AS new_name "
-                      "FROM messages WHERE rowid = ?", rowid, &profilechange_data))
+        if (getmsgjson().tree.empty())
         {
            std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": failed to query profile change data. Skipping message" << std::endl;
            continue;
         }
-        //profilechange_data.prettyPrint();
-        if (profilechange_data.valueAsString(0, "type") != "name")
+        if (getmsgjson().valueAsString("$.profileChange.type") != "name")
         {
           std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": Unsupported message type 'profile-change' (change type: "
-                    << profilechange_data.valueAsString(0, "type") << ". Skipping message" << std::endl;
+                    << getmsgjson().valueAsString("$.profileChange.type") << ". Skipping message" << std::endl;
           continue;
         }
         /*
@@ -1027,8 +1076,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
             StringChange profileNameChange = 1;
           }
         */
-        std::string previousname = profilechange_data.valueAsString(0, "old_name");
-        std::string newname = profilechange_data.valueAsString(0, "new_name");
+        std::string previousname = getmsgjson().valueAsString("$.profileChange.oldName");
+        std::string newname = getmsgjson().valueAsString("$.profileChange.newName");
 
         // subobject namechange:
         ProtoBufParser<protobuffer::optional::STRING,
@@ -1136,7 +1185,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
       // get emoji reactions
       if (d_verbose) [[unlikely]] std::cout << "Handling reactions..." << std::flush;
       std::vector<std::vector<std::string>> reactions;
-      getDTReactions(ddb, rowid, numreactions, &reactions);
+      if (numreactions)
+        getDTReactions(ddb, getmsgjson(), &reactions);
       if (d_verbose) [[unlikely]] std::cout << "done" << std::endl;
 
       // insert the collected data in the correct tables
@@ -1158,35 +1208,22 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
           if (d_verbose) [[unlikely]] std::cout << "Gathering quote data..." << std::flush;
 
           //std::cout << "  Message has quote" << std::endl;
-          SqliteDB::QueryResults quote_results;
-          if (!ddb.exec("SELECT "
-                        "json_extract(messages.json, '$.quote.id') AS quote_id,"
-                        "json_extract(messages.json, '$.quote.author') AS quote_author_phone,"     // in old databases, authorUuid does not exist, but this holds the phone number
-                        "conversations." + d_dt_c_uuid + " AS quote_author_uuid_from_phone,"       // this is filled from a left join on the possible phone number above
-                        "LOWER(json_extract(messages.json, '$.quote.authorAci')) AS quote_author_aci," // in newer databases, this replaces the 'authorUuid'
-                        "LOWER(json_extract(messages.json, '$.quote.authorUuid')) AS quote_author_uuid,"
-                        "json_extract(messages.json, '$.quote.text') AS quote_text,"
-                        "IFNULL(json_array_length(messages.json, '$.quote.attachments'), 0) AS num_quote_attachments,"
-                        "IFNULL(json_array_length(messages.json, '$.quote.bodyRanges'), 0) AS num_quote_bodyranges,"
-                        "IFNULL(json_extract(messages.json, '$.quote.type'), 0) AS quote_type,"
-                        "IFNULL(json_extract(messages.json, '$.quote.referencedMessageNotFound'), 0) AS quote_referencedmessagenotfound,"
-                        "IFNULL(json_extract(messages.json, '$.quote.isGiftBadge'), 0) AS quote_isgiftbadge,"  // if null because it probably does not exist in older databases
-                        "IFNULL(json_extract(messages.json, '$.quote.isViewOnce'), 0) AS quote_isviewonce"
-                        " FROM messages "
-                        "LEFT JOIN conversations ON json_extract(messages.json, '$.quote.author') = conversations.e164 "
-                        "WHERE messages.rowid = ?", rowid, &quote_results))
+          DTMessageJson const &quote_json = getmsgjson();
+          if (quote_json.tree.empty())
           {
             std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Quote error msg" << std::endl;
           }
 
           // try to set quote author from uuid or phone
-          mmsquote_author_uuid = quote_results.valueAsString(0, "quote_author_aci");
+          mmsquote_author_uuid = bepaald::toLower(quote_json.valueAsString("$.quote.authorAci")); // in newer databases, this replaces the 'authorUuid'
           if (mmsquote_author_uuid.empty()) // possibly older database, try authorUuid
-            mmsquote_author_uuid = quote_results.valueAsString(0, "quote_author_uuid");
-          if (mmsquote_author_uuid.empty()) // possibly old database, try conversations.uuid
-            mmsquote_author_uuid = quote_results.valueAsString(0, "quote_author_uuid_from_phone");
+            mmsquote_author_uuid = bepaald::toLower(quote_json.valueAsString("$.quote.authorUuid"));
+          if (mmsquote_author_uuid.empty() && !quote_json.isNull("$.quote.author")) // possibly old database, try conversations.uuid
+            // in old databases, authorUuid does not exist, but 'author' holds the phone number
+            mmsquote_author_uuid = ddb.getSingleResultAs<std::string>("SELECT " + d_dt_c_uuid + " FROM conversations WHERE e164 = ? LIMIT 1",
+                                                                      quote_json.value("$.quote.author"), std::string());
           if (mmsquote_author_uuid.empty()) // failed to get uuid from desktopdatabase, try matching on phone number
-            mmsquote_author = getRecipientIdFromPhone(quote_results.valueAsString(0, "quote_author_phone"), &recipientmap, createmissingcontacts);
+            mmsquote_author = getRecipientIdFromPhone(quote_json.valueAsString("$.quote.author"), &recipientmap, createmissingcontacts);
           else
             mmsquote_author = getRecipientIdFromUuid(mmsquote_author_uuid, &recipientmap, createmissingcontacts);
           if (mmsquote_author == -1)
@@ -1199,18 +1236,19 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
             hasquote = false;
           }
 
-          mmsquote_body = quote_results.valueAsString(0, "quote_text"); // check if this can be null (if quote exists, dont think so)
-          mmsquote_missing = (quote_results.getValueAs<long long int>(0, "quote_referencedmessagenotfound") == false ? 0 : 1);
-          mmsquote_type = (quote_results.getValueAs<long long int>(0, "quote_isgiftbadge") == false ? 0 : 1);
-          if (quote_results.valueHasType<long long int>(0, "quote_id"))
-            mmsquote_id = quote_results.getValueAs<long long int>(0, "quote_id"); // this is the messages.json.$timestamp or messages.sent_at. In the android
+          mmsquote_body = quote_json.valueAsString("$.quote.text"); // check if this can be null (if quote exists, dont think so)
+          mmsquote_missing = (quote_json.valueAsInt("$.quote.referencedMessageNotFound", 0) == false ? 0 : 1);
+          mmsquote_type = (quote_json.valueAsInt("$.quote.isGiftBadge", 0) == false ? 0 : 1); // may not exist in older databases
+          if (quote_json.valueHasType<long long int>("$.quote.id"))
+            mmsquote_id = quote_json.valueAsInt("$.quote.id"); // this is the messages.json.$timestamp or messages.sent_at. In the android
                                                                                   // db, it should be mms.date, but this should be set by this import anyway
                                                                                   // *EDIT* since there is a unique constraint on mms.date, the quoted message's
                                                                                   // date may have been adjusted!!! This needs work
           else // type is string
-            mmsquote_id = bepaald::toNumber<long long int>(quote_results.valueAsString(0, "quote_id"));
+            mmsquote_id = bepaald::toNumber<long long int>(quote_json.valueAsString("$.quote.id"));
 
-          if (quote_results.getValueAs<long long int>(0, "num_quote_bodyranges") > 0)
+          std::vector<std::string> quote_bodyranges(quote_json.children("$.quote.bodyRanges"));
+          if (quote_bodyranges.size() > 0)
           {
             // HEX(quote_mentions) = 0A2A080A10011A2439333732323237332D373865332D343133362D383634302D633832363139363937313463
             // PROTOBUF
@@ -1255,38 +1293,29 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
             // }
 
             BodyRanges bodyrangelist;
-            for (uint qbr = 0; qbr < quote_results.getValueAs<long long int>(0, "num_quote_bodyranges"); ++qbr)
+            for (std::string const &qbr : quote_bodyranges)
             {
-              SqliteDB::QueryResults qbrres;
-              if (!ddb.exec("SELECT "
-                            "json_extract(json, '$.quote.bodyRanges[" + bepaald::toString(qbr) + "].start') AS qbr_start,"
-                            "json_extract(json, '$.quote.bodyRanges[" + bepaald::toString(qbr) + "].length') AS qbr_length,"
-                            "json_extract(json, '$.quote.bodyRanges[" + bepaald::toString(qbr) + "].style') AS qbr_style,"
-                            "LOWER(COALESCE(json_extract(json, '$.quote.bodyRanges[" + bepaald::toString(qbr) + "].mentionAci'), json_extract(json, '$.quote.bodyRanges[" + bepaald::toString(qbr) + "].mentionUuid'))) AS qbr_uuid"
-                            " FROM messages WHERE rowid = ?", rowid, &qbrres))
-              {
-                std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Retrieving quote bodyranges" << std::endl;
-                continue;
-              }
-              //qbrres.prettyPrint();
+              std::string qbr_uuid = bepaald::toLower(quote_json.isNull(qbr + ".mentionAci") ?
+                                                      quote_json.valueAsString(qbr + ".mentionUuid") :
+                                                      quote_json.valueAsString(qbr + ".mentionAci"));
 
 
               long long int rec_id = -1;
-              if (qbrres.isNull(0, "qbr_style"))
+              if (quote_json.isNull(qbr + ".style"))
               {
-                if (qbrres.isNull(0, "qbr_uuid")) [[unlikely]]
+                if (qbr_uuid.empty()) [[unlikely]]
                 {
                   std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << ": Quote-bodyrange contains no recipient and no style. Skipping." << std::endl;
-                  ddb.prettyPrint("SELECT json_extract(json, '$.quote.bodyRanges[" + bepaald::toString(qbr) + "] FROM messages WHERE rowid = ?", rowid);
+                  ddb.prettyPrint("SELECT json_extract(json, '" + qbr + "') FROM messages WHERE rowid = ?", rowid);
                   continue;
                 }
 
-                rec_id = getRecipientIdFromUuid(qbrres.valueAsString(0, "qbr_uuid"), &recipientmap, createmissingcontacts);
+                rec_id = getRecipientIdFromUuid(qbr_uuid, &recipientmap, createmissingcontacts);
                 if (rec_id == -1)
                 {
                   if (createmissingcontacts)
                   {
-                    if ((rec_id = dtCreateRecipient(ddb, qbrres.valueAsString(0, "qbr_uuid"), std::string(), std::string(),
+                    if ((rec_id = dtCreateRecipient(ddb, qbr_uuid, std::string(), std::string(),
                                                     databasedir, &recipientmap, &warned_createcontacts)) == -1)
                     {
                       std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << ": Failed to create recipient for quote-mention. Skipping." << std::endl;
@@ -1302,13 +1331,13 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
               }
 
               BodyRange bodyrange;
-              bodyrange.addField<1>(qbrres.getValueAs<long long int>(0, "qbr_start"));
-              bodyrange.addField<2>(qbrres.getValueAs<long long int>(0, "qbr_length"));
+              bodyrange.addField<1>(quote_json.valueAsInt(qbr + ".start", 0));
+              bodyrange.addField<2>(quote_json.valueAsInt(qbr + ".length", 0));
 
-              if (qbrres.isNull(0, "qbr_style"))
-                bodyrange.addField<3>(qbrres.valueAsString(0, "qbr_uuid"));
+              if (quote_json.isNull(qbr + ".style"))
+                bodyrange.addField<3>(qbr_uuid);
               else
-                bodyrange.addField<4>(qbrres.getValueAs<long long int>(0, "qbr_style") - 1); // NOTE desktop style enum starts at 1 (android at 0)
+                bodyrange.addField<4>(quote_json.valueAsInt(qbr + ".style") - 1); // NOTE desktop style enum starts at 1 (android at 0)
 
               bodyrangelist.addField<1>(bodyrange);
             }
@@ -1323,7 +1352,6 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
           }
           //"mms.quote_attachment,"// = -1 Always -1??
 
-          //quote_results.prettyPrint();
           if (d_verbose) [[unlikely]] std::cout << "done" << std::endl;
         }
 
@@ -1410,27 +1438,17 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         {
           //ddb.prettyPrint("SELECT json_extract(json, '$.bodyRanges') FROM messages WHERE rowid IS ?", rowid);
           BodyRanges bodyrangelist;
-          SqliteDB::QueryResults ranges_results;
-          for (uint r = 0; r < hasranges; ++r)
+          for (std::string const &r : getmsgjson().children("$.bodyRanges"))
           {
-            if (ddb.exec("SELECT "
-                         "json_extract(json, '$.bodyRanges[" + bepaald::toString(r) + "].start') AS range_start,"
-                         "json_extract(json, '$.bodyRanges[" + bepaald::toString(r) + "].length') AS range_length,"
-                         "json_extract(json, '$.bodyRanges[" + bepaald::toString(r) + "].style') AS range_style"
-                         " FROM messages WHERE rowid IS ?", rowid, &ranges_results))
-            {
-              if (ranges_results.isNull(0, "range_style"))
-                continue;
-
-              //ranges_results.prettyPrint();
+            if (getmsgjson().isNull(r + ".style"))
+              continue;
 
-              BodyRange bodyrange;
-              if (ranges_results.getValueAs<long long int>(0, "range_start") != 0)
-                bodyrange.addField<1>(ranges_results.getValueAs<long long int>(0, "range_start"));
-              bodyrange.addField<2>(ranges_results.getValueAs<long long int>(0, "range_length"));
-              bodyrange.addField<4>(ranges_results.getValueAs<long long int>(0, "range_style") - 1); // NOTE desktop style enum starts at 1 (android 0)
-              bodyrangelist.addField<1>(bodyrange);
-            }
+            BodyRange bodyrange;
+            if (getmsgjson().valueAsInt(r + ".start", 0) != 0)
+              bodyrange.addField<1>(getmsgjson().valueAsInt(r + ".start"));
+            bodyrange.addField<2>(getmsgjson().valueAsInt(r + ".length", 0));
+            bodyrange.addField<4>(getmsgjson().valueAsInt(r + ".style") - 1); // NOTE desktop style enum starts at 1 (android 0)
+            bodyrangelist.addField<1>(bodyrange);
           }
           if (bodyrangelist.size())
           {
@@ -1441,19 +1459,27 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
 
         // insert message attachments
         if (d_verbose) [[unlikely]] std::cout << "Inserting attachments..." << std::flush;
-        insertAttachments(new_mms_id, results_all_messages_from_conversation.getValueAs<long long int>(j, "sent_at"), numattachments, haspreview,
-                          rowid, ddb, "WHERE rowid = " + bepaald::toString(rowid), databasedir, false, issticker);
+        if (numattachments > 0 || haspreview > 0 || issticker) // (only then is the json needed)
+          insertAttachments(new_mms_id, results_all_messages_from_conversation.getValueAs<long long int>(j, "sent_at"), numattachments, haspreview,
+                            ddb, getmsgjson(), databasedir, false, issticker, &probed_attachments);
         if (hasquote && !mmsquote_missing)
         {
-          // insert quotes attachments
-          insertAttachments(new_mms_id, results_all_messages_from_conversation.getValueAs<long long int>(j, "sent_at"), -1, 0, rowid, ddb,
-                            //"WHERE (sent_at = " + bepaald::toString(mmsquote_id) + " AND sourceUuid = '" + mmsquote_author_uuid + "')", databasedir, true); // sourceUuid IS NULL if sent from desktop
-                            "WHERE sent_at = " + bepaald::toString(mmsquote_id), databasedir, true, false /*issticker, not in quotes right now, need to test that*/);
+          // insert quotes attachments, these are in the json of the quoted message
+          SqliteDB::QueryResults quoted_message;
+          DTMessageJson quoted_msgjson;
+          //if (ddb.exec("SELECT rowid FROM messages WHERE sent_at = ? AND sourceUuid = ?", {mmsquote_id, mmsquote_author_uuid}, &quoted_message) // sourceUuid IS NULL if sent from desktop
+          if (!ddb.exec("SELECT rowid FROM messages WHERE sent_at = ? LIMIT 1", mmsquote_id, &quoted_message) ||
+              quoted_message.rows() != 1 || !quoted_msgjson.load(ddb, quoted_message.getValueAs<long long int>(0, "rowid")))
+            std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": Failed to get attachments of quoted message. Skipping" << std::endl;
+          else
+            insertAttachments(new_mms_id, results_all_messages_from_conversation.getValueAs<long long int>(j, "sent_at"), -1, 0, ddb,
+                              quoted_msgjson, databasedir, true, false /*issticker, not in quotes right now, need to test that*/,
+                              &probed_attachments);
         }
         if (d_verbose) [[unlikely]] std::cout << "done" << std::endl;
 
         if (outgoing)
-          dtSetMessageDeliveryReceipts(ddb, rowid, &recipientmap, databasedir, createmissingcontacts,
+          dtSetMessageDeliveryReceipts(ddb, getmsgjson(), &recipientmap, databasedir, createmissingcontacts,
                                        new_mms_id, true/*mms*/, isgroupconversation, &warned_createcontacts);
 
         // insert into reactions
@@ -1463,31 +1489,22 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
 
         // insert into mentions
         if (d_verbose) [[unlikely]] std::cout << "Inserting mentions..." << std::flush;
-        for (uint k = 0; k < nummentions; ++k)
+        for (std::string const &k : getmsgjson().children("$.bodyRanges"))
         {
-          SqliteDB::QueryResults results_mentions;
-          if (!ddb.exec("SELECT "
-                        "json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].start') AS start,"
-                        "json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].length') AS length,"
-                        "LOWER(COALESCE(json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].mentionAci'), json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].mentionUuid'))) AS mention_uuid"
-                        " FROM messages WHERE rowid = ?", rowid, &results_mentions))
-          {
-            std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " Failed to retrieve mentions. Skipping." << std::endl;
-            continue;
-          }
-          //std::cout << "  Mention " << k + 1 << "/" << nummentions << std::endl;
-
           // NOTE Desktop uses the same bodyRanges field for styling {start,length,style} and mentions {start,length,mentionUuid}.
           // if this is a style, mentionUuid will not exist, and we should skip it.
-          if (results_mentions.isNull(0, "mention_uuid"))
+          std::string mention_uuid = bepaald::toLower(getmsgjson().isNull(k + ".mentionAci") ?
+                                                      getmsgjson().valueAsString(k + ".mentionUuid") :
+                                                      getmsgjson().valueAsString(k + ".mentionAci"));
+          if (mention_uuid.empty())
             continue;
 
-          long long int rec_id = getRecipientIdFromUuid(results_mentions.valueAsString(0, "mention_uuid"), &recipientmap, createmissingcontacts);
+          long long int rec_id = getRecipientIdFromUuid(mention_uuid, &recipientmap, createmissingcontacts);
           if (rec_id == -1)
           {
             if (createmissingcontacts)
             {
-              if ((rec_id = dtCreateRecipient(ddb, results_mentions("mention_uuid"), std::string(), std::string(), databasedir, &recipientmap, &warned_createcontacts)) == -1)
+              if ((rec_id = dtCreateRecipient(ddb, mention_uuid, std::string(), std::string(), databasedir, &recipientmap, &warned_createcontacts)) == -1)
               {
                 std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " Failed to create recipient for mention. Skipping." << std::endl;
                 continue;
@@ -1504,8 +1521,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
                          {{"thread_id", ttid},
                           {"message_id", new_mms_id},
                           {"recipient_id", rec_id},
-                          {"range_start", results_mentions.getValueAs<long long int>(0, "start")},
-                          {"range_length", results_mentions.getValueAs<long long int>(0, "length")}}))
+                          {"range_start", getmsgjson().value(k + ".start")},
+                          {"range_length", getmsgjson().value(k + ".length")}}))
           {
             std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Inserting into mention" << std::endl;
           }
@@ -1543,7 +1560,7 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
 
         // set delivery/read counts
         if (outgoing)
-          dtSetMessageDeliveryReceipts(ddb, rowid, &recipientmap, databasedir, createmissingcontacts,
+          dtSetMessageDeliveryReceipts(ddb, getmsgjson(), &recipientmap, databasedir, createmissingcontacts,
                                        new_sms_id, false/*mms*/, isgroupconversation, &warned_createcontacts);
 
         // insert into reactions
@@ -1552,6 +1569,13 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     }
     //updateThreadsEntries(ttid);
   }
+  importbatch.end();
+
+  double import_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - import_start).count();
+  std::cout << "Imported " << messages_processed << " messages in " << std::fixed << std::setprecision(2) << import_seconds << "s";
+  if (import_seconds > 0)
+    std::cout << " (" << std::setprecision(0) << messages_processed / import_seconds << " messages/s)";
+  std::cout << std::defaultfloat << std::setprecision(6) << std::endl;
 
   for (auto const &r : recipientmap)
   {
@@ -21,6 +21,8 @@
 
 bool SignalBackup::importThread(SignalBackup *source, long long int thread)
 {
+  PhaseStats::Scope phase("import thread");
+
   std::cout << __FUNCTION__ << " (" << thread << ")" << std::endl;
 
   if ((d_databaseversion >= 185 && source->d_databaseversion < 185) || // from/to_recipient_id
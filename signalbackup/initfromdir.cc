@@ -18,16 +18,30 @@
 */
 
 #include "signalbackup.ih"
+#include "mediastore.h"
 
-void SignalBackup::initFromDir(std::string const &inputdir, bool replaceattachments)
+void SignalBackup::initFromDir(std::string const &inputdir, bool replaceattachments, bool databaseinplace)
 {
+  PhaseStats::Scope phase("read backup");
 
   std::cout << "Opening from dir!" << std::endl;
 
   std::cout << "Reading database..." << std::endl;
-  SqliteDB database(inputdir + "/database.sqlite");
-  if (!SqliteDB::copyDb(database, d_database))
-    return;
+  if (databaseinplace) // d_database was opened (read-only) on the file directly
+  {
+    if (!d_database.ok())
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to open database '" << inputdir << "/database.sqlite'" << std::endl;
+      return;
+    }
+  }
+  else
+  {
+    PhaseStats::Scope sqlload("sql load");
+    SqliteDB database(inputdir + "/database.sqlite");
+    if (!SqliteDB::copyDb(database, d_database))
+      return;
+  }
 
   std::cout << "Reading HeaderFrame" << std::endl;
   if (!setFrameFromFile(&d_headerframe, inputdir + "/Header.sbf"))
@@ -80,154 +94,167 @@ void SignalBackup::initFromDir(std::string const &inputdir, bool replaceattachme
 
   //d_endframe->printInfo();
 
-  // avatars // NOTE, avatars are read in two passes to force correct order
-  if (!d_showprogress)
-    std::cout << "Reading AvatarFrames" << std::flush;
+  // list the directory once, the frame files are then parsed on the threadpool
+  std::vector<std::filesystem::path> avatarfiles;
+  std::vector<std::filesystem::path> attachmentfiles;
+  std::vector<std::filesystem::path> stickerfiles;
   std::error_code ec;
   std::filesystem::directory_iterator dirit(inputdir, ec);
-  std::vector<std::string> avatarfiles;
   if (ec)
   {
     std::cout << "Error iterating directory `" << inputdir << "' : " << ec.message() << std::endl;
     return;
   }
-  for (auto const &avatar : dirit) // put all Avatar_[...].sbf files in vector:
-    if (avatar.path().extension() == ".sbf" && STRING_STARTS_WITH(avatar.path().filename().string(), "Avatar_"))
-      avatarfiles.push_back(avatar.path().string());
+  for (auto const &entry : dirit)
+  {
+    if (entry.path().extension() != ".sbf")
+      continue;
+    std::string filename = entry.path().filename().string();
+    if (STRING_STARTS_WITH(filename, "Attachment_"))
+      attachmentfiles.push_back(entry.path());
+    else if (STRING_STARTS_WITH(filename, "Avatar_"))
+      avatarfiles.push_back(entry.path());
+    else if (STRING_STARTS_WITH(filename, "Sticker_"))
+      stickerfiles.push_back(entry.path());
+  }
 
+  // runs parse(i) for all i in [0, count), in contiguous slices on the threadpool
+  ThreadPool pool;
+  auto parseall = [&pool](size_t count, auto const &parse) -> bool
+  {
+    size_t const slices = std::min<size_t>(count, 4 * pool.size());
+    std::vector<std::future<bool>> results;
+    results.reserve(slices);
+    for (size_t s = 0; s < slices; ++s)
+      results.emplace_back(pool.submit([&parse, begin = count * s / slices, end = count * (s + 1) / slices]()
+      {
+        for (size_t i = begin; i < end; ++i)
+          if (!parse(i))
+            return false;
+        return true;
+      }));
+    bool ok = true;
+    for (auto &r : results)
+      ok = r.get() && ok;
+    return ok;
+  };
+
+  // avatars // NOTE, sorted to force correct order
+  std::cout << "Reading AvatarFrames" << std::endl;
   std::sort(avatarfiles.begin(), avatarfiles.end());
-
-#if __cplusplus > 201703L
-  for (unsigned int i = 0; auto const &file : avatarfiles)
-#else
-  unsigned int i = 0;
-  for (auto const &file : avatarfiles)
-#endif
+  std::vector<std::unique_ptr<AvatarFrame>> avatars(avatarfiles.size());
+  if (!parseall(avatarfiles.size(), [&](size_t i)
   {
-    if (d_showprogress)
-    {
-      std::cout << "\33[2K\rReading AvatarFrames: " << ++i << "/" << avatarfiles.size() << std::flush;
-      if (i == avatarfiles.size())
-        std::cout << std::endl;
-    }
-
-    std::filesystem::path avatarframe(file);
-    std::filesystem::path avatarbin(file);
+    std::filesystem::path avatarbin(avatarfiles[i]);
     avatarbin.replace_extension(".bin");
-
-    std::unique_ptr<AvatarFrame> temp;
-    if (!setFrameFromFile(&temp, avatarframe.string()))
-      return;
-    if (!temp->setAttachmentData(avatarbin.string()))
-      return;
-
-    //temp->printInfo();
-
-    std::string name = (d_databaseversion < 33) ? temp->name() : temp->recipient();
-
-    d_avatars.emplace_back(name, temp.release());
+    return setFrameFromFile(&avatars[i], avatarfiles[i].string()) &&
+      avatars[i]->setAttachmentData(avatarbin.string());
+  }))
+    return;
+  for (auto &avatar : avatars)
+  {
+    std::string name = (d_databaseversion < 33) ? avatar->name() : avatar->recipient();
+    d_avatars.emplace_back(name, avatar.release());
   }
 
   std::cout << "Reading AttachmentFrames" << std::endl;
-  //attachments
-  dirit = std::filesystem::directory_iterator(inputdir, ec);
-  if (ec)
+  std::vector<std::unique_ptr<AttachmentFrame>> attachments(attachmentfiles.size());
+  if (!parseall(attachmentfiles.size(), [&](size_t i)
   {
-    std::cout << "Error iterating directory `" << inputdir << "' : " << ec.message() << std::endl;
-    return;
-  }
-  int replaced_count = 0;
-  for (auto const &att : dirit)
-  {
-    if (att.path().extension() != ".sbf" || !STRING_STARTS_WITH(att.path().filename().string(), "Attachment_"))
-      continue;
-
-    std::filesystem::path attframe = att.path();
-    std::filesystem::path attbin = att.path();
+    std::filesystem::path attbin = attachmentfiles[i];
     attbin.replace_extension(".bin");
 
-    bool replaced_attachement = false;
-    if (replaceattachments)
+    // exported with --dedupmedia, the '.ref' file holds the hash of the data in the media store
+    if (!bepaald::fileOrDirExists(attbin))
     {
-      attbin.replace_extension(".new");
-      if (bepaald::fileOrDirExists(attbin))
-        replaced_attachement = true;
-      else
-        attbin.replace_extension(".bin");
+      std::filesystem::path attref = attachmentfiles[i];
+      attref.replace_extension(".ref");
+      std::ifstream refstream(attref, std::ios_base::binary);
+      std::string hash;
+      if (refstream >> hash && hash.size() == 64 &&
+          std::all_of(hash.begin(), hash.end(), [](char c) { return std::isxdigit(static_cast<unsigned char>(c)); }))
+        attbin = std::filesystem::path(inputdir) / MediaStore::s_dirname / (hash + ".bin");
     }
 
-    std::unique_ptr<AttachmentFrame> temp;
-    if (!setFrameFromFile(&temp, attframe.string()))
-      return;
-
-    //if (!temp->setAttachmentData(attbin.string()))
-    //  return;
-    temp->setLazyDataRAW(temp->length(), attbin.string());
+    if (!setFrameFromFile(&attachments[i], attachmentfiles[i].string()))
+      return false;
+    //if (!attachments[i]->setAttachmentData(attbin.string()))
+    //  return false;
+    attachments[i]->setLazyDataRAW(attachments[i]->length(), attbin.string());
+    return true;
+  }))
+    return;
 
-    if (replaced_attachement)
+  // replacing touches the database, this is done after parsing (the new files are probed in parallel)
+  int replaced_count = 0;
+  if (replaceattachments)
+  {
+    std::vector<uint> replaceidx;
+    std::vector<std::string> newfiles;
+    for (uint i = 0; i < attachmentfiles.size(); ++i)
     {
-      AttachmentMetadata amd = getAttachmentMetaData(attbin.string());
+      std::filesystem::path attnew = attachmentfiles[i];
+      attnew.replace_extension(".new");
+      if (bepaald::fileOrDirExists(attnew))
+      {
+        replaceidx.push_back(i);
+        newfiles.push_back(attnew.string());
+      }
+    }
+    std::vector<AttachmentMetadata> newmetadata = getAttachmentMetaData(newfiles);
 
-      if (!amd) // undo the replacement
+    for (uint j = 0; j < replaceidx.size(); ++j)
+    {
+      AttachmentMetadata const &amd = newmetadata[j];
+      if (!amd)
       {
-        std::cout << "Failed to get metadata on new attachment: " << attbin << std::endl;
-        attbin.replace_extension(".bin");
-        //if (!temp->setAttachmentData(attbin.string()))
-        //  return;
-        temp->setLazyDataRAW(temp->length(), attbin.string());
+        std::cout << "Failed to get metadata on new attachment: " << newfiles[j] << std::endl;
+        continue;
       }
-      else
+
+      // update database
+      AttachmentFrame *a = attachments[replaceidx[j]].get();
+      if (!updatePartTableForReplace(amd, a->rowId()))
       {
-        // update database
-        if (!updatePartTableForReplace(amd, temp->rowId()))
-        {
-          std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off
-                    << ": Failed to insert new attachment into database" << std::endl;
-          return;
-        }
-
-        // set correct size on AttachmentFrame
-        temp->setLength(amd.filesize);
-
-        ++replaced_count;
+        std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off
+                  << ": Failed to insert new attachment into database" << std::endl;
+        return;
       }
-    }
 
-    uint64_t rowid = temp->rowId();
-    uint64_t attachmentid = temp->attachmentId();
-    d_attachments.emplace(std::make_pair(rowid, attachmentid), temp.release());
+      // set correct size on AttachmentFrame, and read the data from the new file
+      a->setLength(amd.filesize);
+      a->setLazyDataRAW(amd.filesize, newfiles[j]);
 
-    MEMINFO("ADDED ATTACHMENT");
+      ++replaced_count;
+    }
+  }
+
+  d_attachments.reserve(d_attachments.size() + attachments.size());
+  for (auto &attachment : attachments)
+  {
+    uint64_t rowid = attachment->rowId();
+    uint64_t attachmentid = attachment->attachmentId();
+    d_attachments.emplace(std::make_pair(rowid, attachmentid), attachment.release());
   }
+  MEMINFO("ADDED ATTACHMENTS");
 
   if (replaced_count)
     std::cout << " - Replaced " << replaced_count << " attachments" << std::endl;
 
   std::cout << "Reading StickerFrames" << std::endl;
-  //stickers
-  dirit = std::filesystem::directory_iterator(inputdir, ec);
-  if (ec)
+  std::vector<std::unique_ptr<StickerFrame>> stickers(stickerfiles.size());
+  if (!parseall(stickerfiles.size(), [&](size_t i)
   {
-    std::cout << "Error iterating directory `" << inputdir << "' : " << ec.message() << std::endl;
+    std::filesystem::path stickerbin(stickerfiles[i]);
+    stickerbin.replace_extension(".bin");
+    return setFrameFromFile(&stickers[i], stickerfiles[i].string()) &&
+      stickers[i]->setAttachmentData(stickerbin.string());
+  }))
     return;
-  }
-  for (auto const &sticker : dirit)
+  for (auto &sticker : stickers)
   {
-    if (sticker.path().extension() != ".sbf" || sticker.path().filename().string().substr(0, STRLEN("Sticker_")) != "Sticker_")
-      continue;
-
-    std::filesystem::path stickerframe = sticker.path();
-    std::filesystem::path stickerbin = sticker.path();
-    stickerbin.replace_extension(".bin");
-
-    std::unique_ptr<StickerFrame> temp;
-    if (!setFrameFromFile(&temp, stickerframe.string()))
-      return;
-    if (!temp->setAttachmentData(stickerbin.string()))
-      return;
-
-    uint64_t rowid = temp->rowId();
-    d_stickers.emplace(std::make_pair(rowid, temp.release()));
+    uint64_t rowid = sticker->rowId();
+    d_stickers.emplace(std::make_pair(rowid, sticker.release()));
   }
 
 #ifdef BUILT_FOR_TESTING
@@ -21,6 +21,8 @@
 
 void SignalBackup::initFromFile()
 {
+  PhaseStats::Scope phase("read backup");
+
   if (!d_fd->ok())
   {
     std::cout << "Failed to create filedecrypter" << std::endl;
@@ -86,8 +88,11 @@ void SignalBackup::initFromFile()
         // we lazily do not check for them here, since we are dealing with official exported files which do not contain
         // these tables as they are excluded on the export-side as well. Additionally, the official import should be able
         // to properly deal with them anyway (that is: ignore them)
+        PhaseStats::Scope sqlload("sql load");
         if (!d_database.exec(s->bindStatement(), s->parameters()))
           std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to execute statement: " << s->statement() << std::endl;
+        else
+          sqlload.addItems(1);
       }
       #ifdef BUILT_FOR_TESTING
       else if (s->statement().find("CREATE TABLE sqlite_sequence") != std::string::npos)
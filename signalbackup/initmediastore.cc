@@ -0,0 +1,48 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+#include "mediastore.h"
+
+bool SignalBackup::initMediaStore(std::string const &directory, MediaStore *mediastore) const
+{
+  mediastore->directory = directory + "/" + MediaStore::s_dirname;
+  if (!bepaald::fileOrDirExists(mediastore->directory))
+  {
+    if (!bepaald::createDir(mediastore->directory))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": failed to create directory `" << mediastore->directory << "'" << std::endl;
+      return false;
+    }
+  }
+  else if (!bepaald::isDir(mediastore->directory))
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+              << ": failed to create directory `" << mediastore->directory << "'" << std::endl;
+    return false;
+  }
+
+  // newer databases have the hash of the (possibly transformed) attachment in data_hash_end
+  if (d_database.tableContainsColumn("part", "data_hash_end"))
+    mediastore->datahashcolumn = "data_hash_end";
+  else if (d_database.tableContainsColumn("part", "data_hash"))
+    mediastore->datahashcolumn = "data_hash";
+  return true;
+}
@@ -18,27 +18,23 @@
 */
 
 #include "signalbackup.ih"
+#include "dtmessagejson.h"
 
+// msgjson is the (parsed) json of the desktop message holding the attachments, for quotes this is the quoted message
 bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_id, int numattachments, long long int haspreview,
-                                     long long int rowid, SqliteDB const &ddb, std::string const &where, std::string const &databasedir,
-                                     bool isquote, bool issticker)
+                                     SqliteDB const &ddb, DTMessageJson const &msgjson, std::string const &databasedir,
+                                     bool isquote, bool issticker, std::map<std::string, AttachmentMetadata> const *probed)
 {
+  Trace::Span span("SignalBackup::insertAttachments");
+
   bool quoted_linkpreview = false;
   if (numattachments == -1 && isquote) // quote attachments, number not known yet
   {
-    SqliteDB::QueryResults res;
-    if (!ddb.exec("SELECT IFNULL(json_array_length(json, '$.attachments'), 0) AS numattachments FROM messages " + where, &res) ||
-        (res.rows() != 1 && res.columns() != 1))
-    {
-      std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": Failed to get number of attachments in quoted message. Skipping" << std::endl;
-      return false;
-    }
-    numattachments = res.getValueAs<long long int>(0, "numattachments");
+    numattachments = msgjson.arrayLength("$.attachments");
 
     if (numattachments == 0)
     {
-      if (ddb.exec("SELECT json_extract(json, '$.preview[0].image.path') IS NOT NULL AS quoteispreview FROM messages " + where, &res) &&
-          res.rows() == 1 && res.getValueAs<long long int>(0, "quoteispreview") != 0)
+      if (!msgjson.isNull("$.preview[0].image.path"))
       {
         quoted_linkpreview = true;
         numattachments = 1;
@@ -58,72 +54,48 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
   //if (numattachments)
   //  std::cout << "  " << numattachments << " attachments" << (isquote ? " (in quote)" : "") << std::endl;
 
-  SqliteDB::QueryResults results_attachment_data;
   for (int k = 0; k < numattachments; ++k)
   {
     //std::cout << "  Attachment " << k + 1 << "/" << numattachments << ": " << std::flush;
 
     std::string jsonpath = "$.attachments[" + bepaald::toString(k) + "]";
 
-    SqliteDB::QueryResults linkpreview_results;
     if (haspreview)
-    {
       jsonpath = "$.preview[0].image";
-      ddb.exec("SELECT "
-               "json_extract(json, '$.preview[0].url') AS url,"
-               "json_extract(json, '$.preview[0].title') AS title,"
-               "json_extract(json, '$.preview[0].description') AS description,"
-               "json_extract(json, '$.preview[0].image') AS image"
-               " FROM messages WHERE rowid = ?",
-               rowid, &linkpreview_results);
-    }
     if (issticker)
       jsonpath = "$.sticker.data";
 
     if (quoted_linkpreview)
       jsonpath = "$.preview[0].image";
 
-    if (!ddb.exec("SELECT "
-                  "json_extract(json, '" + jsonpath + ".path') AS path,"
-                  "json_extract(json, '" + jsonpath + ".contentType') AS content_type,"
-                  "json_extract(json, '" + jsonpath + ".size') AS size,"
-                  //"json_extract(json, '" + jsonpath + ".cdnKey') AS cdn_key,"
-
-                  // only in sticker
-                  "json_extract(json, '" + jsonpath + ".emoji') AS sticker_emoji,"
-                  "json_extract(json, '" + jsonpath + ".packId') AS sticker_packid,"
-                  "json_extract(json, '" + jsonpath + ".id') AS sticker_id,"
-
-                  // not when sticker
-                  "json_extract(json, '" + jsonpath + ".fileName') AS file_name,"
-                  "IFNULL(json_extract(json, '" + jsonpath + ".uploadTimestamp'), 0) AS upload_timestamp,"
-                  "IFNULL(json_extract(json, '" + jsonpath + ".flags'), 0) AS flags," // currently, the only flag implemented in Signal is:  VOICE_NOTE = 1
-                  "IFNULL(json_extract(json, '" + jsonpath + ".pending'), 0) AS pending,"
-                  "IFNULL(json_extract(json, '" + jsonpath + ".cdnNumber'), 0) AS cdn_number"
-
-                  " FROM messages " + where, &results_attachment_data))
+    std::string const path = msgjson.valueAsString(jsonpath + ".path");
+    std::any const content_type = msgjson.value(jsonpath + ".contentType");
+    std::any const size = msgjson.value(jsonpath + ".size");
+    //std::any const cdn_key = msgjson.value(jsonpath + ".cdnKey");
+    // not when sticker
+    std::any const file_name = msgjson.value(jsonpath + ".fileName");
+    long long int const upload_timestamp = msgjson.valueAsInt(jsonpath + ".uploadTimestamp", 0);
+    long long int const flags = msgjson.valueAsInt(jsonpath + ".flags", 0); // currently, the only flag implemented in Signal is:  VOICE_NOTE = 1
+    long long int const pending = msgjson.valueAsInt(jsonpath + ".pending", 0);
+    long long int const cdn_number = msgjson.valueAsInt(jsonpath + ".cdnNumber", 0);
+
+    if (path.empty())
     {
-      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to get attachment data from desktop database" << std::endl;
-      continue;
-    }
-
-    if (results_attachment_data.valueAsString(0, "path").empty())
-    {
-      if (results_attachment_data.getValueAs<long long int>(0, "pending") != 0)
+      if (pending != 0)
       {
         if (!insertRow("part",
                        {{"mid", mms_id},
-                        {"ct", results_attachment_data.value(0, "content_type")},
+                        {"ct", content_type},
                         {"pending_push", 2},
-                        {"data_size", results_attachment_data.value(0, "size")},
-                        {"file_name", results_attachment_data.value(0, "file_name")},
+                        {"data_size", size},
+                        {"file_name", file_name},
                         {"unique_id", unique_id},
-                        {"voice_note", results_attachment_data.isNull(0, "flags") ? 0 : (results_attachment_data.getValueAs<long long int>(0, "flags") == 1 ? 1 : 0)},
+                        {"voice_note", flags == 1 ? 1 : 0},
                         {"width", 0},
                         {"height", 0},
                         {"quote", isquote ? 1 : 0},
-                        {"upload_timestamp", results_attachment_data.value(0, "upload_timestamp")},
-                        {"cdn_number", results_attachment_data.value(0, "cdn_number")}},
+                        {"upload_timestamp", upload_timestamp},
+                        {"cdn_number", cdn_number}},
                        "_id"))
         {
           std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Inserting part-data (pending)" << std::endl;
@@ -136,7 +108,7 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
         //          << ": Attachment not found." << std::endl;
       }
 
-      if (haspreview && linkpreview_results.rows())
+      if (haspreview)
       {
         // this work, but just for consistency, I'd like to escape the string as Signal does for some reason
         //d_database.exec("UPDATE " + d_mms_table + " SET link_previews = json_array(json_object('url', ?, 'title', ?, 'description', ?, 'date', 0, 'attachmentId', NULL)) WHERE _id = ?",
@@ -157,7 +129,7 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
 
           NOTE backslash needs to be done first, or the backslashes inserted by other escapes are escaped...
         */
-        std::string url = linkpreview_results("url");
+        std::string url = msgjson.valueAsString("$.preview[0].url");
         bepaald::replaceAll(&url, '\\', R"(\\)");
         //bepaald::replaceAll(&url, "'", R"(\')");  // not done in db
         bepaald::replaceAll(&url, '/', R"(\/)");
@@ -168,7 +140,7 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
         bepaald::replaceAll(&url, '\b', R"(\b)");
         bepaald::replaceAll(&url, '\f', R"(\f)");
         bepaald::replaceAll(&url, '\r', R"(\r)");
-        std::string title = linkpreview_results("title");
+        std::string title = msgjson.valueAsString("$.preview[0].title");
         bepaald::replaceAll(&title, '\\', R"(\\)");
         bepaald::replaceAll(&title, '/', R"(\/)");
         bepaald::replaceAll(&title, '\"', R"(\")");
@@ -178,7 +150,7 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
         bepaald::replaceAll(&title, '\b', R"(\b)");
         bepaald::replaceAll(&title, '\f', R"(\f)");
         bepaald::replaceAll(&title, '\r', R"(\r)");
-        std::string description = linkpreview_results("description");
+        std::string description = msgjson.valueAsString("$.preview[0].description");
         bepaald::replaceAll(&description, '\\', R"(\\)");
         bepaald::replaceAll(&description, '/', R"(\/)");
         bepaald::replaceAll(&description, '\"', R"(\")");
@@ -209,22 +181,24 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
       continue;
     }
 
-    AttachmentMetadata amd = getAttachmentMetaData(databasedir + "/attachments.noindex/" + results_attachment_data.valueAsString(0, "path"));
+    // use the metadata if the file was already probed (in bulk), probe it now otherwise
+    std::string attachmentpath = databasedir + "/attachments.noindex/" + path;
+    AttachmentMetadata amd = (probed && probed->contains(attachmentpath)) ? probed->at(attachmentpath) : getAttachmentMetaData(attachmentpath);
     // PROBABLY JUST NOT AN IMAGE, WE STILL WANT THE HASH
     // if (!amd)
     // {
     //   std::cout << "Failed to get metadata on new attachment: "
-    //             << databasedir << "/attachments.noindex/" << results_attachment_data.valueAsString(0, "path") << std::endl;
+    //             << databasedir << "/attachments.noindex/" << path << std::endl;
     // }
 
-    // attachmentdata.emplace_back(getAttachmentMetaData(configdir + "/attachments.noindex/" + results_attachment_data.valueAsString(0, "path")));
+    // attachmentdata.emplace_back(getAttachmentMetaData(configdir + "/attachments.noindex/" + path));
     // if (!results_attachment_data.isNull(0, "file_name"))
     //   attachmentdata.back().filename = results_attachment_data.valueAsString(0, "file_name");
 
-    if (amd.filename.empty() || (amd.filesize == 0 && results_attachment_data.getValueAs<long long int>(0, "size") != 0))
+    if (amd.filename.empty() || (amd.filesize == 0 && msgjson.valueAsInt(jsonpath + ".size", 0) != 0))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Trying to set attachment data. Skipping." << std::endl;
-      std::cout << "Pending: " << results_attachment_data.getValueAs<long long int>(0, "pending") << std::endl;
+      std::cout << "Pending: " << pending << std::endl;
       //results_attachment_data.prettyPrint();
       //std::cout << amd.filesize << std::endl;
 
@@ -237,18 +211,18 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
     std::any retval;
     if (!insertRow("part",
                    {{"mid", mms_id},
-                    {"ct", results_attachment_data.value(0, "content_type")},
+                    {"ct", content_type},
                     {"pending_push", 0},
-                    {"data_size", results_attachment_data.value(0, "size")},
+                    {"data_size", size},
                     {"unique_id", unique_id},
-                    {"voice_note", results_attachment_data.isNull(0, "flags") ? 0 : (results_attachment_data.getValueAs<long long int>(0, "flags") == 1 ? 1 : 0)},
+                    {"voice_note", flags == 1 ? 1 : 0},
                     {"width", amd.width == -1 ? 0 : amd.width},
                     {"height", amd.height == -1 ? 0 : amd.height},
                     {"quote", isquote ? 1 : 0},
                     {"data_hash", amd.hash},
-                    {"upload_timestamp", results_attachment_data.value(0, "upload_timestamp")},      // will be 0 on sticker
-                    {"cdn_number", results_attachment_data.value(0, "cdn_number")}, // will be 0 on sticker, usually 0 or 2, but I dont know what it means
-                    {"file_name", results_attachment_data.value(0, "file_name")}},
+                    {"upload_timestamp", upload_timestamp},      // will be 0 on sticker
+                    {"cdn_number", cdn_number}, // will be 0 on sticker, usually 0 or 2, but I dont know what it means
+                    {"file_name", file_name}},
                    "_id", &retval))
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Inserting part-data" << std::endl;
@@ -259,61 +233,52 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
 
     if (issticker)
     {
-      // get the data from $.sticker (instead of $.sticker.data)
-      SqliteDB::QueryResults stickerdata;
-      if (ddb.exec("SELECT "
-                   "json_extract(json, '$.sticker.packKey') AS 'packkey',"
-                   "json_extract(json, '$.sticker.packId') AS 'packid',"
-                   "json_extract(json, '$.sticker.stickerId') AS 'stickerid',"
-                   "IFNULL(json_extract(json, '$.sticker.emoji'), '') AS 'emoji' "
-                   "FROM messages " + where, &stickerdata) &&
-          stickerdata.rows() == 1)
+      // gather the data from $.sticker (instead of $.sticker.data)
+      std::string sticker_emoji = msgjson.valueAsString("$.sticker.emoji");
+      std::string sticker_packid = msgjson.valueAsString("$.sticker.packId");
+      long long int sticker_id = -1;
+      if (msgjson.valueHasType<long long int>("$.sticker.stickerId"))
+        sticker_id = msgjson.valueAsInt("$.sticker.stickerId");
+      std::string sticker_packkey = msgjson.valueAsString("$.sticker.packKey");
+      if (!sticker_packkey.empty())
       {
-        // gather data
-        std::string sticker_emoji = stickerdata("emoji");
-        std::string sticker_packid = stickerdata("packid");
-        long long int sticker_id = -1;
-        if (stickerdata.valueHasType<long long int>(0, "stickerid"))
-          sticker_id = stickerdata.getValueAs<long long int>(0, "stickerid");
-        std::string sticker_packkey = stickerdata("packkey");
-        if (!sticker_packkey.empty())
+        auto [key, keysize] = Base64::base64StringToBytes(sticker_packkey);
+        if (key && keysize)
         {
-          auto [key, keysize] = Base64::base64StringToBytes(sticker_packkey);
-          if (key && keysize)
-          {
-            sticker_packkey = bepaald::bytesToHexString(key, keysize, true);
-            bepaald::destroyPtr(&key, &keysize);
-          }
+          sticker_packkey = bepaald::bytesToHexString(key, keysize, true);
+          bepaald::destroyPtr(&key, &keysize);
         }
+      }
 
-        // check data, emoji can be empty
-        if (sticker_packid.empty() || sticker_packkey.empty() || sticker_id == -1)
-          stickerdata.printLineMode();
-        else
-        {
-          if (d_database.exec("UPDATE part SET "
-                              "sticker_pack_id = ?, "
-                              "sticker_pack_key = ?, "
-                              "sticker_id = ?"
-                              " WHERE _id = ?",
-                              {sticker_packid,
-                               sticker_packkey,
-                               sticker_id,
-                               new_part_id}))
-            // set emoji if not empty
-            if (!sticker_emoji.empty())
-              d_database.exec("UPDATE part SET sticker_emoji = ? WHERE _id = ?", {sticker_emoji, new_part_id});
-        }
+      // check data, emoji can be empty
+      if (sticker_packid.empty() || sticker_packkey.empty() || sticker_id == -1)
+        std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": Incomplete sticker data (packkey: '"
+                  << msgjson.valueAsString("$.sticker.packKey") << "', packid: '" << sticker_packid << "', stickerid: '"
+                  << msgjson.valueAsString("$.sticker.stickerId") << "', emoji: '" << sticker_emoji << "')" << std::endl;
+      else
+      {
+        if (d_database.exec("UPDATE part SET "
+                            "sticker_pack_id = ?, "
+                            "sticker_pack_key = ?, "
+                            "sticker_id = ?"
+                            " WHERE _id = ?",
+                            {sticker_packid,
+                             sticker_packkey,
+                             sticker_id,
+                             new_part_id}))
+          // set emoji if not empty
+          if (!sticker_emoji.empty())
+            d_database.exec("UPDATE part SET sticker_emoji = ? WHERE _id = ?", {sticker_emoji, new_part_id});
       }
     }
 
-    if (haspreview && linkpreview_results.rows())
+    if (haspreview)
     {
       // this works, but I want to escape the string like Signal does
       //d_database.exec("UPDATE " + d_mms_table + " SET d_mms_previews = json_array(json_object('url', ?, 'title', ?, 'description', ?, 'date', 0, 'attachmentId', json_object('rowId', ?, 'uniqueId', ?, 'valid', true))) "
       //"WHERE _id = ?", {linkpreview_results.value(0, "url"), linkpreview_results.value(0, "title"), linkpreview_results.value(0, "description"), new_part_id, unique_id, mms_id});
 
-      std::string url = linkpreview_results("url");
+      std::string url = msgjson.valueAsString("$.preview[0].url");
       bepaald::replaceAll(&url, '\\', R"(\\)");
       bepaald::replaceAll(&url, '/', R"(\/)");
       bepaald::replaceAll(&url, '\"', R"(\")");
@@ -323,7 +288,7 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
       bepaald::replaceAll(&url, '\b', R"(\b)");
       bepaald::replaceAll(&url, '\f', R"(\f)");
       bepaald::replaceAll(&url, '\r', R"(\r)");
-      std::string title = linkpreview_results("title");
+      std::string title = msgjson.valueAsString("$.preview[0].title");
       bepaald::replaceAll(&title, '\\', R"(\\)");
       bepaald::replaceAll(&title, '/', R"(\/)");
       bepaald::replaceAll(&title, '\"', R"(\")");
@@ -333,7 +298,7 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
       bepaald::replaceAll(&title, '\b', R"(\b)");
       bepaald::replaceAll(&title, '\f', R"(\f)");
       bepaald::replaceAll(&title, '\r', R"(\r)");
-      std::string description = linkpreview_results("description");
+      std::string description = msgjson.valueAsString("$.preview[0].description");
       bepaald::replaceAll(&description, '\\', R"(\\)");
       bepaald::replaceAll(&description, '/', R"(\/)");
       bepaald::replaceAll(&description, '\"', R"(\")");
@@ -379,9 +344,9 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
     if (setFrameFromStrings(&new_attachment_frame, std::vector<std::string>{"ROWID:uint64:" + bepaald::toString(new_part_id),
                                                                             "ATTACHMENTID:uint64:" + bepaald::toString(unique_id),
                                                                             "LENGTH:uint32:" + bepaald::toString(amd.filesize)}))/* &&
-      new_attachment_frame->setAttachmentData(databasedir + "/attachments.noindex/" + results_attachment_data.valueAsString(0, "path")))*/
+      new_attachment_frame->setAttachmentData(databasedir + "/attachments.noindex/" + path))*/
     {
-      new_attachment_frame->setLazyDataRAW(amd.filesize, databasedir + "/attachments.noindex/" + results_attachment_data.valueAsString(0, "path"));
+      new_attachment_frame->setLazyDataRAW(amd.filesize, databasedir + "/attachments.noindex/" + path);
       d_attachments.emplace(std::make_pair(new_part_id, unique_id), new_attachment_frame.release());
     }
     else
@@ -390,7 +355,7 @@ bool SignalBackup::insertAttachments(long long int mms_id, long long int unique_
       std::cout << "       rowid       : " << new_part_id << std::endl;
       std::cout << "       attachmentid: " << unique_id << std::endl;
       std::cout << "       length      : " << amd.filesize << std::endl;
-      std::cout << "       path        : " << databasedir << "/attachments.noindex/" << results_attachment_data.valueAsString(0, "path") << std::endl;
+      std::cout << "       path        : " << databasedir << "/attachments.noindex/" << path << std::endl;
 
       // try to remove the inserted part entry:
       d_database.exec("DELETE FROM part WHERE _id = ?", new_part_id);
@@ -19,9 +19,12 @@
 
 #include "signalbackup.ih"
 
-bool SignalBackup::makeFilenameUnique(std::string const &path, std::string *file_or_dir) const
+// reserved (optional) holds full paths that are not on disk yet, but will be written later
+bool SignalBackup::makeFilenameUnique(std::string const &path, std::string *file_or_dir,
+                                      std::set<std::string> const *reserved) const
 {
-  while (bepaald::fileOrDirExists(path + "/" + *file_or_dir))
+  while (bepaald::fileOrDirExists(path + "/" + *file_or_dir) ||
+         (reserved && reserved->contains(path + "/" + *file_or_dir)))
   {
     //std::cout << std::endl << "File exists: " << path << "/" << file_or_dir << " -> ";
 
@@ -70,15 +70,7 @@ void SignalBackup::makeIdsUnique(long long int minthread, long long int minsms,
 
   setMinimumId("part", minpart);
   // update rowid's in attachments
-  std::map<std::pair<uint64_t, uint64_t>, std::unique_ptr<AttachmentFrame>> newattdb;
-  for (auto &att : d_attachments)
-  {
-    AttachmentFrame *a = reinterpret_cast<AttachmentFrame *>(att.second.release());
-    a->setRowId(a->rowId() + minpart);
-    newattdb.emplace(std::make_pair(a->rowId(), a->attachmentId()), a);
-  }
-  d_attachments.clear();
-  d_attachments = std::move(newattdb);
+  d_attachments.rekey([minpart](AttachmentFrame *a) { a->setRowId(a->rowId() + minpart); });
 
   // update rowid in previews (mms.previews contains a json string referencing the 'rowId' == part._id)
   SqliteDB::QueryResults results;
@@ -324,6 +316,8 @@ void SignalBackup::makeIdsUnique(long long int minthread, long long int minsms,
 
 void SignalBackup::makeIdsUnique(SignalBackup *source)
 {
+  PhaseStats::Scope phase("make ids unique");
+
   std::cout << __FUNCTION__ << std::endl;
 
   std::cout << "  Adjusting indexes in tables..." << std::endl;
@@ -381,15 +375,7 @@ void SignalBackup::makeIdsUnique(SignalBackup *source)
     if (dbl.table == "part")
     {
       // update rowid's in attachments
-      std::map<std::pair<uint64_t, uint64_t>, std::unique_ptr<AttachmentFrame>> newattdb;
-      for (auto &att : source->d_attachments)
-      {
-        AttachmentFrame *a = reinterpret_cast<AttachmentFrame *>(att.second.release());
-        a->setRowId(a->rowId() + offsetvalue);
-        newattdb.emplace(std::make_pair(a->rowId(), a->attachmentId()), a);
-      }
-      source->d_attachments.clear();
-      source->d_attachments = std::move(newattdb);
+      source->d_attachments.rekey([offsetvalue](AttachmentFrame *a) { a->setRowId(a->rowId() + offsetvalue); });
 
       /*
         REPLACED WITH JSON OPTION IN DatabaseConnections
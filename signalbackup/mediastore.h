@@ -0,0 +1,35 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.h"
+
+// Content-addressed storage for exported attachments (--dedupmedia). Every
+// distinct attachment is written once to `directory', named by the hex sha256
+// of its data. The actual exported files are hard links to (or, when that is
+// not supported, copies of) the stored file.
+struct MediaStore
+{
+  static constexpr char const *s_dirname = ".media";
+
+  std::string directory;
+  std::string datahashcolumn;                         // part-column with the attachment hash, if present in database
+  std::map<std::string, std::string> datahashfiles;   // maps part.data_hash to its file in directory
+  uint64_t stored = 0;                                // number of attachments written to the store
+  uint64_t duplicates = 0;                            // number of attachments already present in the store
+};
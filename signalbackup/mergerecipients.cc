@@ -21,6 +21,8 @@
 
 void SignalBackup::mergeRecipients(std::vector<std::string> const &addresses, bool editgroupmembers) // addresses is list of phone numbers
 {
+  PhaseStats::Scope phase("merge recipients");
+
   std::cout << __FUNCTION__ << std::endl;
 
   std::cout << "THIS FUNCTION SHOULD BE CONSIDERED DEPRECATED!" << std::endl;
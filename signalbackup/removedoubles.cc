@@ -21,6 +21,8 @@
 
 void SignalBackup::removeDoubles()
 {
+  PhaseStats::Scope phase("remove doubles");
+
   std::cout << __FUNCTION__  << std::endl;
 
   if (d_database.containsTable("sms"))
@@ -71,30 +73,11 @@ void SignalBackup::removeDoubles()
   std::cout << "  Deleting unused attachments..." << std::endl;
   SqliteDB::QueryResults results;
   d_database.exec("SELECT _id,unique_id FROM part", &results);
-  for (auto it = d_attachments.begin(); it != d_attachments.end();)
-  {
-    bool found = false;
-    for (uint i = 0; i < results.rows(); ++i)
-    {
-      long long int rowid = -1;
-      if (results.valueHasType<long long int>(i, "_id"))
-        rowid = results.getValueAs<long long int>(i, "_id");
-      long long int uniqueid = -1;
-      if (results.valueHasType<long long int>(i, "unique_id"))
-        uniqueid = results.getValueAs<long long int>(i, "unique_id");
-
-      if (rowid != -1 && uniqueid != -1 &&
-          it->first.first == static_cast<uint64_t>(rowid) && it->first.second == static_cast<uint64_t>(uniqueid))
-      {
-        found = true;
-        break;
-      }
-    }
-    if (!found)
-      it = d_attachments.erase(it);
-    else
-      ++it;
-  }
+  std::set<std::pair<uint64_t, uint64_t>> partids;
+  for (uint i = 0; i < results.rows(); ++i)
+    if (results.valueHasType<long long int>(i, "_id") && results.valueHasType<long long int>(i, "unique_id"))
+      partids.emplace(results.getValueAs<long long int>(i, "_id"), results.getValueAs<long long int>(i, "unique_id"));
+  d_attachments.eraseIf([&partids](AttachmentIndex::value_type const &att) { return !bepaald::contains(partids, att.first); });
 
   // remove unused group_receipts
   std::cout << "  Deleting group receipts entries from deleted messages..." << std::endl;
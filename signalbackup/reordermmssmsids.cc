@@ -21,6 +21,8 @@
 
 bool SignalBackup::reorderMmsSmsIds() const
 {
+  PhaseStats::Scope phase("reorder ids");
+
   std::cout << __FUNCTION__ << std::endl;
 
   // get all mms in the correct order
@@ -22,24 +22,34 @@
 void SignalBackup::setRecipientInfo(std::set<long long int> const &recipients,
                                     std::map<long long int, RecipientInfo> *recipientinfo) const
 {
-  // get info from all recipients:
+  // get the recipients not yet in the map...
+  std::string missing;
   for (long long int rid : recipients)
+    if (!bepaald::contains(recipientinfo, rid))
+      missing += (missing.empty() ? "" : ",") + bepaald::toString(rid);
+  if (missing.empty())
+    return;
+
+  // ...and get their info in one go
+  SqliteDB::QueryResults results;
+  d_database.exec("SELECT recipient._id AS rid, COALESCE(NULLIF(recipient." + d_recipient_system_joined_name + ", ''), " +
+                  (d_database.tableContainsColumn("recipient", "profile_joined_name") ? "NULLIF(recipient.profile_joined_name, ''),"s : ""s) +
+                  "NULLIF(recipient." + d_recipient_profile_given_name + ", ''), NULLIF(groups.title, ''), "
+                  "NULLIF(recipient." + d_recipient_e164 + ", ''), NULLIF(recipient." + d_recipient_aci + ", ''), "
+                  " recipient._id) AS 'display_name', recipient." + d_recipient_e164 + ", recipient.username, recipient." + d_recipient_aci + ", " +
+                  (d_database.tableContainsColumn("recipient", "chat_colors") ? "NULLIF(recipient.chat_colors, '') AS chat_colors,"s : ""s) + //wallpaper_file, custom_chat_colors_id
+                  "recipient.group_id, recipient." + d_recipient_avatar_color + ", recipient.wallpaper "
+                  "FROM recipient LEFT JOIN groups ON recipient.group_id = groups.group_id WHERE recipient._id IN (" + missing + ")", &results);
+
+  std::set<std::string> avatars;
+  for (auto const &a : d_avatars)
+    avatars.insert(a.first);
+
+  for (uint i = 0; i < results.rows(); ++i)
   {
-    if (bepaald::contains(recipientinfo, rid)) // already present
-      continue;
-
-    // get info
-    SqliteDB::QueryResults results;
-    d_database.exec("SELECT COALESCE(NULLIF(recipient." + d_recipient_system_joined_name + ", ''), " +
-                    (d_database.tableContainsColumn("recipient", "profile_joined_name") ? "NULLIF(recipient.profile_joined_name, ''),"s : ""s) +
-                    "NULLIF(recipient." + d_recipient_profile_given_name + ", ''), NULLIF(groups.title, ''), "
-                    "NULLIF(recipient." + d_recipient_e164 + ", ''), NULLIF(recipient." + d_recipient_aci + ", ''), "
-                    " recipient._id) AS 'display_name', recipient." + d_recipient_e164 + ", recipient.username, recipient." + d_recipient_aci + ", " +
-                    (d_database.tableContainsColumn("recipient", "chat_colors") ? "NULLIF(recipient.chat_colors, '') AS chat_colors,"s : ""s) + //wallpaper_file, custom_chat_colors_id
-                    "recipient.group_id, recipient." + d_recipient_avatar_color + ", recipient.wallpaper "
-                    "FROM recipient LEFT JOIN groups ON recipient.group_id = groups.group_id WHERE recipient._id = ?", rid, &results);
-
-    std::string display_name = results.valueAsString(0, "display_name");
+    long long int rid = results.valueAsInt(i, "rid");
+
+    std::string display_name = results.valueAsString(i, "display_name");
     if (display_name.empty())
       display_name = "?";
 
@@ -71,15 +81,15 @@ void SignalBackup::setRecipientInfo(std::set<long long int> const &recipients,
     if (display_name[0] != '?' && (std::ispunct(display_name[0]) || std::isdigit(display_name[0])))
       initial = "#";
 
-    std::string color = results.isNull(0, "group_id") ? "555555" : s_html_colormap.at("group_color");
-    if (bepaald::contains(s_html_colormap, results.valueAsString(0, d_recipient_avatar_color)))
-      color = s_html_colormap.at(results.valueAsString(0, d_recipient_avatar_color));
+    std::string color = results.isNull(i, "group_id") ? "555555" : s_html_colormap.at("group_color");
+    if (bepaald::contains(s_html_colormap, results.valueAsString(i, d_recipient_avatar_color)))
+      color = s_html_colormap.at(results.valueAsString(i, d_recipient_avatar_color));
 
     // custom color?
-    if (!results.isNull(0, "chat_colors"))
+    if (!results.isNull(i, "chat_colors"))
     {
       //std::cout << "CHAT COLOR" << std::endl;
-      auto [lightcolor, darkcolor] = getCustomColor(results.getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(0, "chat_colors"));
+      auto [lightcolor, darkcolor] = getCustomColor(results.getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(i, "chat_colors"));
       if (!lightcolor.empty())
         color = lightcolor;
     }
@@ -87,9 +97,9 @@ void SignalBackup::setRecipientInfo(std::set<long long int> const &recipients,
     // custom wallpaper?
     std::string wall_light;
     std::string wall_dark;
-    if (!results.isNull(0, "wallpaper"))
+    if (!results.isNull(i, "wallpaper"))
     {
-      auto [lightcolor, darkcolor] = getCustomColor(results.getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(0, "wallpaper"));
+      auto [lightcolor, darkcolor] = getCustomColor(results.getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(i, "wallpaper"));
       if (!lightcolor.empty())
       {
         wall_light = lightcolor;
@@ -97,20 +107,23 @@ void SignalBackup::setRecipientInfo(std::set<long long int> const &recipients,
       }
     }
 
-    bool hasavatar = (std::find_if(d_avatars.begin(), d_avatars.end(),
-                                   [rid](auto const &p) { return p.first == bepaald::toString(rid); }) != d_avatars.end());
-
     (*recipientinfo)[rid] = {display_name,
                              initial,
                              initial_is_emoji,
-                             results.valueAsString(0, d_recipient_aci),
-                             results.valueAsString(0, d_recipient_e164),
-                             results.valueAsString(0, "username"),
+                             results.valueAsString(i, d_recipient_aci),
+                             results.valueAsString(i, d_recipient_e164),
+                             results.valueAsString(i, "username"),
                              color,
                              wall_light,
                              wall_dark,
-                             hasavatar};
+                             bepaald::contains(avatars, bepaald::toString(rid))};
   }
+
+  // recipients not in database
+  for (long long int rid : recipients)
+    if (!bepaald::contains(recipientinfo, rid))
+      (*recipientinfo)[rid] = {"?", "?", false, std::string(), std::string(), std::string(), "555555",
+                               std::string(), std::string(), bepaald::contains(avatars, bepaald::toString(rid))};
 }
 
 /*
@@ -33,21 +33,29 @@
 #include "../stickerframe/stickerframe.h"
 #include "../endframe/endframe.h"
 #include "../sqlstatementframe/sqlstatementframe.h"
+#include "../attachmentindex/attachmentindex.h"
 
 #include <map>
 #include <set>
 #include <unordered_set>
+#include <unordered_map>
 #include <string>
 #include <iostream>
 #include <algorithm>
 
 struct HTMLMessageInfo;
+struct HTMLExportManifest;
+struct HTMLSearchIndex;
+struct MediaStore;
 struct Range;
 struct GroupInfo;
+struct DTMessageJson;
 enum class IconType;
 
 class SignalBackup
 {
+  friend class MicroBenchmark; // benchmark/micro times some of the private members
+
  public:
   static bool constexpr DROPATTACHMENTDATA = false;
 
@@ -84,7 +92,7 @@ class SignalBackup
   std::string d_dt_m_sourceuuid;
 
   std::vector<std::pair<std::string, std::unique_ptr<AvatarFrame>>> d_avatars;
-  std::map<std::pair<uint64_t, uint64_t>, std::unique_ptr<AttachmentFrame>> d_attachments; //maps <rowid,uniqueid> to attachment
+  AttachmentIndex d_attachments; //maps <rowid,uniqueid> to attachment
   std::map<uint64_t, std::unique_ptr<StickerFrame>> d_stickers; //maps <rowid> to sticker
   std::unique_ptr<HeaderFrame> d_headerframe;
   std::unique_ptr<DatabaseVersionFrame> d_databaseversionframe;
@@ -100,6 +108,8 @@ class SignalBackup
   std::set<std::string> d_warningsgiven;
   long long int d_selfid;
   std::string  d_selfuuid;
+  std::unordered_map<std::string, long long int> d_recipientidbyuuid;  // lowercase aci/group_id -> recipient._id, only set during import
+  std::unordered_map<std::string, long long int> d_recipientidbyphone; // lowercase e164 -> recipient._id, only set during import
 
   enum DBLinkFlag : int
   {
@@ -180,9 +190,11 @@ class SignalBackup
                       bool showprogress, bool replaceattachments);
   inline SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
                       bool showprogress, bool replaceattachment, bool assumebadframesizeonbadmac,
-                      std::vector<long long int> editattachments, bool stoponerror);
+                      std::vector<long long int> editattachments, bool stoponerror, bool readonly = false);
+  static long long int dirDatabaseVersion(std::string const &inputdir);
   [[nodiscard]] inline bool exportBackup(std::string const &filename, std::string const &passphrase,
-                                         bool overwrite, bool keepattachmentdatainmemory, bool onlydb = false);
+                                         bool overwrite, bool keepattachmentdatainmemory, bool onlydb = false,
+                                         bool dedupmedia = false);
   bool exportXml(std::string const &filename, bool overwrite, std::string self, bool includemms = false, bool keepattachmentdatainmemory = true) const;
   void exportCsv(std::string const &filename, std::string const &table) const;
   void listThreads() const;
@@ -209,7 +221,7 @@ class SignalBackup
   //bool importWAChat(std::string const &file, std::string const &fmt, std::string const &self = std::string());
   bool summarize() const;
   bool reorderMmsSmsIds() const;
-  bool dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite) const;
+  bool dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite, bool dedupmedia) const;
   bool dumpAvatars(std::string const &dir, std::vector<std::string> const &contacts, bool overwrite) const;
   bool deleteAttachments(std::vector<long long int> const &threadids, std::string const &before,
                          std::string const &after, long long int filesize,
@@ -225,7 +237,7 @@ class SignalBackup
   bool exportHtml(std::string const &directory, std::vector<long long int> const &threads,
                   std::vector<std::string> const &dateranges, long long int split, std::string const &selfid,
                   bool calllog, bool searchpage, bool migrate, bool overwrite, bool append, bool theme,
-                  bool themeswitching) const;
+                  bool themeswitching, bool dedupmedia) const;
   bool exportTxt(std::string const &directory, std::vector<long long int> const &threads,
                  std::vector<std::string> const &dateranges, std::string const &selfid, bool migrate, bool overwrite) const;
   bool findRecipient(long long int id) const;
@@ -245,9 +257,11 @@ class SignalBackup
  private:
   [[nodiscard]] bool exportBackupToFile(std::string const &filename, std::string const &passphrase,
                                         bool overwrite, bool keepattachmentdatainmemory);
-  [[nodiscard]] bool exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb);
+  [[nodiscard]] bool exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb,
+                                       bool dedupmedia);
+  [[nodiscard]] bool exportAttachmentsToDir(std::string const &directory, bool keepattachmentdatainmemory, bool dedupmedia) const;
   void initFromFile();
-  void initFromDir(std::string const &inputdir, bool replaceattachments);
+  void initFromDir(std::string const &inputdir, bool replaceattachments, bool databaseinplace);
   void updateThreadsEntries(long long int thread = -1);
   long long int getMaxUsedId(std::string const &table, std::string const &col = "_id") const;
   long long int getMinUsedId(std::string const &table, std::string const &col = "_id") const;
@@ -294,8 +308,8 @@ class SignalBackup
   std::string decodeStatusMessage(std::string const &body, long long int expiration, long long int type,
                                   std::string const &contactname, IconType *icon = nullptr) const;
   void escapeXmlString(std::string *s) const;
-  void handleSms(SqliteDB::QueryResults const &results, std::ofstream &outputfile, std::string const &self [[maybe_unused]], int i) const;
-  void handleMms(SqliteDB::QueryResults const &results, std::ofstream &outputfile, std::string const &self, int i, bool keepattachmentdatainmemory) const;
+  void handleSms(SqliteDB::QueryResults const &results, std::ostream &outputfile, std::string const &self [[maybe_unused]], int i) const;
+  void handleMms(SqliteDB::QueryResults const &results, std::ostream &outputfile, std::string const &self, int i, bool keepattachmentdatainmemory) const;
   inline std::string getStringOr(SqliteDB::QueryResults const &results, int i,
                                  std::string const &columnname, std::string const &def = std::string()) const;
   inline long long int getIntOr(SqliteDB::QueryResults const &results, int i,
@@ -310,6 +324,7 @@ class SignalBackup
   long long int scanSelf() const;
   bool cleanAttachments();
   AttachmentMetadata getAttachmentMetaData(std::string const &filename) const;
+  std::vector<AttachmentMetadata> getAttachmentMetaData(std::vector<std::string> const &files) const;
   inline bool updatePartTableForReplace(AttachmentMetadata const &data, long long int id);
   bool scrambleHelper(std::string const &table, std::vector<std::string> const &columns) const;
   std::vector<long long int> getGroupUpdateRecipients(int thread = -1) const;
@@ -322,37 +337,42 @@ class SignalBackup
   bool insertRow(std::string const &table, std::vector<std::pair<std::string, std::any>> data,
                  std::string const &returnfield = std::string(), std::any *returnvalue = nullptr) const;
   bool insertAttachments(long long int mms_id, long long int unique_id, int numattachments, long long int haspreviews,
-                         long long int rowid, SqliteDB const &ddb, std::string const &where,
-                         std::string const &databasedir, bool isquote, bool issticker);
-  bool handleDTCallTypeMessage(SqliteDB const &ddb, std::string const &callid, long long int rowid, long long int ttid, long long int address, bool insertincompletedataforexport) const;
-  void handleDTGroupChangeMessage(SqliteDB const &ddb, long long int rowid, long long int thread_id, long long int address,
+                         SqliteDB const &ddb, DTMessageJson const &msgjson,
+                         std::string const &databasedir, bool isquote, bool issticker,
+                         std::map<std::string, AttachmentMetadata> const *probed = nullptr);
+  bool handleDTCallTypeMessage(SqliteDB const &ddb, DTMessageJson const &msgjson, std::string const &callid, long long int sent_at,
+                               long long int ttid, long long int address, bool insertincompletedataforexport) const;
+  void handleDTGroupChangeMessage(DTMessageJson const &msgjson, long long int thread_id, long long int address,
                                   long long int date, std::map<long long int, long long int> *adjusted_timestamps, std::map<std::string, long long int> *savedmap, bool istimermessage) const;
-  bool handleDTExpirationChangeMessage(SqliteDB const &ddb, long long int rowid, long long int ttid, long long int sent_at, long long int address) const;
-  bool handleDTGroupV1Migration(SqliteDB const &ddb, long long int rowid, long long int thread_id, long long int timestamp,
+  bool handleDTExpirationChangeMessage(SqliteDB const &ddb, DTMessageJson const &msgjson, long long int ttid, long long int sent_at, long long int address) const;
+  bool handleDTGroupV1Migration(SqliteDB const &ddb, DTMessageJson const &msgjson, long long int thread_id, long long int timestamp,
                                 long long int address, std::map<std::string, long long int> *savedmap,
                                 bool createcontacts, std::string const &databasedir, bool *warn);
-  void getDTReactions(SqliteDB const &ddb, long long int rowid, long long int numreactions,
-                      std::vector<std::vector<std::string>> *reactions) const;
+  void getDTReactions(SqliteDB const &ddb, DTMessageJson const &msgjson, std::vector<std::vector<std::string>> *reactions) const;
   void insertReactions(long long int message_id, std::vector<std::vector<std::string>> const &reactions, bool mms,
                        std::map<std::string, long long int> *savedmap) const;
+  void buildRecipientIdIndex();
   long long int getRecipientIdFromUuid(std::string const &uuid, std::map<std::string, long long int> *savedmap,
                                        bool suppresswarning = false) const;
   long long int getRecipientIdFromPhone(std::string const &phone, std::map<std::string, long long int> *savedmap,
                                         bool suppresswarning = false) const;
   inline std::string getNameFromUuid(std::string const &uuid) const;
   std::string getNameFromRecipientId(long long int id) const;
-  void dtSetMessageDeliveryReceipts(SqliteDB const &ddb, long long int rowid, std::map<std::string, long long int> *savedmap,
+  void dtSetMessageDeliveryReceipts(SqliteDB const &ddb, DTMessageJson const &msgjson, std::map<std::string, long long int> *savedmap,
                                     std::string const &databasedir, bool createcontacts, long long int msg_id, bool is_mms, bool isgroup, bool *warn);
   bool HTMLwriteStart(std::ofstream &file, long long int thread_recipient_id, std::string const &directory,
-                      std::string const &threaddir, bool isgroup, bool isnotetoself, std::set<long long int> const &recipients,
+                      bool isgroup, bool isnotetoself, std::set<long long int> const &recipients,
                       std::map<long long int, RecipientInfo> *recipientinfo,
-                      std::map<long long int, std::string> *written_avatars, bool overwrite, bool append,
-                      bool light, bool themeswitching, bool searchpage) const;
+                      std::map<long long int, std::string> *written_avatars,
+                      std::map<long long int, std::pair<GroupInfo, std::vector<long long int>>> *groupinfo_cache,
+                      bool overwrite, bool append, bool light, bool themeswitching, bool searchpage) const;
   void HTMLwriteAttachmentDiv(std::ofstream &htmloutput, SqliteDB::QueryResults const &attachment_results, int indent,
                               std::string const &directory, std::string const &threaddir, bool is_image_preview,
-                              bool overwrite, bool append) const;
+                              bool overwrite, bool append, MediaStore *mediastore) const;
   bool HTMLwriteAttachment(std::string const &directory, std::string const &threaddir, long long int rowid,
-                           long long int uniqueid, bool overwrite, bool append) const;
+                           long long int uniqueid, bool overwrite, bool append, MediaStore *mediastore) const;
+  bool initMediaStore(std::string const &directory, MediaStore *mediastore) const;
+  bool writeAttachmentDeduplicated(AttachmentFrame *a, std::string const &filename, MediaStore *mediastore) const;
   std::set<long long int> getAllThreadRecipients(long long int t) const;
   void setRecipientInfo(std::set<long long int> const &recipients, std::map<long long int, RecipientInfo> *recipientinfo) const;
   bool HTMLprepMsgBody(std::string *body, std::vector<std::tuple<long long int, long long int, long long int>> const &mentions,
@@ -362,18 +382,31 @@ class SignalBackup
   void prepRanges2(std::vector<Range> *ranges) const;
   void applyRanges(std::string *body, std::vector<Range> *ranges, std::set<int> *positions_excluded_from_escape) const;
   std::vector<std::pair<unsigned int, unsigned int>> HTMLgetEmojiPos(std::string const &line) const;
-  bool makeFilenameUnique(std::string const &path, std::string *file_or_dir) const;
+  bool makeFilenameUnique(std::string const &path, std::string *file_or_dir,
+                          std::set<std::string> const *reserved = nullptr) const;
   std::string decodeProfileChangeMessage(std::string const &body, std::string const &name) const;
-  std::string HTMLwriteAvatar(long long int recipient_id, std::string const &directory, std::string const &threaddir,
-                              bool overwrite, bool append) const;
+  std::string HTMLwriteAvatar(long long int recipient_id, std::string const &directory,
+                              std::map<long long int, std::string> *written_avatars, bool overwrite, bool append) const;
   void HTMLwriteMessage(std::ofstream &filt, HTMLMessageInfo const &msginfo, std::map<long long int, RecipientInfo> *recipientinfo,
                         bool searchpage) const;
   void HTMLwriteIndex(std::vector<long long int> const &threads, std::string const &directory,
-                      std::map<long long int, RecipientInfo> *recipientinfo, long long int notetoself_tid, bool calllog,
+                      std::map<long long int, RecipientInfo> *recipientinfo,
+                      std::map<long long int, std::string> *written_avatars, long long int notetoself_tid, bool calllog,
                       bool searchpage, bool overwrite, bool append, bool light, bool themeswitching) const;
   void HTMLwriteSearchpage(std::string const &dir, bool light, bool themeswitching) const;
+  void HTMLwritePageFooter(std::ofstream &htmloutput, std::string raw_base_filename, int pagenumber, int totalpages,
+                           long long int thread_recipient_id, bool searchpage, bool themeswitching) const;
+  bool HTMLreadManifest(std::string const &directory, HTMLExportManifest *manifest) const;
+  bool HTMLwriteManifest(std::string const &directory, HTMLExportManifest const &manifest) const;
+  bool HTMLaddToSearchIndex(std::string const &directory, long long int thread_id, long long int thread_recipient_id,
+                            SqliteDB::QueryResults const &messages, std::vector<unsigned int> const &pageends,
+                            std::vector<std::string> const &pagepaths, HTMLSearchIndex *searchindex) const;
+  bool HTMLwriteSearchIndexShard(std::string const &directory, HTMLSearchIndex *searchindex) const;
+  bool HTMLwriteSearchIndex(std::string const &directory, HTMLSearchIndex *searchindex,
+                            std::map<long long int, RecipientInfo> *recipient_info) const;
   void HTMLwriteCallLog(std::vector<long long int> const &threads, std::string const &directory,
-                        std::map<long long int, RecipientInfo> *recipientinfo, long long int notetoself_tid,
+                        std::map<long long int, RecipientInfo> *recipientinfo,
+                        std::map<long long int, std::string> *written_avatars, long long int notetoself_tid,
                         bool overwrite, bool append, bool light, bool themeswitching) const;
   void HTMLescapeString(std::string *in, std::set<int> const *const positions_excluded_from_escape = nullptr) const;
   void HTMLescapeUrl(std::string *in) const;
@@ -396,7 +429,7 @@ class SignalBackup
   std::pair<std::string, std::string> getCustomColor(std::pair<std::shared_ptr<unsigned char []>, size_t> const &colorproto) const;
   inline std::string HTMLprepLinkPreviewDescription(std::string const &in) const;
   long long int getFreeDateForMessage(long long int targetdate, long long int thread_id, long long int from_recipient_id) const;
-  inline void TXTaddReactions(SqliteDB::QueryResults const *const reaction_results, std::ofstream *out) const;
+  inline void TXTaddReactions(SqliteDB::QueryResults const *const reaction_results, std::ostream *out) const;
   inline void setLongMessageBody(std::string *body, SqliteDB::QueryResults *attachment_results) const;
 };
 
@@ -408,9 +441,10 @@ inline SignalBackup::SignalBackup(std::string const &filename, std::string const
 
 inline SignalBackup::SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
                                   bool showprogress, bool replaceattachments, bool assumebadframesizeonbadmac,
-                                  std::vector<long long int> editattachments, bool stoponerror)
+                                  std::vector<long long int> editattachments, bool stoponerror, bool readonly)
   :
-  d_database(":memory:"),
+  // a directory that will not be modified is used in place, instead of copying its database into memory
+  d_database((readonly && !replaceattachments && bepaald::isDir(filename)) ? filename + "/database.sqlite" : ":memory:"),
   d_passphrase(passphrase),
   d_found_sqlite_sequence_in_backup(false),
   d_ok(false),
@@ -421,7 +455,7 @@ inline SignalBackup::SignalBackup(std::string const &filename, std::string const
   d_selfid(-1)
 {
   if (bepaald::isDir(filename))
-    initFromDir(filename, replaceattachments);
+    initFromDir(filename, replaceattachments, readonly && !replaceattachments);
   else // not directory
   {
     d_fd.reset(new FileDecryptor(filename, passphrase, d_verbose, stoponerror, assumebadframesizeonbadmac, editattachments));
@@ -437,11 +471,11 @@ inline SignalBackup::SignalBackup(std::string const &filename, std::string const
 }
 
 inline bool SignalBackup::exportBackup(std::string const &filename, std::string const &passphrase, bool overwrite,
-                                       bool keepattachmentdatainmemory, bool onlydb)
+                                       bool keepattachmentdatainmemory, bool onlydb, bool dedupmedia)
 {
   // if output is existing directory
   if (bepaald::fileOrDirExists(filename) && bepaald::isDir(filename))
-    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb);
+    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb, dedupmedia);
 
   // if output does not exist, but ends in directory delimiter
   if (!bepaald::fileOrDirExists(filename) &&
@@ -454,7 +488,7 @@ inline bool SignalBackup::exportBackup(std::string const &filename, std::string
       std::cout << "Error: Failed to create directory \"" << filename << "\"" << std::endl;
       return false;
     }
-    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb);
+    return exportBackupToDir(filename, overwrite, keepattachmentdatainmemory, onlydb, dedupmedia);
   }
 
   // export to file
@@ -877,7 +911,7 @@ inline std::string SignalBackup::HTMLprepLinkPreviewDescription(std::string cons
   return cleaned;
 }
 
-inline void SignalBackup::TXTaddReactions(SqliteDB::QueryResults const *const reaction_results, std::ofstream *out) const
+inline void SignalBackup::TXTaddReactions(SqliteDB::QueryResults const *const reaction_results, std::ostream *out) const
 {
   if (reaction_results->rows() == 0) [[likely]]
     return;
@@ -21,6 +21,8 @@
 
 void SignalBackup::updateThreadsEntries(long long int thread)
 {
+  PhaseStats::Scope phase("update threads entries");
+
   std::cout << __FUNCTION__ << std::endl;
 
   SqliteDB::QueryResults results;
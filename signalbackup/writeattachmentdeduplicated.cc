@@ -0,0 +1,106 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+#include "mediastore.h"
+
+#ifndef USE_CRYPTOPP
+#include <openssl/sha.h>
+#endif
+
+bool SignalBackup::writeAttachmentDeduplicated(AttachmentFrame *a, std::string const &filename, MediaStore *mediastore) const
+{
+  // if the database already knows the hash of this attachment, and an attachment with
+  // the same hash was stored before, it does not need to be decrypted at all
+  std::string datahash;
+  std::string storedfile;
+  if (!mediastore->datahashcolumn.empty())
+  {
+    datahash = d_database.getSingleResultAs<std::string>("SELECT " + mediastore->datahashcolumn + " FROM part WHERE _id = ?",
+                                                         static_cast<long long int>(a->rowId()), std::string());
+    auto it = mediastore->datahashfiles.find(datahash);
+    if (!datahash.empty() && it != mediastore->datahashfiles.end() && bepaald::fileOrDirExists(it->second))
+      storedfile = it->second;
+  }
+
+  if (storedfile.empty())
+  {
+    unsigned char *data = a->attachmentData();
+    if (!data)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to get attachment data for '" << filename << "'" << std::endl;
+      return false;
+    }
+
+    unsigned char rawhash[SHA256_DIGEST_LENGTH];
+    if (EVP_Digest(data, a->attachmentSize(), rawhash, nullptr, EVP_sha256(), nullptr) != 1)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to hash attachment data for '" << filename << "'" << std::endl;
+      a->clearData();
+      return false;
+    }
+    storedfile = mediastore->directory + "/" + bepaald::bytesToHexString(rawhash, SHA256_DIGEST_LENGTH, true) + ".bin";
+
+    if (bepaald::fileOrDirExists(storedfile))
+      ++mediastore->duplicates;
+    else
+    {
+      std::ofstream storestream(storedfile, std::ios_base::binary);
+      if (!storestream.is_open() ||
+          !storestream.write(reinterpret_cast<char *>(data), a->attachmentSize()))
+      {
+        std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                  << ": Failed to write file '" << storedfile << "'" << std::endl;
+        storestream.close();
+        std::error_code ec;
+        std::filesystem::remove(storedfile, ec);
+        a->clearData();
+        return false;
+      }
+      ++mediastore->stored;
+    }
+    a->clearData();
+
+    if (!datahash.empty())
+      mediastore->datahashfiles[datahash] = storedfile;
+  }
+  else
+    ++mediastore->duplicates;
+
+  // link the requested file to the stored one, fall back to copying if the
+  // filesystem does not support hard links
+  std::error_code ec;
+  if (bepaald::fileOrDirExists(filename))
+    std::filesystem::remove(filename, ec);
+  std::filesystem::create_hard_link(storedfile, filename, ec);
+  if (ec)
+  {
+    ec.clear();
+    std::filesystem::copy_file(storedfile, filename, std::filesystem::copy_options::overwrite_existing, ec);
+    if (ec)
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to link or copy '" << storedfile << "' to '" << filename << "': " << ec.message() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
@@ -21,6 +21,9 @@
 
 bool SignalBackup::writeEncryptedFrameWithoutAttachment(std::ofstream &outputfile, std::pair<unsigned char *, uint64_t> framedata)
 {
+  PhaseStats::Scope phase("frame encryption");
+  Trace::Span span("SignalBackup::writeEncryptedFrameWithoutAttachment");
+
   // write frame (the non-attachmentdata part)
   std::pair<unsigned char *, uint64_t> encryptedframe = d_fe.encryptFrame(framedata);
   delete[] framedata.first;
@@ -35,12 +38,19 @@ bool SignalBackup::writeEncryptedFrameWithoutAttachment(std::ofstream &outputfil
   delete[] encryptedframe.first;
   if (!writeok)
     std::cout << "Failed to write encrypted frame data to file" << std::endl;
+  else
+  {
+    phase.addBytesWritten(encryptedframe.second);
+    phase.addItems(1);
+  }
 
   return writeok;
 }
 
 bool SignalBackup::writeEncryptedFrame(std::ofstream &outputfile, BackupFrame *frame)
 {
+  Trace::Span span("SignalBackup::writeEncryptedFrame");
+
   std::pair<unsigned char *, uint64_t> framedata = frame->getData();
   if (!framedata.first)
   {
@@ -75,9 +85,12 @@ bool SignalBackup::writeEncryptedFrame(std::ofstream &outputfile, BackupFrame *f
     }
 
     // write attachment data
+    PhaseStats::Scope phase("attachment encryption");
     std::pair<unsigned char *, uint64_t> newdata = d_fe.encryptAttachment(attachmentdata, attachmentsize);
     //std::cout << "Writing attachment data..." << std::endl;
     outputfile.write(reinterpret_cast<char *>(newdata.first), newdata.second);
+    phase.addBytesWritten(newdata.second);
+    phase.addItems(1);
     delete[] newdata.first;
 
     if (!outputfile.good())
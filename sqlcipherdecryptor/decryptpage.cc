@@ -0,0 +1,92 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+/*
+  Verifies and decrypts a single page in place. 'page' points to the start of the page data (for the
+  first page, that is after the salt).
+
+    PAGE
+
+                                                         page_size
+     -------------------------------------------------------------------------------------------------------------------------------
+    /                                                                     real_page_size                                            \
+    |                                 -----------------------------------------------------------------------------------------------|
+    |                                /                                                                                               |
+    |                                |                                                                                               |
+    |                                |     page + (real_page_size - (digest_size + page_padding) - iv_size)                          |
+    |                                |                v                                                                              |
+
+    [salt, 16 bytes, only first page][encrypted bytes][iv, 16 bytes][mac, padded to 16 bytes (for version < 3, 20 bytes, padded to 32]
+
+  Returns an empty string on success, or the error message otherwise.
+*/
+std::string SqlCipherDecryptor::decryptPage(PageContext *ctx, unsigned int pagenumber, unsigned char *page) const
+{
+  unsigned int const iv_size = 16;
+  unsigned int const page_padding = (((d_digestsize - 1) | 15) + 1) - d_digestsize;  // pad to multiple of 16 bytes ??? (maybe 32?)
+  unsigned int real_page_size = pagenumber == 1 ? d_pagesize - d_saltsize : d_pagesize;
+
+  // these pointers all point to specific data inside the page
+  unsigned char *page_data_to_hash = page;
+  unsigned int page_data_to_hash_size = real_page_size - (d_digestsize + page_padding);
+  unsigned char *page_encrypted_data = page;
+  unsigned int page_encrypted_data_size = page_data_to_hash_size - iv_size;
+  unsigned char *page_mac = page + page_data_to_hash_size;
+
+  // calculate MAC (pagenumber is hashed in native byte order, init without key reuses the key)
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  if (EVP_MAC_init(ctx->hctx.get(), nullptr, 0, nullptr) != 1 ||
+      EVP_MAC_update(ctx->hctx.get(), page_data_to_hash, page_data_to_hash_size) != 1 ||
+      EVP_MAC_update(ctx->hctx.get(), reinterpret_cast<unsigned char *>(&pagenumber), sizeof(pagenumber)) != 1 ||
+      EVP_MAC_final(ctx->hctx.get(), ctx->calculatedmac.get(), nullptr, d_digestsize) != 1)
+    return "Failed to update/finalize hmac\n";
+#else
+  unsigned int digestsize = d_digestsize;
+  if (HMAC_Init_ex(ctx->hctx.get(), nullptr, 0, nullptr, nullptr) != 1 ||
+      HMAC_Update(ctx->hctx.get(), page_data_to_hash, page_data_to_hash_size) != 1 ||
+      HMAC_Update(ctx->hctx.get(), reinterpret_cast<unsigned char *>(&pagenumber), sizeof(pagenumber)) != 1 ||
+      HMAC_Final(ctx->hctx.get(), ctx->calculatedmac.get(), &digestsize) != 1)
+    return "Failed to update/finalize hmac\n";
+#endif
+  if (std::memcmp(page_mac, ctx->calculatedmac.get(), d_digestsize) != 0) [[unlikely]]
+    return "MAC in file: " + bepaald::bytesToHexString(page_mac, d_digestsize) + "\n" +
+      "Calculated : " + bepaald::bytesToHexString(ctx->calculatedmac.get(), d_digestsize) + "\n" +
+      "BAD MAC! (pagenumber: " + bepaald::toString(pagenumber) + ")\n";
+
+  // the iv is overwritten (zeroed) below, copy it out first
+  unsigned char iv[iv_size];
+  std::memcpy(iv, page + page_data_to_hash_size - iv_size, iv_size);
+
+  // reinit decryptor with this page's iv, and decrypt in place
+  if (EVP_DecryptInit_ex(ctx->dctx.get(), nullptr, nullptr, nullptr, iv) != 1)
+    return "CTX INIT FAILED\n";
+  EVP_CIPHER_CTX_set_padding(ctx->dctx.get(), 0);
+
+  int actualdecodedframelength = 0;
+  if (EVP_DecryptUpdate(ctx->dctx.get(), page_encrypted_data, &actualdecodedframelength, page_encrypted_data, page_encrypted_data_size) != 1)
+  {
+    ERR_print_errors_fp(stderr);
+    return "Failed to update decryption context\n";
+  }
+
+  std::memset(page + page_encrypted_data_size, 0, real_page_size - page_encrypted_data_size); // append zeros
+  return std::string();
+}
@@ -0,0 +1,37 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+// decrypts pages [first, last] (1-based) of the database, which was read into d_decrypteddata, in
+// place. Returns an empty string on success, or the error message otherwise.
+std::string SqlCipherDecryptor::decryptPages(uint64_t first, uint64_t last) const
+{
+  PageContext ctx;
+  if (!initPageContext(&ctx))
+    return "Failed to initialize decryption contexts\n";
+
+  for (uint64_t p = first; p <= last; ++p)
+  {
+    unsigned char *page = d_decrypteddata + (p - 1) * d_pagesize + (p == 1 ? d_saltsize : 0);
+    if (std::string error = decryptPage(&ctx, p, page); !error.empty())
+      return error;
+  }
+  return std::string();
+}
@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+// (lazy mode) returns the decrypted page at index (0-based), reading and decrypting it if it is not
+// in the page cache. Returns nullptr on error.
+unsigned char const *SqlCipherDecryptor::getPage(uint64_t index)
+{
+  CachedPage &slot = d_pagecache[index % d_pagecache.size()];
+  if (slot.data && slot.index == index) [[likely]]
+    return slot.data.get();
+
+  if (!slot.data)
+    slot.data.reset(new unsigned char[d_pagesize]);
+  slot.index = std::numeric_limits<uint64_t>::max(); // invalid until successfully decrypted
+
+  d_dbfile.clear();
+  if (!d_dbfile.seekg(index * d_pagesize, std::ios_base::beg) ||
+      !d_dbfile.read(reinterpret_cast<char *>(slot.data.get()), d_pagesize))
+  {
+    std::cout << "Failed to read page " << index + 1 << " from database file" << std::endl;
+    return nullptr;
+  }
+
+  if (std::string error = decryptPage(d_pagecontext.get(), index + 1, slot.data.get() + (index == 0 ? d_saltsize : 0));
+      !error.empty())
+  {
+    std::cout << error << std::flush;
+    return nullptr;
+  }
+
+  // the salt is replaced by the header
+  if (index == 0)
+    std::memcpy(slot.data.get(), s_sqlliteheader, s_sqlliteheader_size);
+
+  slot.index = index;
+  return slot.data.get();
+}
@@ -0,0 +1,46 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+// sets up the contexts with the keys, decryptPage() then only needs to reinitialize them (with a
+// new iv) for every page
+bool SqlCipherDecryptor::initPageContext(PageContext *ctx) const
+{
+  if (!ctx->dctx || !ctx->hctx ||
+      EVP_DecryptInit_ex(ctx->dctx.get(), EVP_aes_256_cbc(), nullptr, d_key, nullptr) != 1)
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return false;
+  }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", d_digestname, 0), OSSL_PARAM_construct_end()};
+  if (EVP_MAC_init(ctx->hctx.get(), d_hmackey, d_hmackeysize, params) != 1)
+#else
+  if (HMAC_Init_ex(ctx->hctx.get(), d_hmackey, d_hmackeysize, d_digest, nullptr) != 1)
+#endif
+  {
+    std::cout << "Failed to initialize HMAC context" << std::endl;
+    return false;
+  }
+
+  ctx->calculatedmac.reset(new unsigned char[d_digestsize]);
+  return true;
+}
@@ -0,0 +1,42 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+// (lazy mode) copies size bytes of the decrypted database at offset into buffer
+bool SqlCipherDecryptor::read(unsigned char *buffer, uint64_t offset, uint64_t size) // virtual override
+{
+  if (!d_pagecontext || offset + size > d_decrypteddatasize)
+    return false;
+
+  while (size)
+  {
+    unsigned char const *page = getPage(offset / d_pagesize);
+    if (!page)
+      return false;
+
+    uint64_t pageoffset = offset % d_pagesize;
+    uint64_t n = std::min(size, d_pagesize - pageoffset);
+    std::memcpy(buffer, page + pageoffset, n);
+    buffer += n;
+    offset += n;
+    size -= n;
+  }
+  return true;
+}
@@ -27,7 +27,7 @@
   - Pagesize: 1024 -> 4096
 */
 
-SqlCipherDecryptor::SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version)
+SqlCipherDecryptor::SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version, bool lazy)
   :
   d_ok(false),
   d_configpath(configpath),
@@ -77,6 +77,23 @@ SqlCipherDecryptor::SqlCipherDecryptor(std::string const &configpath, std::strin
   if (!getHmacKey())
     return;
 
+  // in lazy mode, pages are only read and decrypted when they are requested through read()
+  if (lazy)
+  {
+    if (d_decrypteddatasize % d_pagesize != 0)
+    {
+      std::cout << "Unexpected database file size (not a multiple of page size)" << std::endl;
+      return;
+    }
+    d_pagecontext.reset(new PageContext);
+    if (!initPageContext(d_pagecontext.get()))
+      return;
+    d_pagecache.resize(std::max<uint64_t>(1, s_pagecachesize / d_pagesize));
+    d_dbfile = std::move(dbfile);
+    d_ok = true;
+    return;
+  }
+
   if (!decryptData(&dbfile))
     return;
 
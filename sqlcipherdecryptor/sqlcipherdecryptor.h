@@ -22,14 +22,24 @@
 
 #include <string>
 #include <fstream>
+#include <memory>
+#include <vector>
 
 #include "../common_be.h"
+#include "../memfiledb/memfiledb.h"
 
 
 struct evp_md_st;
 
-class SqlCipherDecryptor
+class SqlCipherDecryptor : public MemFileDB::PageSource
 {
+  struct PageContext; // reusable cipher and hmac contexts, defined in sqlcipherdecryptor.ih
+  struct CachedPage
+  {
+    uint64_t index;
+    std::unique_ptr<unsigned char[]> data;
+  };
+
   bool d_ok;
   std::string d_configpath;
   std::string d_apppath;
@@ -46,6 +56,11 @@ class SqlCipherDecryptor
   unsigned int d_pagesize;
   unsigned char *d_decrypteddata;
   uint64_t d_decrypteddatasize;
+  std::ifstream d_dbfile;                      // lazy mode only: pages are read and decrypted on demand
+  std::unique_ptr<PageContext> d_pagecontext;  //  "
+  std::vector<CachedPage> d_pagecache;         //  "   direct mapped, on page index
+
+  static uint64_t constexpr s_pagecachesize = 64 * 1024 * 1024; // bytes, lazy mode only
 
   static unsigned char constexpr s_saltmask = 0x3a;
   static int constexpr s_sqlliteheader_size = 16;
@@ -58,17 +73,23 @@ class SqlCipherDecryptor
   };
 
  public:
-  explicit SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version);
+  explicit SqlCipherDecryptor(std::string const &configpath, std::string const &apppath, int version, bool lazy = false);
   SqlCipherDecryptor(SqlCipherDecryptor const &other) = delete;
   SqlCipherDecryptor &operator=(SqlCipherDecryptor const &other) = delete;
   ~SqlCipherDecryptor();
   inline bool ok() const;
   inline DecodedData data() const;
   inline bool writeToFile(std::string const &filename, bool overwrite) const;
+  inline virtual uint64_t size() const override;
+  virtual bool read(unsigned char *buffer, uint64_t offset, uint64_t size) override;
  private:
   bool getKey();
   bool getHmacKey();
   bool decryptData(std::ifstream *dbfile);
+  std::string decryptPages(uint64_t first, uint64_t last) const;
+  bool initPageContext(PageContext *ctx) const;
+  std::string decryptPage(PageContext *ctx, unsigned int pagenumber, unsigned char *page) const;
+  unsigned char const *getPage(uint64_t index);
 };
 
 inline bool SqlCipherDecryptor::ok() const
@@ -81,8 +102,19 @@ inline SqlCipherDecryptor::DecodedData SqlCipherDecryptor::data() const
   return {d_decrypteddata, d_decrypteddatasize};
 }
 
+inline uint64_t SqlCipherDecryptor::size() const // virtual override
+{
+  return d_decrypteddatasize;
+}
+
 inline bool SqlCipherDecryptor::writeToFile(std::string const &filename, bool overwrite) const
 {
+  if (!d_decrypteddata) // lazy mode
+  {
+    std::cout << "No decrypted data to write" << std::endl;
+    return false;
+  }
+
   if (!overwrite && bepaald::fileOrDirExists(filename))
   {
     std::cout << "File " << filename << " exists, use --overwrite to overwrite" << std::endl;
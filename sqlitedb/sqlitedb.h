@@ -25,12 +25,15 @@
 #include <vector>
 #include <iostream>
 #include <any>
+#include <map>
+#include <unordered_map>
 #if __cpp_lib_ranges >= 201911L && !defined(__clang__) // ranges does not currently seem to work with clang
 #include <ranges>
 #endif
 
 #include "../common_be.h"
 #include "../memfiledb/memfiledb.h"
+#include "../trace/trace.h"
 
 class SqliteDB
 {
@@ -92,9 +95,17 @@ class SqliteDB
   sqlite3_vfs *d_vfs;
   bool d_ok;
 
+  // batch mode (see beginBatch()): statements are prepared once and reused,
+  // and the table schema is assumed not to change
+  static unsigned int constexpr s_maxcachedstatements = 256;
+  mutable bool d_batch;
+  mutable std::unordered_map<std::string, sqlite3_stmt *> d_statementcache;
+  mutable std::map<std::pair<std::string, std::string>, bool> d_columncache;
+
  public:
   inline explicit SqliteDB(std::string const &name, bool readonly = true);
   inline explicit SqliteDB(std::pair<unsigned char *, uint64_t> *data);
+  inline explicit SqliteDB(MemFileDB::PageSource *source);
   inline SqliteDB(SqliteDB const &other) = delete;
   inline SqliteDB &operator=(SqliteDB const &other) = delete;
   inline ~SqliteDB();
@@ -129,8 +140,14 @@ class SqliteDB
   template <typename... columnnames>
   inline bool tableContainsColumn(std::string const &tablename, std::string const &columnname, columnnames... list) const;
   inline void freeMemory();
+  inline bool beginBatch() const;
+  inline bool commitBatch() const;
+  inline bool endBatch() const;
+  inline bool inBatch() const;
 
  private:
+  inline sqlite3_stmt *prepare(std::string const &q) const;
+  inline bool finish(sqlite3_stmt *stmt, std::string const &q) const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, std::string const &param) const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, int param) const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, unsigned int param) const;
@@ -153,7 +170,8 @@ inline SqliteDB::SqliteDB(std::string const &name, bool readonly)
   :
   d_db(nullptr),
   d_vfs(nullptr),
-  d_ok(false)
+  d_ok(false),
+  d_batch(false)
 {
   if (name != ":memory:" && readonly)
     d_ok = (sqlite3_open_v2(name.c_str(), &d_db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK);
@@ -168,7 +186,8 @@ inline SqliteDB::SqliteDB(std::pair<unsigned char *, uint64_t> *data)
   :
   d_db(nullptr),
   d_vfs(MemFileDB::sqlite3_memfilevfs(data)),
-  d_ok(false)
+  d_ok(false),
+  d_batch(false)
 {
   if (sqlite3_vfs_register(d_vfs, 0) == SQLITE_OK)
     d_ok = (sqlite3_open_v2(MemFileDB::vfsName(), &d_db, SQLITE_OPEN_READONLY, MemFileDB::vfsName()) == SQLITE_OK);
@@ -177,8 +196,25 @@ inline SqliteDB::SqliteDB(std::pair<unsigned char *, uint64_t> *data)
     d_ok = registerCustoms();
 }
 
+inline SqliteDB::SqliteDB(MemFileDB::PageSource *source)
+  :
+  d_db(nullptr),
+  d_vfs(MemFileDB::sqlite3_pagesourcevfs(source)),
+  d_ok(false),
+  d_batch(false)
+{
+  if (sqlite3_vfs_register(d_vfs, 0) == SQLITE_OK)
+    d_ok = (sqlite3_open_v2(MemFileDB::pageSourceVfsName(), &d_db, SQLITE_OPEN_READONLY, MemFileDB::pageSourceVfsName()) == SQLITE_OK);
+
+  if (d_ok)
+    d_ok = registerCustoms();
+}
+
 inline SqliteDB::~SqliteDB()
 {
+  for (auto const &[q, stmt] : d_statementcache)
+    sqlite3_finalize(stmt);
+
   if (d_db)
     sqlite3_close(d_db);
 
@@ -208,14 +244,11 @@ inline bool SqliteDB::exec(std::string const &q, R &&params, QueryResults *resul
 inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &params, QueryResults *results) const
 #endif
 {
-  sqlite3_stmt *stmt;
-  if (sqlite3_prepare_v2(d_db, q.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
-  {
-    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
-      "During sqlite3_prepare_v2(): " << sqlite3_errmsg(d_db) << std::endl <<
-      "  Query: \"" << q << "\"" << std::endl;
+  Trace::Span span("SqliteDB::exec");
+
+  sqlite3_stmt *stmt = prepare(q);
+  if (!stmt)
     return false;
-  }
 
   if (static_cast<int>(params.size()) != sqlite3_bind_parameter_count(stmt)) [[unlikely]]
   {
@@ -387,15 +420,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     return false;
   }
 
-  if (sqlite3_finalize(stmt) != SQLITE_OK)
-  {
-    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
-      "During sqlite3_finalize(): " << sqlite3_errmsg(d_db) << std::endl <<
-      "  Query: \"" << q << "\"" << std::endl;
-    return false;
-  }
-
-  return true;
+  return finish(stmt, q);
 }
 
 #if __cpp_lib_ranges >= 201911L && !defined(__clang__)
@@ -575,10 +600,18 @@ inline bool SqliteDB::containsTable(std::string const &tablename) const
 
 inline bool SqliteDB::tableContainsColumn(std::string const &tablename, std::string const &columnname) const
 {
+  if (d_batch)
+    if (auto it = d_columncache.find({tablename, columnname}); it != d_columncache.end())
+      return it->second;
+
+  bool contains = false;
   QueryResults tmp;
   if (exec("SELECT 1 FROM PRAGMA_TABLE_XINFO('" + tablename + "') WHERE name == '" + columnname + "'", &tmp))
-    return (tmp.rows() > 0);
-  return false;
+    contains = (tmp.rows() > 0);
+
+  if (d_batch)
+    d_columncache.emplace(std::make_pair(tablename, columnname), contains);
+  return contains;
 }
 
 template <typename... columnnames>
@@ -592,6 +625,105 @@ inline void SqliteDB::freeMemory()
   sqlite3_db_release_memory(d_db);
 }
 
+// Starts a transaction, that stays open until endBatch(). Until then, prepared
+// statements are kept and reused for identical queries (so bulk inserts only
+// need to bind and step) and column lookups are cached, so the schema should
+// not be altered during a batch. Use SAVEPOINT (not BEGIN) inside a batch.
+inline bool SqliteDB::beginBatch() const
+{
+  if (d_batch)
+    return true;
+  if (!exec("BEGIN TRANSACTION"))
+    return false;
+  d_batch = true;
+  return true;
+}
+
+// commits the work done so far, keeping the batch (and its statements) open
+inline bool SqliteDB::commitBatch() const
+{
+  if (!d_batch)
+    return false;
+  return exec("COMMIT TRANSACTION") && exec("BEGIN TRANSACTION");
+}
+
+inline bool SqliteDB::endBatch() const
+{
+  if (!d_batch)
+    return true;
+  d_batch = false;
+  for (auto const &[q, stmt] : d_statementcache)
+    sqlite3_finalize(stmt);
+  d_statementcache.clear();
+  d_columncache.clear();
+  return exec("COMMIT TRANSACTION");
+}
+
+inline bool SqliteDB::inBatch() const
+{
+  return d_batch;
+}
+
+inline sqlite3_stmt *SqliteDB::prepare(std::string const &q) const
+{
+  if (d_batch)
+  {
+    auto it = d_statementcache.find(q);
+    if (it != d_statementcache.end())
+    {
+      sqlite3_reset(it->second); // in case a previous exec() bailed out early
+      sqlite3_clear_bindings(it->second);
+      return it->second;
+    }
+  }
+
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(d_db, q.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+      "During sqlite3_prepare_v2(): " << sqlite3_errmsg(d_db) << std::endl <<
+      "  Query: \"" << q << "\"" << std::endl;
+    sqlite3_finalize(stmt);
+    return nullptr;
+  }
+
+  if (d_batch && stmt)
+  {
+    if (d_statementcache.size() >= s_maxcachedstatements) [[unlikely]]
+    {
+      for (auto const &[cq, cstmt] : d_statementcache)
+        sqlite3_finalize(cstmt);
+      d_statementcache.clear();
+    }
+    d_statementcache.emplace(q, stmt);
+  }
+  return stmt;
+}
+
+// finalizes the statement, or, when it is cached, resets it for the next exec()
+inline bool SqliteDB::finish(sqlite3_stmt *stmt, std::string const &q) const
+{
+  if (d_batch)
+  {
+    auto it = d_statementcache.find(q);
+    if (it != d_statementcache.end() && it->second == stmt)
+    {
+      sqlite3_reset(stmt);
+      sqlite3_clear_bindings(stmt);
+      return true;
+    }
+  }
+
+  if (sqlite3_finalize(stmt) != SQLITE_OK)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+      "During sqlite3_finalize(): " << sqlite3_errmsg(d_db) << std::endl <<
+      "  Query: \"" << q << "\"" << std::endl;
+    return false;
+  }
+  return true;
+}
+
 inline void SqliteDB::QueryResults::emplaceHeader(std::string &&h)
 {
   d_headers.emplace_back(h);
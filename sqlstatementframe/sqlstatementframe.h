@@ -35,6 +35,8 @@ struct Period final : std::numpunct<char>
 
 class SqlStatementFrame : public BackupFrame
 {
+  friend class MicroBenchmark; // benchmark/micro times some of the private members
+
  public:
   enum PARAMETER_FIELD
   {
@@ -52,7 +54,13 @@ class SqlStatementFrame : public BackupFrame
   };
 
  private:
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 2> s_fields{{{FIELD::STATEMENT, WIRETYPE::LENGTHDELIM, false},
+                                                      {FIELD::PARAMETERS, WIRETYPE::LENGTHDELIM, true}}};
+  static constexpr std::array<FieldSpec, 5> s_parameterfields{{{PARAMETER_FIELD::STRING, WIRETYPE::LENGTHDELIM, false},
+                                                               {PARAMETER_FIELD::INT, WIRETYPE::VARINT, false},
+                                                               {PARAMETER_FIELD::DOUBLE, WIRETYPE::FIXED64, false},
+                                                               {PARAMETER_FIELD::BLOB, WIRETYPE::LENGTHDELIM, false},
+                                                               {PARAMETER_FIELD::NULLPARAMETER, WIRETYPE::VARINT, false}}};
 
   std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> d_parameterdata; // PARAMETER_FIELD, bytes, size
   std::string d_statement;
@@ -67,7 +75,6 @@ class SqlStatementFrame : public BackupFrame
   inline virtual ~SqlStatementFrame();
 
   inline virtual FRAMETYPE frameType() const override;
-  inline static BackupFrame *create(unsigned char *data, size_t length, uint64_t count = 0);
   inline virtual void printInfo() const override;
   inline void printInfo(std::vector<std::string> const &paramternames) const;
 
@@ -104,19 +111,13 @@ inline SqlStatementFrame::SqlStatementFrame()
 
 inline SqlStatementFrame::SqlStatementFrame(unsigned char *data, size_t length, uint64_t count)
   :
-  BackupFrame(data, length, count)
+  BackupFrame(count)
 {
   //std::cout << "CREATING SQLSTATEMENTFRAME" << std::endl;
-  for (auto const &p : d_framedata)
-    if (std::get<0>(p) == FIELD::PARAMETERS)
-    {
-      //std::cout << "INITIALIZING PARAMETERS: " << std::get<2>(p) << " bytes" << std::endl;
-      if (!init(std::get<1>(p), std::get<2>(p), &d_parameterdata)) [[unlikely]]
-      {
-        d_ok = false;
-        break;
-      }
-    }
+  // the parameters are decoded straight into d_parameterdata, d_framedata only
+  // holds a placeholder for them (like the add*Parameter() functions add)
+  d_constructedsize = length;
+  d_ok = init<s_fields, s_parameterfields>(data, length, &d_framedata, &d_parameterdata);
 }
 
 inline SqlStatementFrame::SqlStatementFrame(SqlStatementFrame &&other)
@@ -195,11 +196,6 @@ inline BackupFrame::FRAMETYPE SqlStatementFrame::frameType() const // virtual ov
   return FRAMETYPE::SQLSTATEMENT;
 }
 
-inline BackupFrame *SqlStatementFrame::create(unsigned char *data, size_t length, uint64_t count) // static
-{
-  return new SqlStatementFrame(data, length, count);
-}
-
 inline void SqlStatementFrame::printInfo() const
 {
   //DEBUGOUT("TYPE: SQLSTATEMENTFRAME");
@@ -31,7 +31,8 @@ class StickerFrame : public FrameWithAttachment
     LENGTH = 2, // uint32
   };
 
-  static Registrar s_registrar;
+  static constexpr std::array<FieldSpec, 2> s_fields{{{FIELD::ROWID, WIRETYPE::VARINT, false},
+                                                      {FIELD::LENGTH, WIRETYPE::VARINT, false}}};
  public:
   inline explicit StickerFrame(uint64_t count = 0);
   inline StickerFrame(unsigned char *data, size_t length, uint64_t count = 0);
@@ -41,7 +42,6 @@ class StickerFrame : public FrameWithAttachment
   inline StickerFrame &operator=(StickerFrame const &other) = default;
   inline virtual ~StickerFrame() = default;
   inline virtual FRAMETYPE frameType() const override;
-  inline static BackupFrame *create(unsigned char *data, size_t length, uint64_t count = 0);
   inline virtual void printInfo() const override;
   inline virtual uint32_t attachmentSize() const override;
   inline uint32_t length() const;
@@ -61,17 +61,15 @@ inline StickerFrame::StickerFrame(uint64_t count)
 
 inline StickerFrame::StickerFrame(unsigned char *data, size_t length, uint64_t count)
   :
-  FrameWithAttachment(data, length, count)
-{}
-
-inline BackupFrame::FRAMETYPE StickerFrame::frameType() const // virtual override
+  FrameWithAttachment(count)
 {
-  return FRAMETYPE::STICKER;
+  d_constructedsize = length;
+  d_ok = init<s_fields>(data, length, &d_framedata);
 }
 
-inline BackupFrame *StickerFrame::create(unsigned char *data, size_t length, uint64_t count) // static
+inline BackupFrame::FRAMETYPE StickerFrame::frameType() const // virtual override
 {
-  return new StickerFrame(data, length, count);
+  return FRAMETYPE::STICKER;
 }
 
 inline void StickerFrame::printInfo() const // virtual override
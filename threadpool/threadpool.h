@@ -0,0 +1,118 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <queue>
+#include <vector>
+#include <type_traits>
+
+class ThreadPool
+{
+  std::vector<std::thread> d_threads;
+  std::queue<std::function<void()>> d_tasks;
+  std::mutex d_mutex;
+  std::condition_variable d_taskavailable;
+  bool d_stop;
+
+ public:
+  inline explicit ThreadPool(unsigned int numthreads = 0);
+  ThreadPool(ThreadPool const &other) = delete;
+  ThreadPool &operator=(ThreadPool const &other) = delete;
+  inline ~ThreadPool();
+  template <typename F>
+  inline std::future<std::invoke_result_t<F>> submit(F &&task);
+  inline unsigned int size() const;
+  inline static unsigned int defaultThreads();
+
+ private:
+  inline void worker();
+};
+
+inline ThreadPool::ThreadPool(unsigned int numthreads)
+  :
+  d_stop(false)
+{
+  if (numthreads == 0)
+    numthreads = defaultThreads();
+  d_threads.reserve(numthreads);
+  for (unsigned int i = 0; i < numthreads; ++i)
+    d_threads.emplace_back(&ThreadPool::worker, this);
+}
+
+inline ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_stop = true;
+  }
+  d_taskavailable.notify_all();
+  for (auto &t : d_threads)
+    t.join();
+}
+
+template <typename F>
+inline std::future<std::invoke_result_t<F>> ThreadPool::submit(F &&task)
+{
+  // std::function needs a copyable target, packaged_task is move-only
+  auto pt = std::make_shared<std::packaged_task<std::invoke_result_t<F>()>>(std::forward<F>(task));
+  std::future<std::invoke_result_t<F>> result = pt->get_future();
+  {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_tasks.emplace([pt]() { (*pt)(); });
+  }
+  d_taskavailable.notify_one();
+  return result;
+}
+
+inline unsigned int ThreadPool::size() const
+{
+  return d_threads.size();
+}
+
+inline unsigned int ThreadPool::defaultThreads() // static
+{
+  unsigned int hc = std::thread::hardware_concurrency();
+  return hc ? hc : 1;
+}
+
+inline void ThreadPool::worker()
+{
+  while (true)
+  {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(d_mutex);
+      d_taskavailable.wait(lock, [this]() { return d_stop || !d_tasks.empty(); });
+      if (d_stop && d_tasks.empty())
+        return;
+      task = std::move(d_tasks.front());
+      d_tasks.pop();
+    }
+    task();
+  }
+}
+
+#endif
@@ -0,0 +1,36 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "trace.ih"
+
+// only called from the thread owning buffer. The new chunk is linked in with a release
+// store, so write() (walking the list from another thread) sees it fully constructed
+bool Trace::addChunk(Buffer *buffer) // static
+{
+  if (buffer->chunks >= s_maxchunks) [[unlikely]]
+  {
+    buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  Chunk *chunk = new Chunk;
+  buffer->last->next.store(chunk, std::memory_order_release);
+  buffer->last = chunk;
+  ++buffer->chunks;
+  return true;
+}
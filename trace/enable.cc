@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2019-2023  Selwin van Dijk
+  Copyright (C) 2023  Selwin van Dijk
 
   This file is part of signalbackup-tools.
 
@@ -16,5 +16,11 @@
   You should have received a copy of the GNU General Public License
   along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
 */
+#include "trace.ih"
 
-#include "avatarframe.h"
+void Trace::enable() // static
+{
+  s_start = std::chrono::steady_clock::now();
+  registerThread(); // the calling (main) thread gets tid 0
+  s_enabled = true;
+}
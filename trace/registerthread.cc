@@ -0,0 +1,29 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "trace.ih"
+
+// called the first time a thread records a span, the buffer stays alive (and gets written)
+// after the thread has exited
+Trace::Buffer *Trace::registerThread() // static
+{
+  std::lock_guard<std::mutex> lock(s_mutex);
+  s_buffers.emplace_back(new Buffer(s_buffers.size()));
+  s_threadbuffer = s_buffers.back().get();
+  return s_threadbuffer;
+}
@@ -0,0 +1,25 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "trace.h"
+
+std::atomic<bool> Trace::s_enabled(false); // static
+std::chrono::steady_clock::time_point Trace::s_start; // static
+std::mutex Trace::s_mutex; // static
+std::vector<std::unique_ptr<Trace::Buffer>> Trace::s_buffers; // static
+thread_local Trace::Buffer *Trace::s_threadbuffer = nullptr; // static
@@ -0,0 +1,167 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Timeline of hot-path spans, written as Chrome trace JSON (`--trace FILE', open it in
+// chrome://tracing or ui.perfetto.dev). A Trace::Span on the stack records its begin and end
+// into a buffer owned by the current thread. Only that thread ever appends to its buffer, and
+// publishes each event with a release store of the chunk's size, so recording takes no locks
+// (the mutex is only taken the first time a thread records anything, and when writing the
+// file). When tracing is not enabled, a Span costs a single (relaxed) atomic load, so spans can
+// stay in the code permanently.
+class Trace
+{
+ public:
+  class Span
+  {
+    char const *d_name;
+    uint64_t d_start;
+    bool d_active;
+   public:
+    inline explicit Span(char const *name); // name must be a string literal (it is kept)
+    Span(Span const &other) = delete;
+    Span &operator=(Span const &other) = delete;
+    inline ~Span();
+  };
+
+  // writes the trace (if enabled) when it goes out of scope, however main() returns
+  class Writer
+  {
+    std::string d_filename;
+   public:
+    inline explicit Writer(std::string const &filename);
+    Writer(Writer const &other) = delete;
+    Writer &operator=(Writer const &other) = delete;
+    ~Writer();
+  };
+
+ private:
+  struct Event
+  {
+    char const *name;
+    uint64_t start;    // ns since enable()
+    uint64_t duration; // ns
+  };
+
+  struct Chunk
+  {
+    static unsigned int constexpr s_capacity = 4096;
+    Event events[s_capacity];
+    std::atomic<unsigned int> size{0};
+    std::atomic<Chunk *> next{nullptr};
+  };
+
+  struct Buffer
+  {
+    unsigned int tid;
+    std::unique_ptr<Chunk> first;
+    Chunk *last;                    // only touched by the owning thread
+    uint64_t chunks;                // idem
+    std::atomic<uint64_t> dropped{0};
+    inline explicit Buffer(unsigned int id);
+    ~Buffer();
+  };
+
+  static std::atomic<bool> s_enabled;
+  static std::chrono::steady_clock::time_point s_start;
+  static std::mutex s_mutex;                            // guards s_buffers
+  static std::vector<std::unique_ptr<Buffer>> s_buffers; // buffers outlive their threads
+  static thread_local Buffer *s_threadbuffer;
+  static uint64_t constexpr s_maxchunks = 1024;         // per thread (4M events, ~100MB), later events are dropped
+
+ public:
+  static void enable();
+  inline static bool enabled();
+  static bool write(std::string const &filename);
+
+ private:
+  inline static uint64_t now();
+  inline static void record(char const *name, uint64_t start, uint64_t end);
+  static Buffer *registerThread();
+  static bool addChunk(Buffer *buffer);
+};
+
+inline bool Trace::enabled() // static
+{
+  return s_enabled.load(std::memory_order_relaxed);
+}
+
+inline uint64_t Trace::now() // static
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_start).count();
+}
+
+inline void Trace::record(char const *name, uint64_t start, uint64_t end) // static
+{
+  Buffer *buffer = s_threadbuffer;
+  if (!buffer) [[unlikely]]
+    buffer = registerThread();
+
+  Chunk *chunk = buffer->last;
+  unsigned int size = chunk->size.load(std::memory_order_relaxed);
+  if (size == Chunk::s_capacity) [[unlikely]]
+  {
+    if (!addChunk(buffer))
+      return;
+    chunk = buffer->last;
+    size = 0;
+  }
+  chunk->events[size] = Event{name, start, end - start};
+  chunk->size.store(size + 1, std::memory_order_release);
+}
+
+inline Trace::Span::Span(char const *name)
+  :
+  d_name(name),
+  d_start(0),
+  d_active(Trace::enabled())
+{
+  if (d_active) [[unlikely]]
+    d_start = Trace::now();
+}
+
+inline Trace::Span::~Span()
+{
+  if (d_active) [[unlikely]]
+    Trace::record(d_name, d_start, Trace::now());
+}
+
+inline Trace::Writer::Writer(std::string const &filename)
+  :
+  d_filename(filename)
+{}
+
+inline Trace::Buffer::Buffer(unsigned int id)
+  :
+  tid(id),
+  first(new Chunk),
+  last(first.get()),
+  chunks(1)
+{}
+
+#endif
@@ -0,0 +1,71 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "trace.ih"
+
+// Writes all recorded spans as Chrome trace events ("ph":"X", timestamps in microseconds).
+// Threads that are still running may keep appending, only events published before each
+// chunk's size is read are written. Span names are string literals from the source, so they
+// are not escaped.
+bool Trace::write(std::string const &filename) // static
+{
+  std::ofstream out(filename, std::ios_base::binary);
+  if (!out.is_open())
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to open '" << filename
+              << "' for writing trace" << std::endl;
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(s_mutex);
+
+  out << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  uint64_t events = 0;
+  uint64_t dropped = 0;
+  for (auto const &buffer : s_buffers)
+  {
+    out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+        << ",\"args\":{\"name\":\"" << (buffer->tid == 0 ? "main" : "thread " + bepaald::toString(buffer->tid)) << "\"}}";
+    first = false;
+
+    for (Chunk const *chunk = buffer->first.get(); chunk; chunk = chunk->next.load(std::memory_order_acquire))
+    {
+      unsigned int const size = chunk->size.load(std::memory_order_acquire);
+      for (unsigned int i = 0; i < size; ++i)
+        out << ",\n{\"name\":\"" << chunk->events[i].name << "\",\"cat\":\"signalbackup-tools\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+            << buffer->tid << ",\"ts\":" << chunk->events[i].start / 1e3 << ",\"dur\":" << chunk->events[i].duration / 1e3 << "}";
+      events += size;
+    }
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  out << "\n],\"otherData\":{\"dropped_events\":" << dropped << "}}" << std::endl;
+
+  if (!out)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to write trace to '" << filename << "'" << std::endl;
+    return false;
+  }
+
+  std::cout << "Wrote " << events << " trace events from " << s_buffers.size() << " thread" << (s_buffers.size() == 1 ? "" : "s")
+            << " to '" << filename << "'";
+  if (dropped)
+    std::cout << " (" << dropped << " events dropped, buffers were full)";
+  std::cout << std::endl;
+  return true;
+}
@@ -1,5 +1,5 @@
 /*
-  Copyright (C) 2019-2023  Selwin van Dijk
+  Copyright (C) 2023  Selwin van Dijk
 
   This file is part of signalbackup-tools.
 
@@ -16,5 +16,10 @@
   You should have received a copy of the GNU General Public License
   along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
 */
+#include "trace.ih"
 
-#include "attachmentframe.h"
+Trace::Writer::~Writer()
+{
+  if (Trace::enabled())
+    Trace::write(d_filename);
+}